@@ -1922,23 +1922,28 @@ namespace Simd
 
         void SynetConvolution32fDepthwiseDotProduct::Forward(const float * src, float * buf, float * dst)
         {
-            for (size_t b = 0; b < _batch; ++b)
+            const ConvParam32f & p = _param;
+            size_t threads = SynetConvolution32fThreadNumber(p);
+            SynetConvolution32fParallel(threads, _batch, _count, F, [&](size_t thread, size_t b, size_t begin, size_t end)
             {
+                const float * s = src + b * _sizeS;
+                float * d = dst + b * _sizeD;
                 if (_bias)
                 {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size) + _bias[i];
+                    for (size_t i = begin; i < end; ++i)
+                        d[i] = DotProduct(s + i * _size, _weight + i * _size, _size) + _bias[i];
                 }
                 else
                 {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
+                    for (size_t i = begin; i < end; ++i)
+                        d[i] = DotProduct(s + i * _size, _weight + i * _size, _size);
                 }
-                if (_param.activation)
-                    ConvolutionBiasAndActivation(NULL, _count, 1, _param.activation, _params, ::SimdFalse, dst);
-                src += _sizeS;
-                dst += _sizeD;
-            }
+                if (p.activation)
+                {
+                    const float * params = p.activation == ::SimdConvolutionActivationPrelu ? _params + begin : _params;
+                    ConvolutionBiasAndActivation(NULL, end - begin, 1, p.activation, params, ::SimdFalse, d + begin);
+                }
+            });
         }
 
         //---------------------------------------------------------------------
@@ -1950,6 +1955,24 @@ namespace Simd
             ConvParam32f param(batch, conv, gemm);
             if (!param.Valid())
                 return NULL;
+            else if (Base::GetTuningMode())
+            {
+                SynetConvolution32fTuned::Candidates candidates;
+                if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+                    candidates.push_back(new SynetConvolution32fDepthwiseDotProduct(param));
+                if (SynetConvolution32fWinograd::Applicable(param))
+                    candidates.push_back(new SynetConvolution32fWinograd(param));
+                if (SynetConvolution32fGemmNT::Applicable(param))
+                    candidates.push_back(new SynetConvolution32fGemmNT(param));
+                if (SynetConvolution32fDirectNchw::Preferable(param))
+                    candidates.push_back(new Avx::SynetConvolution32fDirectNchw(param));
+                if (SynetConvolution32fNhwcDirect::Preferable(param))
+                    candidates.push_back(new SynetConvolution32fNhwcDirect(param));
+                if (SynetConvolution32fDirectNhwc::Applicable(param))
+                    candidates.push_back(new SynetConvolution32fDirectNhwc(param));
+                candidates.push_back(new SynetConvolution32fGemmNN(param));
+                return SynetConvolution32fTuned::Create(param, candidates);
+            }
             else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
@@ -171,6 +171,7 @@ namespace Simd
             typedef HidHaarCascade Hid;
             const float * leaves = hid.leaves.data();
             const Hid::Node * node = hid.nodes.data();
+            const Hid::Feature * feature = hid.features.data();
             const Hid::Stage * stages = hid.stages.data();
             for (int i = 0, n = (int)hid.stages.size(); i < n; ++i)
             {
@@ -181,21 +182,19 @@ namespace Simd
                 __m256 stageSum = _mm256_setzero_ps();
                 if (stage.hasThree)
                 {
-                    for (; node < end; ++node, leaves += 2)
+                    for (; node < end; ++node, ++feature, leaves += 2)
                     {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        __m256 sum = _mm256_add_ps(WeightedSum32f(feature.rect[0], offset), WeightedSum32f(feature.rect[1], offset));
-                        if (feature.rect[2].p0)
-                            sum = _mm256_add_ps(sum, WeightedSum32f(feature.rect[2], offset));
+                        __m256 sum = _mm256_add_ps(WeightedSum32f(feature->rect[0], offset), WeightedSum32f(feature->rect[1], offset));
+                        if (feature->rect[2].p0)
+                            sum = _mm256_add_ps(sum, WeightedSum32f(feature->rect[2], offset));
                         StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                     }
                 }
                 else
                 {
-                    for (; node < end; ++node, leaves += 2)
+                    for (; node < end; ++node, ++feature, leaves += 2)
                     {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        __m256 sum = _mm256_add_ps(WeightedSum32f(feature.rect[0], offset), WeightedSum32f(feature.rect[1], offset));
+                        __m256 sum = _mm256_add_ps(WeightedSum32f(feature->rect[0], offset), WeightedSum32f(feature->rect[1], offset));
                         StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                     }
                 }
@@ -417,7 +416,6 @@ namespace Simd
             size_t subsetSize = (hid.ncategories + 31) / 32;
             const int * subsets = hid.subsets.data();
             const Hid::Leave * leaves = hid.leaves.data();
-            const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
             int nodeOffset = stages[startStage].first;
             int leafOffset = 2 * nodeOffset;
@@ -427,7 +425,7 @@ namespace Simd
                 __m256 sum = _mm256_setzero_ps();
                 for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
                 {
-                    const Hid::Feature & feature = hid.features[nodes[nodeOffset].featureIdx];
+                    const Hid::Feature & feature = hid.features[nodeOffset];
                     const int * subset = subsets + nodeOffset*subsetSize;
                     __m256i mask = LeafMask(feature, offset, subset);
                     sum = _mm256_add_ps(sum, _mm256_blendv_ps(_mm256_broadcast_ss(leaves + leafOffset + 1), _mm256_broadcast_ss(leaves + leafOffset + 0), _mm256_castsi256_ps(mask)));
@@ -638,7 +636,6 @@ namespace Simd
             size_t subsetSize = (hid.ncategories + 31) / 32;
             const int * subsets = hid.subsets.data();
             const Hid::Leave * leaves = hid.leaves.data();
-            const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
             int nodeOffset = 0, leafOffset = 0;
             for (int i_stage = 0, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
@@ -647,7 +644,7 @@ namespace Simd
                 __m256i sum = _mm256_setzero_si256();
                 for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
                 {
-                    const Hid::Feature & feature = hid.features[nodes[nodeOffset].featureIdx];
+                    const Hid::Feature & feature = hid.features[nodeOffset];
                     const int * subset = subsets + nodeOffset*subsetSize;
                     __m256i mask = LeafMask(feature, offset, subset);
                     sum = _mm256_add_epi16(sum, _mm256_blendv_epi8(_mm256_set1_epi16(leaves[leafOffset + 1]), _mm256_set1_epi16(leaves[leafOffset + 0]), mask));
@@ -638,6 +638,158 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerNearest::ResizerNearest(const ResParam & param)
+            : Base::ResizerNearest(param)
+        {
+        }
+
+        void ResizerNearest::Run4(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            size_t dstW = _param.dstW, dstW8 = AlignLo(dstW, 8);
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                const uint8_t * ps = src + _iy[dy] * srcStride;
+                size_t dx = 0;
+                for (; dx < dstW8; dx += 8)
+                {
+                    __m256i index = _mm256_loadu_si256((__m256i*)(_ix.data + dx));
+                    _mm256_storeu_si256((__m256i*)(dst + dx * 4), _mm256_i32gather_epi32((const int*)ps, index, 1));
+                }
+                for (; dx < dstW; dx++)
+                    *(int32_t*)(dst + dx * 4) = *(int32_t*)(ps + _ix[dx]);
+            }
+        }
+
+        void ResizerNearest::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            if (_pixelSize == 4)
+                Run4(src, srcStride, dst, dstStride);
+            else
+                Base::ResizerNearest::Run(src, srcStride, dst, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Sse2::ResizerByteFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowY(const int16_t * const * src, const int16_t * alpha, size_t size, size_t offset, uint8_t * dst)
+        {
+            __m256i lo = _mm256_set1_epi32(Base::FILTER_ROUND_Y), hi = lo;
+            for (size_t k = 0; k < size; k += 2)
+            {
+                __m256i s0 = _mm256_loadu_si256((__m256i*)(src[k + 0] + offset));
+                __m256i s1 = _mm256_loadu_si256((__m256i*)(src[k + 1] + offset));
+                __m256i a = _mm256_set1_epi32(*(int32_t*)(alpha + k));
+                lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), a));
+                hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), a));
+            }
+            __m256i res = _mm256_packs_epi32(_mm256_srai_epi32(lo, Base::FILTER_SHIFT_Y), _mm256_srai_epi32(hi, Base::FILTER_SHIFT_Y));
+            _mm_storeu_si128((__m128i*)(dst + offset), _mm256_castsi256_si128(PackU16ToU8(res, res)));
+        }
+
+        void ResizerByteFilter::RunY(const int16_t * const * src, const int16_t * alpha, size_t size, uint8_t * dst)
+        {
+            if (size < HA)
+            {
+                Sse2::ResizerByteFilter::RunY(src, alpha, size, dst);
+                return;
+            }
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                ResizerByteFilterRowY(src, alpha, _sizeY, i, dst);
+            if (sizeHA < size)
+                ResizerByteFilterRowY(src, alpha, _sizeY, size - HA, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : Base::ResizerShortBilinear(param)
+        {
+        }
+
+        void ResizerShortBilinear::RunX(const uint16_t * src, float * dst)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn, rsF = AlignLo(rs, F);
+            const int32_t * ix = _ix.data;
+            const float * ax = _ax.data;
+            __m256 _1 = _mm256_set1_ps(1.0f);
+            __m256i lo = _mm256_set1_epi32(0xFFFF);
+            size_t dx = 0;
+            for (; dx < rsF; dx += F)
+            {
+                __m256i idx = _mm256_loadu_si256((__m256i*)(ix + dx));
+                __m256i s0 = _mm256_i32gather_epi32((int32_t*)src, idx, 2);
+                __m256i s1 = cn == 1 ? s0 : _mm256_i32gather_epi32((int32_t*)(src + cn - 1), idx, 2);
+                __m256 fx1 = _mm256_loadu_ps(ax + dx);
+                __m256 fx0 = _mm256_sub_ps(_1, fx1);
+                __m256 m0 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(s0, lo)), fx0);
+                __m256 m1 = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(s1, 16)), fx1);
+                _mm256_storeu_ps(dst + dx, _mm256_add_ps(m0, m1));
+            }
+            for (; dx < rs; dx++)
+            {
+                int32_t sx = ix[dx];
+                float fx = ax[dx];
+                dst[dx] = src[sx] * (1.0f - fx) + src[sx + cn] * fx;
+            }
+        }
+
+        SIMD_INLINE __m256i ResizerShortRunY(const float * src0, const float * src1, __m256 fy0, __m256 fy1)
+        {
+            __m256 value = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src0), fy0), _mm256_mul_ps(_mm256_loadu_ps(src1), fy1));
+            return _mm256_cvttps_epi32(_mm256_add_ps(value, _mm256_set1_ps(0.5f)));
+        }
+
+        void ResizerShortBilinear::RunY(const float * src0, const float * src1, float fy, uint16_t * dst)
+        {
+            size_t rs = _param.dstW * _param.channels, rsDF = AlignLo(rs, DF);
+            __m256 _fy0 = _mm256_set1_ps(1.0f - fy), _fy1 = _mm256_set1_ps(fy);
+            size_t dx = 0;
+            for (; dx < rsDF; dx += DF)
+            {
+                __m256i d0 = ResizerShortRunY(src0 + dx + 0, src1 + dx + 0, _fy0, _fy1);
+                __m256i d1 = ResizerShortRunY(src0 + dx + F, src1 + dx + F, _fy0, _fy1);
+                _mm256_storeu_si256((__m256i*)(dst + dx), PackU32ToI16(d0, d1));
+            }
+            for (; dx < rs; dx++)
+                dst[dx] = Base::ResizerShortRound(src0[dx] * (1.0f - fy) + src1[dx] * fy);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : Base::ResizerShortArea(param)
+        {
+        }
+
+        template<UpdateType update> SIMD_INLINE void ResizerShortAreaRowUpdate(const uint16_t * src, size_t size, float a, float * dst)
+        {
+            size_t sizeHA = AlignLo(size, HA), i = 0;
+            __m256 alpha = _mm256_set1_ps(a);
+            for (; i < sizeHA; i += HA)
+            {
+                __m128i s0 = _mm_loadu_si128((__m128i*)(src + i) + 0);
+                __m128i s1 = _mm_loadu_si128((__m128i*)(src + i) + 1);
+                Avx::Update<update, false>(dst + i + 0, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(s0)), alpha));
+                Avx::Update<update, false>(dst + i + F, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(s1)), alpha));
+            }
+            for (; i < size; ++i)
+                Base::Update<update>(dst + i, src[i] * a);
+        }
+
+        void ResizerShortArea::RowSum(const uint16_t * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst)
+        {
+            ResizerShortAreaRowUpdate<UpdateSet>(src, size, count ? curr : curr - next, dst);
+            for (size_t i = 1; i <= count; ++i)
+                src += stride, ResizerShortAreaRowUpdate<UpdateAdd>(src, size, i < count ? zero : zero - next, dst);
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m256i));
@@ -647,9 +799,26 @@ namespace Simd
                 return new ResizerByteArea(param);
             else if (type == SimdResizeChannelFloat && (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp))
                 return new ResizerFloatBilinear(param);
+            else if (type == SimdResizeChannelShort && (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp))
+                return new ResizerShortBilinear(param);
+            else if (type == SimdResizeChannelShort && method == SimdResizeMethodArea)
+                return new ResizerShortArea(param);
+            else if (method == SimdResizeMethodNearest)
+                return new ResizerNearest(param);
+            else if (type == SimdResizeChannelByte && param.IsFilter())
+                return new ResizerByteFilter(param);
             else
                 return Avx::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m256i));
+            if (type == SimdResizeChannelByte && (method == SimdResizeMethodBilinear || param.IsFilter()))
+                return new ResizerByteFilter(param);
+            else
+                return Avx::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+        }
     }
 #endif //SIMD_AVX2_ENABLE 
 }
@@ -0,0 +1,191 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        template<size_t M> SIMD_INLINE void Gemm8iNN_Mx16(size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc)
+        {
+            __m256i c0[M], c1[M];
+            for (size_t i = 0; i < M; ++i)
+            {
+                c0[i] = _mm256_setzero_si256();
+                c1[i] = _mm256_setzero_si256();
+            }
+            const __m256i ones = _mm256_set1_epi16(1);
+            for (size_t k = 0; k < K; k += 4)
+            {
+                __m256i b0 = _mm256_loadu_si256((__m256i*)B + 0);
+                __m256i b1 = _mm256_loadu_si256((__m256i*)B + 1);
+                for (size_t i = 0; i < M; ++i)
+                {
+                    __m256i a = _mm256_set1_epi32(*(int32_t*)(A + i * lda + k));
+                    c0[i] = _mm256_add_epi32(c0[i], _mm256_madd_epi16(_mm256_maddubs_epi16(a, b0), ones));
+                    c1[i] = _mm256_add_epi32(c1[i], _mm256_madd_epi16(_mm256_maddubs_epi16(a, b1), ones));
+                }
+                B += ldb * 4;
+            }
+            for (size_t i = 0; i < M; ++i)
+            {
+                _mm256_storeu_si256((__m256i*)(C + i * ldc) + 0, c0[i]);
+                _mm256_storeu_si256((__m256i*)(C + i * ldc) + 1, c1[i]);
+            }
+        }
+
+        void Gemm8iNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc)
+        {
+            assert(N % 16 == 0 && K % 4 == 0);
+            size_t M4 = AlignLo(M, 4);
+            for (size_t j = 0; j < N; j += 16)
+            {
+                size_t i = 0;
+                for (; i < M4; i += 4)
+                    Gemm8iNN_Mx16<4>(K, A + i * lda, lda, B + j * 4, ldb, C + i * ldc + j, ldc);
+                switch (M - M4)
+                {
+                case 1: Gemm8iNN_Mx16<1>(K, A + i * lda, lda, B + j * 4, ldb, C + i * ldc + j, ldc); break;
+                case 2: Gemm8iNN_Mx16<2>(K, A + i * lda, lda, B + j * 4, ldb, C + i * ldc + j, ldc); break;
+                case 3: Gemm8iNN_Mx16<3>(K, A + i * lda, lda, B + j * 4, ldb, C + i * ldc + j, ldc); break;
+                }
+            }
+        }
+
+        template<::SimdConvolutionActivationType type> SIMD_INLINE __m256 Convert(const int32_t * src, const float * norm, const float * bias, const float * params, __m256 * _params)
+        {
+            if (type == ::SimdConvolutionActivationPrelu)
+                _params[0] = _mm256_loadu_ps(params);
+            __m256 value = _mm256_cvtepi32_ps(_mm256_loadu_si256((__m256i*)src));
+            return Activate<type>(_mm256_fmadd_ps(value, _mm256_loadu_ps(norm), _mm256_loadu_ps(bias)), _params, 0);
+        }
+
+        template<::SimdConvolutionActivationType type> void Convert8u(const int32_t * src, size_t M, size_t N, size_t ldS,
+            const float * norm, const float * bias, const float * params, const float * scale, const float * shift, uint8_t * dst, size_t ldD)
+        {
+            size_t N8 = AlignLo(N, 8);
+            __m256 _params[2];
+            _params[0] = _mm256_set1_ps(params[0]);
+            _params[1] = _mm256_set1_ps(params[1]);
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; j += 8)
+                {
+                    __m256 value = Convert<type>(src + j, norm + j, bias + j, params + j, _params);
+                    __m256i i32 = _mm256_cvtps_epi32(_mm256_fmadd_ps(value, _mm256_loadu_ps(scale + j), _mm256_loadu_ps(shift + j)));
+                    __m128i u8 = _mm_packus_epi16(_mm_packs_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1)), _mm_setzero_si128());
+                    if (j < N8)
+                        _mm_storel_epi64((__m128i*)(dst + j), u8);
+                    else
+                    {
+                        uint8_t tmp[16];
+                        _mm_storeu_si128((__m128i*)tmp, u8);
+                        for (size_t k = j; k < N; ++k)
+                            dst[k] = tmp[k - j];
+                    }
+                }
+                src += ldS;
+                dst += ldD;
+            }
+        }
+
+        template<::SimdConvolutionActivationType type> void Convert32f(const int32_t * src, size_t M, size_t N, size_t ldS,
+            const float * norm, const float * bias, const float * params, const float * scale, const float * shift, uint8_t * dst, size_t ldD)
+        {
+            size_t N8 = AlignLo(N, 8);
+            __m256 _params[2];
+            _params[0] = _mm256_set1_ps(params[0]);
+            _params[1] = _mm256_set1_ps(params[1]);
+            float * pDst = (float*)dst;
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; j += 8)
+                {
+                    __m256 value = Convert<type>(src + j, norm + j, bias + j, params + j, _params);
+                    if (j < N8)
+                        _mm256_storeu_ps(pDst + j, value);
+                    else
+                    {
+                        float tmp[8];
+                        _mm256_storeu_ps(tmp, value);
+                        for (size_t k = j; k < N; ++k)
+                            pDst[k] = tmp[k - j];
+                    }
+                }
+                src += ldS;
+                pDst += ldD;
+            }
+        }
+
+        template<::SimdConvolutionActivationType type> Base::SynetConvolution8iGemmNN::ConvertPtr GetConvert(::SimdTensorDataType dstT)
+        {
+            return dstT == SimdTensorData8u ? Convert8u<type> : Convert32f<type>;
+        }
+
+        Base::SynetConvolution8iGemmNN::ConvertPtr GetConvert(::SimdConvolutionActivationType activation, ::SimdTensorDataType dstT)
+        {
+            switch (activation)
+            {
+            case ::SimdConvolutionActivationIdentity: return GetConvert<::SimdConvolutionActivationIdentity>(dstT);
+            case ::SimdConvolutionActivationRelu: return GetConvert<::SimdConvolutionActivationRelu>(dstT);
+            case ::SimdConvolutionActivationLeakyRelu: return GetConvert<::SimdConvolutionActivationLeakyRelu>(dstT);
+            case ::SimdConvolutionActivationRestrictRange: return GetConvert<::SimdConvolutionActivationRestrictRange>(dstT);
+            case ::SimdConvolutionActivationPrelu: return GetConvert<::SimdConvolutionActivationPrelu>(dstT);
+            case ::SimdConvolutionActivationElu: return GetConvert<::SimdConvolutionActivationElu>(dstT);
+            default: assert(0); return NULL;
+            }
+        }
+
+        SynetConvolution8iGemmNN::SynetConvolution8iGemmNN(const ConvParam8i & p)
+            : Base::SynetConvolution8iGemmNN(p)
+        {
+            _gemm = Avx2::Gemm8iNN;
+            _convert = Avx2::GetConvert(p.activation, p.dstT);
+        }
+
+        SynetConvolution8iDepthwise::SynetConvolution8iDepthwise(const ConvParam8i & p)
+            : Base::SynetConvolution8iDepthwise(p)
+        {
+            _convert = Avx2::GetConvert(p.activation, p.dstT);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv)
+        {
+            ConvParam8i param(batch, conv);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsDepthwise())
+                return new SynetConvolution8iDepthwise(param);
+            return new SynetConvolution8iGemmNN(param);
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
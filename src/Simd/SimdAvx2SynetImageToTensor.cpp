@@ -0,0 +1,129 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetImageToTensor.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSsse3.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        SynetImageToTensor::SynetImageToTensor(const ImgToTenParam & param)
+            : Sse2::SynetImageToTensor(param)
+        {
+            ConvertPtr bgraToBgr = Base::BgraToBgr;
+            if (param.srcW >= Ssse3::A)
+                bgraToBgr = Ssse3::BgraToBgr;
+            SetConverters(bgraToBgr,
+                param.srcW >= A ? Avx2::GrayToBgr : Base::GrayToBgr,
+                param.srcW >= A ? Avx2::BgrToGray : Base::BgrToGray,
+                param.srcW >= A ? Avx2::BgraToGray : Base::BgraToGray,
+                param.srcW / 2 >= A ? Avx2::DeinterleaveUv : Base::DeinterleaveUv,
+                param.srcW >= DA ? Avx2::Yuv420pToBgr : Base::Yuv420pToBgr);
+        }
+
+        SIMD_INLINE void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, __m128i shift, __m256i last, size_t i, float * dst)
+        {
+            __m256i index = _mm256_loadu_si256((__m256i*)(ix + i));
+            if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(index, last)))
+            {
+                Sse2::SynetImageToTensorRowX(src, srcSize, ix + i, ax + i, dx, F, dst + i);
+                return;
+            }
+            __m256i value = _mm256_i32gather_epi32((const int*)src, index, 1);
+            __m256 s0 = _mm256_cvtepi32_ps(_mm256_and_si256(value, K32_000000FF));
+            __m256 s1 = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srl_epi32(value, shift), K32_000000FF));
+            _mm256_storeu_ps(dst + i, _mm256_add_ps(s0, _mm256_mul_ps(_mm256_sub_ps(s1, s0), _mm256_loadu_ps(ax + i))));
+        }
+
+        void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst)
+        {
+            if (size < F || srcSize < 4 || dx > 3)
+            {
+                Sse2::SynetImageToTensorRowX(src, srcSize, ix, ax, dx, size, dst);
+                return;
+            }
+            __m128i shift = _mm_cvtsi32_si128(int(dx * 8));
+            __m256i last = _mm256_set1_epi32(int(srcSize - 4));
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                SynetImageToTensorRowX(src, srcSize, ix, ax, dx, shift, last, i, dst);
+            if (sizeF < size)
+                SynetImageToTensorRowX(src, srcSize, ix, ax, dx, shift, last, size - F, dst);
+        }
+
+        void SynetImageToTensor::RunX(const uint8_t * src, float * dst)
+        {
+            SynetImageToTensorRowX(src, _rowSize, _ix.data, _ax.data, _dx, _size, dst);
+        }
+
+        SIMD_INLINE void SynetImageToTensorRowY(const float * src0, const float * src1, __m256 alpha, const float * scale, const float * shift, size_t i, float * dst)
+        {
+            __m256 s0 = _mm256_loadu_ps(src0 + i);
+            __m256 s = _mm256_add_ps(s0, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(src1 + i), s0), alpha));
+            _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(s, _mm256_loadu_ps(scale + i)), _mm256_loadu_ps(shift + i)));
+        }
+
+        void SynetImageToTensorRowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            if (size < F)
+            {
+                Sse2::SynetImageToTensorRowY(src0, src1, alpha, scale, shift, size, dst);
+                return;
+            }
+            __m256 _alpha = _mm256_set1_ps(alpha);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                SynetImageToTensorRowY(src0, src1, _alpha, scale, shift, i, dst);
+            if (sizeF < size)
+                SynetImageToTensorRowY(src0, src1, _alpha, scale, shift, size - F, dst);
+        }
+
+        void SynetImageToTensor::RowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            SynetImageToTensorRowY(src0, src1, alpha, scale, shift, size, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat)
+        {
+            ImgToTenParam param(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+            if (!param.Valid())
+                return NULL;
+            return new SynetImageToTensor(param);
+        }
+
+        void * SynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale)
+        {
+            CropResParam param(channels, dstWidth, dstHeight, dstFormat, dstType, keepAspect, mean, scale);
+            if (!param.Valid())
+                return NULL;
+            return new Base::SynetCropResize(param, Avx2::SynetImageToTensorRowX, Avx2::SynetImageToTensorRowY);
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
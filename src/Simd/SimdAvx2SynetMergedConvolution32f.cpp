@@ -720,6 +720,64 @@ namespace Simd
             }
         }
 
+        template<SimdConvolutionActivationType type> void DepthwiseConvolution(const float * src, const SimdConvolutionParameters & p,
+            size_t srcC, size_t yBeg, size_t yEnd, const size_t bufH[2], const float * weight, const float * bias, const float * params, float * dst)
+        {
+            size_t strideY = p.strideY, strideX = p.strideX, padY = p.padY, padX = p.padX, dilationY = p.dilationY, dilationX = p.dilationX;
+            size_t srcH = p.srcH, srcW = p.srcW, dstW = p.dstW, kernelY = p.kernelY, kernelX = p.kernelX;
+            size_t srcM = (bufH[0] - 1), dstM = (bufH[1] - 1), srcS = bufH[0] * srcW * F, dstS = bufH[1] * dstW * F, weightS = kernelY * kernelX * F;
+            size_t sizeX = dilationX * (kernelX - 1) + 1;
+
+            __m256 _params[2];
+            _params[0] = _mm256_set1_ps(params[0]);
+            if (type == ::SimdConvolutionActivationRestrictRange)
+                _params[1] = _mm256_set1_ps(params[1]);
+            for (size_t c = 0; c < srcC; c += F)
+            {
+                __m256 _bias = bias ? _mm256_loadu_ps(bias + c) : _mm256_setzero_ps();
+                if (type == ::SimdConvolutionActivationPrelu)
+                    _params[0] = _mm256_loadu_ps(params + c);
+                for (size_t dy = yBeg; dy < yEnd; ++dy)
+                {
+                    float * pDst = dst + (dy&dstM)*dstW*F;
+                    for (size_t dx = 0; dx < dstW; ++dx, pDst += F)
+                    {
+                        __m256 sum = _bias;
+                        size_t sx0 = dx * strideX - padX;
+                        bool inside = sx0 < srcW && sx0 + sizeX <= srcW;
+                        for (size_t ky = 0; ky < kernelY; ++ky)
+                        {
+                            size_t sy = dy * strideY + ky * dilationY - padY;
+                            if (sy < srcH)
+                            {
+                                const float * pSrc = src + (sy&srcM)*srcW*F;
+                                const float * pWeight = weight + ky * kernelX * F;
+                                if (inside)
+                                {
+                                    pSrc += sx0 * F;
+                                    for (size_t kx = 0; kx < kernelX; ++kx, pSrc += dilationX * F, pWeight += F)
+                                        sum = _mm256_fmadd_ps(_mm256_loadu_ps(pSrc), _mm256_loadu_ps(pWeight), sum);
+                                }
+                                else
+                                {
+                                    for (size_t kx = 0; kx < kernelX; ++kx, pWeight += F)
+                                    {
+                                        size_t sx = sx0 + kx * dilationX;
+                                        if (sx < srcW)
+                                            sum = _mm256_fmadd_ps(_mm256_loadu_ps(pSrc + sx * F), _mm256_loadu_ps(pWeight), sum);
+                                    }
+                                }
+                            }
+                        }
+                        _mm256_storeu_ps(pDst, Activate<type>(sum, _params, 0));
+                    }
+                }
+                src += srcS;
+                dst += dstS;
+                weight += weightS;
+            }
+        }
+
         template<TermType term, SimdConvolutionActivationType type> void OutputConvolution_2x6(const float * src, size_t srcC, size_t srcS,
             const float * weight, const __m256 * bias, const __m256 * params, float * dst, size_t dstC, size_t tail)
         {
@@ -1163,13 +1221,18 @@ namespace Simd
             switch (index)
             {
             case 0:
-                if (p.conv[0].kernelY == 1 && p.conv[0].strideY == 1)
+                if (p.count == 2)
+                    convolution[0] = Base::InputCopy<F>;
+                else if (p.conv[0].kernelY == 1 && p.conv[0].strideY == 1)
                     convolution[0] = InputConvolution1x1<type>;
                 else
                     convolution[0] = InputConvolution<type>;
                 break;
             case 1:
-                convolution[1] = DepthwiseConvolution3x3<type>;
+                if (p.IsDepthwise3x3())
+                    convolution[1] = DepthwiseConvolution3x3<type>;
+                else
+                    convolution[1] = DepthwiseConvolution<type>;
                 break;
             case 2:
                 if (p.add)
@@ -1195,7 +1258,7 @@ namespace Simd
         SynetMergedConvolution32f::SynetMergedConvolution32f(const MergConvParam32f & p)
             : Avx::SynetMergedConvolution32f(p)
         {
-            for (size_t i = 0; i < _param.count; ++i)
+            for (size_t i = 0; i < 3; ++i)
             {
                 switch (p.conv[i].activation)
                 {
@@ -0,0 +1,265 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdWarp.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        const __m256i K32_WARP_MASK = SIMD_MM256_SET1_EPI32(WARP_MASK);
+        const __m256i K32_WARP_RANGE = SIMD_MM256_SET1_EPI32(WARP_RANGE);
+        const __m256i K32_WARP_ROUND = SIMD_MM256_SET1_EPI32(WARP_ROUND);
+
+        SIMD_INLINE bool WarpInside(__m256i ix, __m256i iy, __m256i w, __m256i h)
+        {
+            __m256i inside = _mm256_and_si256(_mm256_cmpgt_epi32(ix, K_INV_ZERO), _mm256_cmpgt_epi32(w, ix));
+            inside = _mm256_and_si256(inside, _mm256_and_si256(_mm256_cmpgt_epi32(iy, K_INV_ZERO), _mm256_cmpgt_epi32(h, iy)));
+            return _mm256_movemask_epi8(inside) == -1;
+        }
+
+        SIMD_INLINE __m256i WarpChannel(__m256i pixel, size_t channel)
+        {
+            return _mm256_and_si256(_mm256_srli_epi32(pixel, int(8 * channel)), K32_000000FF);
+        }
+
+        SIMD_INLINE __m256i WarpInterpolate(__m256i p00, __m256i p01, __m256i p10, __m256i p11, __m256i kx0, __m256i kx1, __m256i ky0, __m256i ky1)
+        {
+            __m256i t0 = _mm256_add_epi32(_mm256_mullo_epi32(p00, kx0), _mm256_mullo_epi32(p01, kx1));
+            __m256i t1 = _mm256_add_epi32(_mm256_mullo_epi32(p10, kx0), _mm256_mullo_epi32(p11, kx1));
+            __m256i sum = _mm256_add_epi32(_mm256_mullo_epi32(t0, ky0), _mm256_mullo_epi32(t1, ky1));
+            return _mm256_srli_epi32(_mm256_add_epi32(sum, K32_WARP_ROUND), 2 * WARP_SHIFT);
+        }
+
+        template<size_t N> SIMD_INLINE void WarpStore(__m128i value, uint8_t * dst);
+
+        template<> SIMD_INLINE void WarpStore<1>(__m128i value, uint8_t * dst)
+        {
+            *(int32_t*)dst = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(value, Sse2::K_ZERO), Sse2::K_ZERO));
+        }
+
+        template<> SIMD_INLINE void WarpStore<2>(__m128i value, uint8_t * dst)
+        {
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi32(value, Sse2::K_ZERO));
+        }
+
+        const __m128i K8_WARP_SHUFFLE_3 = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+        template<> SIMD_INLINE void WarpStore<3>(__m128i value, uint8_t * dst)
+        {
+            value = _mm_shuffle_epi8(value, K8_WARP_SHUFFLE_3);
+            _mm_storel_epi64((__m128i*)dst, value);
+            *(int32_t*)(dst + 8) = _mm_extract_epi32(value, 2);
+        }
+
+        template<> SIMD_INLINE void WarpStore<4>(__m128i value, uint8_t * dst)
+        {
+            _mm_storeu_si128((__m128i*)dst, value);
+        }
+
+        template<size_t N> SIMD_INLINE void WarpByte(const uint8_t * src, size_t stride, __m256i offs, __m256i fx, __m256i fy, uint8_t * dst)
+        {
+            __m256i kx0 = _mm256_sub_epi32(K32_WARP_RANGE, fx), ky0 = _mm256_sub_epi32(K32_WARP_RANGE, fy);
+            const uint8_t * s0 = src, * s1 = src + stride;
+            __m256i value = _mm256_setzero_si256();
+            if (N == 4)
+            {
+                __m256i p00 = _mm256_i32gather_epi32((int32_t*)s0, offs, 1);
+                __m256i p01 = _mm256_i32gather_epi32((int32_t*)(s0 + 4), offs, 1);
+                __m256i p10 = _mm256_i32gather_epi32((int32_t*)s1, offs, 1);
+                __m256i p11 = _mm256_i32gather_epi32((int32_t*)(s1 + 4), offs, 1);
+                for (size_t c = 0; c < N; ++c)
+                {
+                    __m256i r = WarpInterpolate(WarpChannel(p00, c), WarpChannel(p01, c), WarpChannel(p10, c), WarpChannel(p11, c), kx0, fx, ky0, fy);
+                    value = _mm256_or_si256(value, _mm256_slli_epi32(r, int(8 * c)));
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < N; ++c)
+                {
+                    __m256i p00 = _mm256_and_si256(_mm256_i32gather_epi32((int32_t*)(s0 + c), offs, 1), K32_000000FF);
+                    __m256i p01 = _mm256_and_si256(_mm256_i32gather_epi32((int32_t*)(s0 + c + N), offs, 1), K32_000000FF);
+                    __m256i p10 = _mm256_srli_epi32(_mm256_i32gather_epi32((int32_t*)(s1 + c - 3), offs, 1), 24);
+                    __m256i p11 = _mm256_srli_epi32(_mm256_i32gather_epi32((int32_t*)(s1 + c + N - 3), offs, 1), 24);
+                    __m256i r = WarpInterpolate(p00, p01, p10, p11, kx0, fx, ky0, fy);
+                    value = _mm256_or_si256(value, _mm256_slli_epi32(r, int(8 * c)));
+                }
+            }
+            WarpStore<N>(_mm256_castsi256_si128(value), dst);
+            WarpStore<N>(_mm256_extracti128_si256(value, 1), dst + 4 * N);
+        }
+
+        template<size_t N> SIMD_INLINE void WarpFloat(const uint8_t * src, size_t stride, __m256i offs, __m256i fx, __m256i fy, float * dst)
+        {
+            __m256 kx1 = _mm256_mul_ps(_mm256_cvtepi32_ps(fx), _mm256_set1_ps(1.0f / WARP_RANGE)), kx0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), kx1);
+            __m256 ky1 = _mm256_mul_ps(_mm256_cvtepi32_ps(fy), _mm256_set1_ps(1.0f / WARP_RANGE)), ky0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), ky1);
+            const uint8_t * s0 = src, * s1 = src + stride;
+            __m256 r[4];
+            for (size_t c = 0; c < N; ++c)
+            {
+                size_t c0 = c * 4, c1 = (c + N) * 4;
+                __m256 t0 = _mm256_add_ps(_mm256_mul_ps(_mm256_i32gather_ps((float*)(s0 + c0), offs, 1), kx0), _mm256_mul_ps(_mm256_i32gather_ps((float*)(s0 + c1), offs, 1), kx1));
+                __m256 t1 = _mm256_add_ps(_mm256_mul_ps(_mm256_i32gather_ps((float*)(s1 + c0), offs, 1), kx0), _mm256_mul_ps(_mm256_i32gather_ps((float*)(s1 + c1), offs, 1), kx1));
+                r[c] = _mm256_add_ps(_mm256_mul_ps(t0, ky0), _mm256_mul_ps(t1, ky1));
+            }
+            if (N == 1)
+                _mm256_storeu_ps(dst, r[0]);
+            else if (N == 2)
+            {
+                __m256 lo = _mm256_unpacklo_ps(r[0], r[1]), hi = _mm256_unpackhi_ps(r[0], r[1]);
+                _mm256_storeu_ps(dst + 0, _mm256_permute2f128_ps(lo, hi, 0x20));
+                _mm256_storeu_ps(dst + F, _mm256_permute2f128_ps(lo, hi, 0x31));
+            }
+            else
+            {
+                SIMD_ALIGNED(32) float buf[4][F];
+                for (size_t c = 0; c < N; ++c)
+                    _mm256_store_ps(buf[c], r[c]);
+                if (N == 4)
+                {
+                    for (size_t i = 0; i < F; i += 4)
+                    {
+                        __m128 v0 = _mm_load_ps(buf[0] + i), v1 = _mm_load_ps(buf[1] + i), v2 = _mm_load_ps(buf[2] + i), v3 = _mm_load_ps(buf[3] + i);
+                        _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+                        _mm_storeu_ps(dst + 4 * i + 0, v0);
+                        _mm_storeu_ps(dst + 4 * i + 4, v1);
+                        _mm_storeu_ps(dst + 4 * i + 8, v2);
+                        _mm_storeu_ps(dst + 4 * i + 12, v3);
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < F; ++i)
+                        for (size_t c = 0; c < N; ++c)
+                            dst[i * N + c] = buf[c][i];
+                }
+            }
+        }
+
+        template<class T, size_t N> void WarpRow(const WarpParam & p, const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst)
+        {
+            size_t dstW = p.dstW, dstWF = srcStride >= 4 ? AlignLo(dstW, F) : 0, x = 0;
+            __m256i w = _mm256_set1_epi32((int32_t)p.srcW - 1), h = _mm256_set1_epi32((int32_t)p.srcH - 1);
+            __m256i stride = _mm256_set1_epi32((int32_t)srcStride), size = _mm256_set1_epi32(int32_t(N * sizeof(T)));
+            for (; x < dstWF; x += F)
+            {
+                __m256i fx = _mm256_loadu_si256((__m256i*)(sx + x));
+                __m256i fy = _mm256_loadu_si256((__m256i*)(sy + x));
+                __m256i ix = _mm256_srai_epi32(fx, WARP_SHIFT);
+                __m256i iy = _mm256_srai_epi32(fy, WARP_SHIFT);
+                if (!WarpInside(ix, iy, w, h))
+                {
+                    Base::WarpRow<T, N>(p, src, srcStride, sx, sy, x, x + F, dst);
+                    continue;
+                }
+                __m256i offs = _mm256_add_epi32(_mm256_mullo_epi32(iy, stride), _mm256_mullo_epi32(ix, size));
+                fx = _mm256_and_si256(fx, K32_WARP_MASK);
+                fy = _mm256_and_si256(fy, K32_WARP_MASK);
+                if (sizeof(T) == 1)
+                    WarpByte<N>(src, srcStride, offs, fx, fy, dst + x * N);
+                else
+                    WarpFloat<N>(src, srcStride, offs, fx, fy, (float*)dst + x * N);
+            }
+            Base::WarpRow<T, N>(p, src, srcStride, sx, sy, x, dstW, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpBilinear::WarpBilinear(const WarpParam & param)
+            : Base::WarpBilinear(param)
+        {
+        }
+
+        void WarpBilinear::EstimateCoords(size_t y, int32_t * sx, int32_t * sy)
+        {
+            if (_param.perspective)
+            {
+                Base::WarpBilinear::EstimateCoords(y, sx, sy);
+                return;
+            }
+            const double * m = _param.inv;
+            int32_t x0 = Base::WarpRound(m[1] * y + m[2]), y0 = Base::WarpRound(m[4] * y + m[5]);
+            size_t dstW = _param.dstW, dstWF = AlignLo(dstW, F), x = 0;
+            __m256i _x0 = _mm256_set1_epi32(x0), _y0 = _mm256_set1_epi32(y0);
+            for (; x < dstWF; x += F)
+            {
+                _mm256_storeu_si256((__m256i*)(sx + x), _mm256_add_epi32(_x0, _mm256_loadu_si256((__m256i*)(_ax.data + x))));
+                _mm256_storeu_si256((__m256i*)(sy + x), _mm256_add_epi32(_y0, _mm256_loadu_si256((__m256i*)(_ay.data + x))));
+            }
+            for (; x < dstW; ++x)
+            {
+                sx[x] = x0 + _ax[x];
+                sy[x] = y0 + _ay[x];
+            }
+        }
+
+        void WarpBilinear::RunRow(const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst)
+        {
+            if (_param.type == SimdResizeChannelByte)
+            {
+                switch (_param.channels)
+                {
+                case 1: WarpRow<uint8_t, 1>(_param, src, srcStride, sx, sy, dst); break;
+                case 2: WarpRow<uint8_t, 2>(_param, src, srcStride, sx, sy, dst); break;
+                case 3: WarpRow<uint8_t, 3>(_param, src, srcStride, sx, sy, dst); break;
+                case 4: WarpRow<uint8_t, 4>(_param, src, srcStride, sx, sy, dst); break;
+                default: assert(0);
+                }
+            }
+            else
+            {
+                switch (_param.channels)
+                {
+                case 1: WarpRow<float, 1>(_param, src, srcStride, sx, sy, dst); break;
+                case 2: WarpRow<float, 2>(_param, src, srcStride, sx, sy, dst); break;
+                case 3: WarpRow<float, 3>(_param, src, srcStride, sx, sy, dst); break;
+                case 4: WarpRow<float, 4>(_param, src, srcStride, sx, sy, dst); break;
+                default: assert(0);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, false, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarpBilinear(param);
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, true, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarpBilinear(param);
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
@@ -23,7 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
-#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
 
 namespace Simd
 {
@@ -258,6 +258,256 @@ namespace Simd
             else
                 BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
+
+        template <class T, bool align, bool mask> SIMD_INLINE __m512i LoadAndConvertBgrToY16V2(const uint8_t * bgr, __m512i & b16_r16, __m512i & g16_1, const __mmask64 * ms)
+        {
+            __m512i _b16_r16[2], _g16_1[2];
+            LoadPreparedBgr16<align, mask>(bgr + 00, _b16_r16[0], _g16_1[0], ms + 0);
+            LoadPreparedBgr16<false, mask>(bgr + 48, _b16_r16[1], _g16_1[1], ms + 1);
+            b16_r16 = Hadd32(_b16_r16[0], _b16_r16[1]);
+            g16_1 = Hadd32(_g16_1[0], _g16_1[1]);
+            return Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::Y_LO), _mm512_packs_epi32(BgrToY32<T>(_b16_r16[0], _g16_1[0]), BgrToY32<T>(_b16_r16[1], _g16_1[1]))));
+        }
+
+        template <class T, bool align, bool mask> SIMD_INLINE __m512i LoadAndConvertBgrToY8V2(const uint8_t * bgr, __m512i b16_r16[2], __m512i g16_1[2], const __mmask64 * ms)
+        {
+            __m512i lo = LoadAndConvertBgrToY16V2<T, align, mask>(bgr + 00, b16_r16[0], g16_1[0], ms + 0);
+            __m512i hi = LoadAndConvertBgrToY16V2<T, false, mask>(bgr + 96, b16_r16[1], g16_1[1], ms + 2);
+            return Permuted2Pack16iTo8u(lo, hi);
+        }
+
+        template <class T> SIMD_INLINE __m512i ConvertY16V2(__m512i b16_r16[2], __m512i g16_1[2])
+        {
+            return Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::Y_LO), _mm512_packs_epi32(BgrToY32<T>(b16_r16[0], g16_1[0]), BgrToY32<T>(b16_r16[1], g16_1[1]))));
+        }
+
+        template <class T> SIMD_INLINE __m512i ConvertU16V2(__m512i b16_r16[2], __m512i g16_1[2])
+        {
+            return Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::UV_Z), _mm512_packs_epi32(BgrToU32<T>(b16_r16[0], g16_1[0]), BgrToU32<T>(b16_r16[1], g16_1[1]))));
+        }
+
+        template <class T> SIMD_INLINE __m512i ConvertV16V2(__m512i b16_r16[2], __m512i g16_1[2])
+        {
+            return Saturate16iTo8u(_mm512_add_epi16(_mm512_set1_epi16(T::UV_Z), _mm512_packs_epi32(BgrToV32<T>(b16_r16[0], g16_1[0]), BgrToV32<T>(b16_r16[1], g16_1[1]))));
+        }
+
+        template <class T, bool align, bool mask> SIMD_INLINE void BgrToYuv420pV2(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v, const __mmask64 * ms)
+        {
+            const uint8_t * bgr1 = bgr0 + bgrStride;
+            uint8_t * y1 = y0 + yStride;
+
+            __m512i _b16_r16[2][2][2], _g16_1[2][2][2];
+            Store<align, mask>(y0 + 0, LoadAndConvertBgrToY8V2<T, align, mask>(bgr0 + 0 * A, _b16_r16[0][0], _g16_1[0][0], ms + 0), ms[8]);
+            Store<align, mask>(y0 + A, LoadAndConvertBgrToY8V2<T, align, mask>(bgr0 + 3 * A, _b16_r16[0][1], _g16_1[0][1], ms + 4), ms[9]);
+            Store<align, mask>(y1 + 0, LoadAndConvertBgrToY8V2<T, align, mask>(bgr1 + 0 * A, _b16_r16[1][0], _g16_1[1][0], ms + 0), ms[8]);
+            Store<align, mask>(y1 + A, LoadAndConvertBgrToY8V2<T, align, mask>(bgr1 + 3 * A, _b16_r16[1][1], _g16_1[1][1], ms + 4), ms[9]);
+
+            Average16(_b16_r16[0][0][0], _b16_r16[1][0][0]);
+            Average16(_b16_r16[0][0][1], _b16_r16[1][0][1]);
+            Average16(_b16_r16[0][1][0], _b16_r16[1][1][0]);
+            Average16(_b16_r16[0][1][1], _b16_r16[1][1][1]);
+
+            Average16(_g16_1[0][0][0], _g16_1[1][0][0]);
+            Average16(_g16_1[0][0][1], _g16_1[1][0][1]);
+            Average16(_g16_1[0][1][0], _g16_1[1][1][0]);
+            Average16(_g16_1[0][1][1], _g16_1[1][1][1]);
+
+            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16V2<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertU16V2<T>(_b16_r16[0][1], _g16_1[0][1])), ms[10]);
+            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16V2<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertV16V2<T>(_b16_r16[0][1], _g16_1[0][1])), ms[10]);
+        }
+
+        template <class T, bool align> void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            width /= 2;
+            size_t alignedWidth = AlignLo(width - 1, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[11];
+            for (size_t i = 0; i < 8; ++i)
+                tailMasks[i] = TailMask64(tail * 6 - 48 * i) & 0x0000FFFFFFFFFFFF;
+            for (size_t i = 0; i < 2; ++i)
+                tailMasks[8 + i] = TailMask64(tail * 2 - A*i);
+            tailMasks[10] = TailMask64(tail);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BgrToYuv420pV2<T, align, false>(bgr + col * 6, bgrStride, y + col * 2, yStride, u + col, v + col, tailMasks);
+                if (col < width)
+                    BgrToYuv420pV2<T, align, true>(bgr + col * 6, bgrStride, y + col * 2, yStride, u + col, v + col, tailMasks);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <class T> void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToYuv420pV2<T, true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgrToYuv420pV2<T, false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv420pV2<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv420pV2<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv420pV2<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgrToYuv420pV2<Base::Trect871>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align, bool mask> SIMD_INLINE void BgrToYuv422pV2(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v, const __mmask64 * ms)
+        {
+            __m512i _b16_r16[2][2], _g16_1[2][2];
+            Store<align, mask>(y + 0, LoadAndConvertBgrToY8V2<T, align, mask>(bgr + 0 * A, _b16_r16[0], _g16_1[0], ms + 0), ms[8]);
+            Store<align, mask>(y + A, LoadAndConvertBgrToY8V2<T, align, mask>(bgr + 3 * A, _b16_r16[1], _g16_1[1], ms + 4), ms[9]);
+
+            Average16(_b16_r16);
+            Average16(_g16_1);
+
+            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16V2<T>(_b16_r16[0], _g16_1[0]), ConvertU16V2<T>(_b16_r16[1], _g16_1[1])), ms[10]);
+            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16V2<T>(_b16_r16[0], _g16_1[0]), ConvertV16V2<T>(_b16_r16[1], _g16_1[1])), ms[10]);
+        }
+
+        template <class T, bool align> void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert(width % 2 == 0);
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            width /= 2;
+            size_t alignedWidth = AlignLo(width - 1, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[11];
+            for (size_t i = 0; i < 8; ++i)
+                tailMasks[i] = TailMask64(tail * 6 - 48 * i) & 0x0000FFFFFFFFFFFF;
+            for (size_t i = 0; i < 2; ++i)
+                tailMasks[8 + i] = TailMask64(tail * 2 - A*i);
+            tailMasks[10] = TailMask64(tail);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BgrToYuv422pV2<T, align, false>(bgr + col * 6, y + col * 2, u + col, v + col, tailMasks);
+                if (col < width)
+                    BgrToYuv422pV2<T, align, true>(bgr + col * 6, y + col * 2, u + col, v + col, tailMasks);
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgr += bgrStride;
+            }
+        }
+
+        template <class T> void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToYuv422pV2<T, true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgrToYuv422pV2<T, false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv422pV2<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv422pV2<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv422pV2<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgrToYuv422pV2<Base::Trect871>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align, bool mask> SIMD_INLINE void BgrToYuv444pV2(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v, const __mmask64 * ms)
+        {
+            __m512i _b16_r16[2][2], _g16_1[2][2];
+            LoadPreparedBgr16<align, mask>(bgr + 0x00, _b16_r16[0][0], _g16_1[0][0], ms + 0);
+            LoadPreparedBgr16<false, mask>(bgr + 0x30, _b16_r16[0][1], _g16_1[0][1], ms + 1);
+            LoadPreparedBgr16<false, mask>(bgr + 0x60, _b16_r16[1][0], _g16_1[1][0], ms + 2);
+            LoadPreparedBgr16<false, mask>(bgr + 0x90, _b16_r16[1][1], _g16_1[1][1], ms + 3);
+
+            Store<align, mask>(y, Permuted2Pack16iTo8u(ConvertY16V2<T>(_b16_r16[0], _g16_1[0]), ConvertY16V2<T>(_b16_r16[1], _g16_1[1])), ms[4]);
+            Store<align, mask>(u, Permuted2Pack16iTo8u(ConvertU16V2<T>(_b16_r16[0], _g16_1[0]), ConvertU16V2<T>(_b16_r16[1], _g16_1[1])), ms[4]);
+            Store<align, mask>(v, Permuted2Pack16iTo8u(ConvertV16V2<T>(_b16_r16[0], _g16_1[0]), ConvertV16V2<T>(_b16_r16[1], _g16_1[1])), ms[4]);
+        }
+
+        template <class T, bool align> void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t alignedWidth = AlignLo(width - 1, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[5];
+            for (size_t i = 0; i < 4; ++i)
+                tailMasks[i] = TailMask64(tail * 3 - 48 * i) & 0x0000FFFFFFFFFFFF;
+            tailMasks[4] = TailMask64(tail);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BgrToYuv444pV2<T, align, false>(bgr + col * 3, y + col, u + col, v + col, tailMasks);
+                if (col < width)
+                    BgrToYuv444pV2<T, align, true>(bgr + col * 3, y + col, u + col, v + col, tailMasks);
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgr += bgrStride;
+            }
+        }
+
+        template <class T> void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToYuv444pV2<T, true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgrToYuv444pV2<T, false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv444pV2<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv444pV2<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv444pV2<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgrToYuv444pV2<Base::Trect871>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
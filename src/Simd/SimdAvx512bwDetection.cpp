@@ -184,6 +184,7 @@ namespace Simd
             typedef HidHaarCascade Hid;
             const float * leaves = hid.leaves.data();
             const Hid::Node * node = hid.nodes.data();
+            const Hid::Feature * feature = hid.features.data();
             const Hid::Stage * stages = hid.stages.data();
             for (int i = 0, n = (int)hid.stages.size(); i < n; ++i)
             {
@@ -194,24 +195,22 @@ namespace Simd
                 __m512 stageSum = _mm512_setzero_ps();
                 if (stage.hasThree)
                 {
-                    for (; node < end; ++node, leaves += 2)
+                    for (; node < end; ++node, ++feature, leaves += 2)
                     {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
                         __m512 sum = _mm512_add_ps(
-                            WeightedSum32f<masked>(feature.rect[0], offset, result),
-                            WeightedSum32f<masked>(feature.rect[1], offset, result));
-                        if (feature.rect[2].p0)
-                            sum = _mm512_add_ps(sum, WeightedSum32f<masked>(feature.rect[2], offset, result));
+                            WeightedSum32f<masked>(feature->rect[0], offset, result),
+                            WeightedSum32f<masked>(feature->rect[1], offset, result));
+                        if (feature->rect[2].p0)
+                            sum = _mm512_add_ps(sum, WeightedSum32f<masked>(feature->rect[2], offset, result));
                         StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                     }
                 }
                 else
                 {
-                    for (; node < end; ++node, leaves += 2)
+                    for (; node < end; ++node, ++feature, leaves += 2)
                     {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        __m512 sum = _mm512_add_ps(WeightedSum32f<masked>(feature.rect[0], offset, result),
-                            WeightedSum32f<masked>(feature.rect[1], offset, result));
+                        __m512 sum = _mm512_add_ps(WeightedSum32f<masked>(feature->rect[0], offset, result),
+                            WeightedSum32f<masked>(feature->rect[1], offset, result));
                         StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                     }
                 }
@@ -414,7 +413,6 @@ namespace Simd
             size_t subsetSize = (hid.ncategories + 31) / 32;
             const int * subsets = hid.subsets.data();
             const Hid::Leave * leaves = hid.leaves.data();
-            const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
             int nodeOffset = stages[startStage].first;
             int leafOffset = 2 * nodeOffset;
@@ -424,7 +422,7 @@ namespace Simd
                 __m512 sum = _mm512_setzero_ps();
                 for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
                 {
-                    const Hid::Feature & feature = hid.features[nodes[nodeOffset].featureIdx];
+                    const Hid::Feature & feature = hid.features[nodeOffset];
                     const int * subset = subsets + nodeOffset*subsetSize;
                     __mmask16 mask = LeafMask<masked>(feature, offset, subset, result);
                     sum = _mm512_add_ps(sum, _mm512_mask_blend_ps(mask, _mm512_set1_ps(leaves[leafOffset + 1]), _mm512_set1_ps(leaves[leafOffset + 0])));
@@ -614,7 +612,6 @@ namespace Simd
             size_t subsetSize = (hid.ncategories + 31) / 32;
             const int * subsets = hid.subsets.data();
             const Hid::Leave * leaves = hid.leaves.data();
-            const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
             int nodeOffset = 0, leafOffset = 0;
             for (int i_stage = 0, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
@@ -623,7 +620,7 @@ namespace Simd
                 __m512i sum = _mm512_setzero_si512();
                 for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
                 {
-                    const Hid::Feature & feature = hid.features[nodes[nodeOffset].featureIdx];
+                    const Hid::Feature & feature = hid.features[nodeOffset];
                     const int * subset = subsets + nodeOffset*subsetSize;
                     __mmask32 mask = LeafMask<masked>(feature, offset, subset, result);
                     sum = _mm512_add_epi16(sum, _mm512_mask_blend_epi16(mask, _mm512_set1_epi16(leaves[leafOffset + 1]), _mm512_set1_epi16(leaves[leafOffset + 0])));
@@ -499,6 +499,123 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Avx2::ResizerByteFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowY(const int16_t * const * src, const int16_t * alpha, size_t size, size_t offset, uint8_t * dst)
+        {
+            __m512i lo = _mm512_set1_epi32(Base::FILTER_ROUND_Y), hi = lo;
+            for (size_t k = 0; k < size; k += 2)
+            {
+                __m512i s0 = _mm512_loadu_si512((__m512i*)(src[k + 0] + offset));
+                __m512i s1 = _mm512_loadu_si512((__m512i*)(src[k + 1] + offset));
+                __m512i a = _mm512_set1_epi32(*(int32_t*)(alpha + k));
+                lo = _mm512_add_epi32(lo, _mm512_madd_epi16(_mm512_unpacklo_epi16(s0, s1), a));
+                hi = _mm512_add_epi32(hi, _mm512_madd_epi16(_mm512_unpackhi_epi16(s0, s1), a));
+            }
+            __m512i res = _mm512_packs_epi32(_mm512_srai_epi32(lo, Base::FILTER_SHIFT_Y), _mm512_srai_epi32(hi, Base::FILTER_SHIFT_Y));
+            res = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(res, res));
+            _mm256_storeu_si256((__m256i*)(dst + offset), _mm512_castsi512_si256(res));
+        }
+
+        void ResizerByteFilter::RunY(const int16_t * const * src, const int16_t * alpha, size_t size, uint8_t * dst)
+        {
+            if (size < HA)
+            {
+                Avx2::ResizerByteFilter::RunY(src, alpha, size, dst);
+                return;
+            }
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                ResizerByteFilterRowY(src, alpha, _sizeY, i, dst);
+            if (sizeHA < size)
+                ResizerByteFilterRowY(src, alpha, _sizeY, size - HA, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : Base::ResizerShortBilinear(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerShortRunX(const uint16_t * src, const int32_t * ix, const float * ax, size_t cn, float * dst, __mmask16 tail = -1)
+        {
+            __m512i idx = _mm512_maskz_loadu_epi32(tail, ix);
+            __m512i s0 = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail, idx, src, 2);
+            __m512i s1 = cn == 1 ? s0 : _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail, idx, src + cn - 1, 2);
+            __m512 fx1 = _mm512_maskz_loadu_ps(tail, ax);
+            __m512 fx0 = _mm512_sub_ps(_mm512_set1_ps(1.0f), fx1);
+            __m512 m0 = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_and_si512(s0, _mm512_set1_epi32(0xFFFF))), fx0);
+            __m512 m1 = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(s1, 16)), fx1);
+            _mm512_mask_storeu_ps(dst, tail, _mm512_add_ps(m0, m1));
+        }
+
+        void ResizerShortBilinear::RunX(const uint16_t * src, float * dst)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn, rsF = AlignLo(rs, F);
+            __mmask16 tail = TailMask16(rs - rsF);
+            size_t dx = 0;
+            for (; dx < rsF; dx += F)
+                ResizerShortRunX(src, _ix.data + dx, _ax.data + dx, cn, dst + dx);
+            if (dx < rs)
+                ResizerShortRunX(src, _ix.data + dx, _ax.data + dx, cn, dst + dx, tail);
+        }
+
+        SIMD_INLINE void ResizerShortRunY(const float * src0, const float * src1, __m512 fy0, __m512 fy1, uint16_t * dst, __mmask16 tail = -1)
+        {
+            __m512 m0 = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src0), fy0);
+            __m512 m1 = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src1), fy1);
+            _mm512_mask_cvtusepi32_storeu_epi16(dst, tail, _mm512_cvttps_epi32(_mm512_add_ps(_mm512_add_ps(m0, m1), _mm512_set1_ps(0.5f))));
+        }
+
+        void ResizerShortBilinear::RunY(const float * src0, const float * src1, float fy, uint16_t * dst)
+        {
+            size_t rs = _param.dstW * _param.channels, rsF = AlignLo(rs, F);
+            __mmask16 tail = TailMask16(rs - rsF);
+            __m512 _fy0 = _mm512_set1_ps(1.0f - fy), _fy1 = _mm512_set1_ps(fy);
+            size_t dx = 0;
+            for (; dx < rsF; dx += F)
+                ResizerShortRunY(src0 + dx, src1 + dx, _fy0, _fy1, dst + dx);
+            if (dx < rs)
+                ResizerShortRunY(src0 + dx, src1 + dx, _fy0, _fy1, dst + dx, tail);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : Base::ResizerShortArea(param)
+        {
+        }
+
+        template<UpdateType update, bool mask> SIMD_INLINE void ResizerShortAreaRowUpdate(const uint16_t * src, __m512 alpha, float * dst, __mmask16 tail = -1)
+        {
+            __m512i s = _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(tail, src));
+            Avx512f::Update<update, false, mask>(dst, _mm512_mul_ps(_mm512_cvtepi32_ps(s), alpha), tail);
+        }
+
+        template<UpdateType update> SIMD_INLINE void ResizerShortAreaRowUpdate(const uint16_t * src, size_t size, float a, float * dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __mmask16 tail = TailMask16(size - sizeF);
+            __m512 alpha = _mm512_set1_ps(a);
+            for (; i < sizeF; i += F)
+                ResizerShortAreaRowUpdate<update, false>(src + i, alpha, dst + i);
+            if (i < size)
+                ResizerShortAreaRowUpdate<update, true>(src + i, alpha, dst + i, tail);
+        }
+
+        void ResizerShortArea::RowSum(const uint16_t * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst)
+        {
+            ResizerShortAreaRowUpdate<UpdateSet>(src, size, count ? curr : curr - next, dst);
+            for (size_t i = 1; i <= count; ++i)
+                src += stride, ResizerShortAreaRowUpdate<UpdateAdd>(src, size, i < count ? zero : zero - next, dst);
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m512i));
@@ -506,9 +623,24 @@ namespace Simd
                 return new ResizerByteBilinear(param);
             else if (type == SimdResizeChannelByte && method == SimdResizeMethodArea)
                 return new ResizerByteArea(param);
+            else if (type == SimdResizeChannelShort && (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp))
+                return new ResizerShortBilinear(param);
+            else if (type == SimdResizeChannelShort && method == SimdResizeMethodArea)
+                return new ResizerShortArea(param);
+            else if (type == SimdResizeChannelByte && param.IsFilter())
+                return new ResizerByteFilter(param);
             else
                 return Avx512f::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m512i));
+            if (type == SimdResizeChannelByte && (method == SimdResizeMethodBilinear || param.IsFilter()))
+                return new ResizerByteFilter(param);
+            else
+                return Avx512f::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+        }
     }
 #endif //SIMD_AVX512BW_ENABLE 
 }
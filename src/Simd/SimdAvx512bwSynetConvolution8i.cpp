@@ -0,0 +1,177 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template<size_t M, size_t V> SIMD_INLINE void Gemm8iNN_MxV(size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc)
+        {
+            __m512i c[M][V];
+            for (size_t i = 0; i < M; ++i)
+                for (size_t v = 0; v < V; ++v)
+                    c[i][v] = _mm512_setzero_si512();
+            const __m512i ones = _mm512_set1_epi16(1);
+            for (size_t k = 0; k < K; k += 4)
+            {
+                __m512i b[V];
+                for (size_t v = 0; v < V; ++v)
+                    b[v] = _mm512_loadu_si512((__m512i*)B + v);
+                for (size_t i = 0; i < M; ++i)
+                {
+                    __m512i a = _mm512_set1_epi32(*(int32_t*)(A + i * lda + k));
+                    for (size_t v = 0; v < V; ++v)
+                        c[i][v] = _mm512_add_epi32(c[i][v], _mm512_madd_epi16(_mm512_maddubs_epi16(a, b[v]), ones));
+                }
+                B += ldb * 4;
+            }
+            for (size_t i = 0; i < M; ++i)
+                for (size_t v = 0; v < V; ++v)
+                    _mm512_storeu_si512((__m512i*)(C + i * ldc) + v, c[i][v]);
+        }
+
+        template<size_t V> void Gemm8iNN_V(size_t M, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc)
+        {
+            size_t M4 = AlignLo(M, 4), i = 0;
+            for (; i < M4; i += 4)
+                Gemm8iNN_MxV<4, V>(K, A + i * lda, lda, B, ldb, C + i * ldc, ldc);
+            switch (M - M4)
+            {
+            case 1: Gemm8iNN_MxV<1, V>(K, A + i * lda, lda, B, ldb, C + i * ldc, ldc); break;
+            case 2: Gemm8iNN_MxV<2, V>(K, A + i * lda, lda, B, ldb, C + i * ldc, ldc); break;
+            case 3: Gemm8iNN_MxV<3, V>(K, A + i * lda, lda, B, ldb, C + i * ldc, ldc); break;
+            }
+        }
+
+        void Gemm8iNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc)
+        {
+            assert(N % 16 == 0 && K % 4 == 0);
+            size_t N32 = AlignLo(N, 32), j = 0;
+            for (; j < N32; j += 32)
+                Gemm8iNN_V<2>(M, K, A, lda, B + j * 4, ldb, C + j, ldc);
+            if (j < N)
+                Gemm8iNN_V<1>(M, K, A, lda, B + j * 4, ldb, C + j, ldc);
+        }
+
+        template<::SimdConvolutionActivationType type> SIMD_INLINE __m512 Convert(const int32_t * src, const float * norm, const float * bias, const float * params, __m512 * _params)
+        {
+            if (type == ::SimdConvolutionActivationPrelu)
+                _params[0] = _mm512_loadu_ps(params);
+            __m512 value = _mm512_cvtepi32_ps(_mm512_loadu_si512((__m512i*)src));
+            return Avx512f::Activate<type>(_mm512_fmadd_ps(value, _mm512_loadu_ps(norm), _mm512_loadu_ps(bias)), _params, 0);
+        }
+
+        template<::SimdConvolutionActivationType type> void Convert8u(const int32_t * src, size_t M, size_t N, size_t ldS,
+            const float * norm, const float * bias, const float * params, const float * scale, const float * shift, uint8_t * dst, size_t ldD)
+        {
+            __m512 _params[2];
+            _params[0] = _mm512_set1_ps(params[0]);
+            _params[1] = _mm512_set1_ps(params[1]);
+            const __m512i upper = _mm512_set1_epi32(0xFF);
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; j += F)
+                {
+                    __mmask16 tail = Avx512f::TailMask16(N - j);
+                    __m512 value = Convert<type>(src + j, norm + j, bias + j, params + j, _params);
+                    __m512i i32 = _mm512_cvtps_epi32(_mm512_fmadd_ps(value, _mm512_loadu_ps(scale + j), _mm512_loadu_ps(shift + j)));
+                    i32 = _mm512_min_epi32(_mm512_max_epi32(i32, _mm512_setzero_si512()), upper);
+                    _mm512_mask_cvtepi32_storeu_epi8(dst + j, tail, i32);
+                }
+                src += ldS;
+                dst += ldD;
+            }
+        }
+
+        template<::SimdConvolutionActivationType type> void Convert32f(const int32_t * src, size_t M, size_t N, size_t ldS,
+            const float * norm, const float * bias, const float * params, const float * scale, const float * shift, uint8_t * dst, size_t ldD)
+        {
+            __m512 _params[2];
+            _params[0] = _mm512_set1_ps(params[0]);
+            _params[1] = _mm512_set1_ps(params[1]);
+            float * pDst = (float*)dst;
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; j += F)
+                {
+                    __mmask16 tail = Avx512f::TailMask16(N - j);
+                    _mm512_mask_storeu_ps(pDst + j, tail, Convert<type>(src + j, norm + j, bias + j, params + j, _params));
+                }
+                src += ldS;
+                pDst += ldD;
+            }
+        }
+
+        template<::SimdConvolutionActivationType type> Base::SynetConvolution8iGemmNN::ConvertPtr GetConvert(::SimdTensorDataType dstT)
+        {
+            return dstT == SimdTensorData8u ? Convert8u<type> : Convert32f<type>;
+        }
+
+        Base::SynetConvolution8iGemmNN::ConvertPtr GetConvert(::SimdConvolutionActivationType activation, ::SimdTensorDataType dstT)
+        {
+            switch (activation)
+            {
+            case ::SimdConvolutionActivationIdentity: return GetConvert<::SimdConvolutionActivationIdentity>(dstT);
+            case ::SimdConvolutionActivationRelu: return GetConvert<::SimdConvolutionActivationRelu>(dstT);
+            case ::SimdConvolutionActivationLeakyRelu: return GetConvert<::SimdConvolutionActivationLeakyRelu>(dstT);
+            case ::SimdConvolutionActivationRestrictRange: return GetConvert<::SimdConvolutionActivationRestrictRange>(dstT);
+            case ::SimdConvolutionActivationPrelu: return GetConvert<::SimdConvolutionActivationPrelu>(dstT);
+            case ::SimdConvolutionActivationElu: return GetConvert<::SimdConvolutionActivationElu>(dstT);
+            default: assert(0); return NULL;
+            }
+        }
+
+        SynetConvolution8iGemmNN::SynetConvolution8iGemmNN(const ConvParam8i & p)
+            : Avx2::SynetConvolution8iGemmNN(p)
+        {
+            _gemm = Avx512bw::Gemm8iNN;
+            _convert = Avx512bw::GetConvert(p.activation, p.dstT);
+        }
+
+        SynetConvolution8iDepthwise::SynetConvolution8iDepthwise(const ConvParam8i & p)
+            : Avx2::SynetConvolution8iDepthwise(p)
+        {
+            _convert = Avx512bw::GetConvert(p.activation, p.dstT);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv)
+        {
+            ConvParam8i param(batch, conv);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsDepthwise())
+                return new SynetConvolution8iDepthwise(param);
+            return new SynetConvolution8iGemmNN(param);
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
@@ -0,0 +1,120 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetImageToTensor.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        SynetImageToTensor::SynetImageToTensor(const ImgToTenParam & param)
+            : Avx2::SynetImageToTensor(param)
+        {
+            SetConverters(Avx512bw::BgraToBgr, Avx512bw::GrayToBgr, Avx512bw::BgrToGray,
+                Avx512bw::BgraToGray, Avx512bw::DeinterleaveUv, Avx512bw::Yuv420pToBgr);
+        }
+
+        template<bool mask> SIMD_INLINE void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, __m128i shift, __m512i last, size_t i, size_t n, float * dst, __mmask16 tail = -1)
+        {
+            __m512i index = _mm512_maskz_loadu_epi32(tail, ix + i);
+            if (_mm512_mask_cmpgt_epi32_mask(tail, index, last))
+            {
+                Avx2::SynetImageToTensorRowX(src, srcSize, ix + i, ax + i, dx, n, dst + i);
+                return;
+            }
+            __m512i value = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail, index, src, 1);
+            __m512 s0 = _mm512_cvtepi32_ps(_mm512_and_si512(value, K32_000000FF));
+            __m512 s1 = _mm512_cvtepi32_ps(_mm512_and_si512(_mm512_srl_epi32(value, shift), K32_000000FF));
+            __m512 alpha = Avx512f::Load<false, mask>(ax + i, tail);
+            Avx512f::Store<false, mask>(dst + i, _mm512_add_ps(s0, _mm512_mul_ps(_mm512_sub_ps(s1, s0), alpha)), tail);
+        }
+
+        void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst)
+        {
+            if (srcSize < 4 || dx > 3)
+            {
+                Avx2::SynetImageToTensorRowX(src, srcSize, ix, ax, dx, size, dst);
+                return;
+            }
+            __m128i shift = _mm_cvtsi32_si128(int(dx * 8));
+            __m512i last = _mm512_set1_epi32(int(srcSize - 4));
+            size_t sizeF = AlignLo(size, F);
+            __mmask16 tail = TailMask16(size - sizeF);
+            for (size_t i = 0; i < sizeF; i += F)
+                SynetImageToTensorRowX<false>(src, srcSize, ix, ax, dx, shift, last, i, F, dst);
+            if (sizeF < size)
+                SynetImageToTensorRowX<true>(src, srcSize, ix, ax, dx, shift, last, sizeF, size - sizeF, dst, tail);
+        }
+
+        void SynetImageToTensor::RunX(const uint8_t * src, float * dst)
+        {
+            SynetImageToTensorRowX(src, _rowSize, _ix.data, _ax.data, _dx, _size, dst);
+        }
+
+        template<bool mask> SIMD_INLINE void SynetImageToTensorRowY(const float * src0, const float * src1, __m512 alpha, const float * scale, const float * shift, size_t i, float * dst, __mmask16 tail = -1)
+        {
+            __m512 s0 = Avx512f::Load<false, mask>(src0 + i, tail);
+            __m512 s = _mm512_add_ps(s0, _mm512_mul_ps(_mm512_sub_ps(Avx512f::Load<false, mask>(src1 + i, tail), s0), alpha));
+            Avx512f::Store<false, mask>(dst + i, _mm512_add_ps(_mm512_mul_ps(s, Avx512f::Load<false, mask>(scale + i, tail)), Avx512f::Load<false, mask>(shift + i, tail)), tail);
+        }
+
+        void SynetImageToTensorRowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            __m512 _alpha = _mm512_set1_ps(alpha);
+            size_t sizeF = AlignLo(size, F);
+            __mmask16 tail = TailMask16(size - sizeF);
+            for (size_t i = 0; i < sizeF; i += F)
+                SynetImageToTensorRowY<false>(src0, src1, _alpha, scale, shift, i, dst);
+            if (sizeF < size)
+                SynetImageToTensorRowY<true>(src0, src1, _alpha, scale, shift, sizeF, dst, tail);
+        }
+
+        void SynetImageToTensor::RowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            SynetImageToTensorRowY(src0, src1, alpha, scale, shift, size, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat)
+        {
+            ImgToTenParam param(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+            if (!param.Valid())
+                return NULL;
+            return new SynetImageToTensor(param);
+        }
+
+        void * SynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale)
+        {
+            CropResParam param(channels, dstWidth, dstHeight, dstFormat, dstType, keepAspect, mean, scale);
+            if (!param.Valid())
+                return NULL;
+            return new Base::SynetCropResize(param, Avx512bw::SynetImageToTensorRowX, Avx512bw::SynetImageToTensorRowY);
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
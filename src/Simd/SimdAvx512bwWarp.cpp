@@ -0,0 +1,274 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdWarp.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        const __m512i K32_WARP_MASK = SIMD_MM512_SET1_EPI32(WARP_MASK);
+        const __m512i K32_WARP_RANGE = SIMD_MM512_SET1_EPI32(WARP_RANGE);
+        const __m512i K32_WARP_ROUND = SIMD_MM512_SET1_EPI32(WARP_ROUND);
+
+        SIMD_INLINE bool WarpInside(__m512i ix, __m512i iy, __m512i w, __m512i h)
+        {
+            __mmask16 inside = _mm512_cmpgt_epi32_mask(ix, K_INV_ZERO) & _mm512_cmpgt_epi32_mask(w, ix);
+            inside = inside & _mm512_cmpgt_epi32_mask(iy, K_INV_ZERO) & _mm512_cmpgt_epi32_mask(h, iy);
+            return inside == 0xFFFF;
+        }
+
+        SIMD_INLINE __m512i WarpChannel(__m512i pixel, size_t channel)
+        {
+            return _mm512_and_si512(_mm512_srli_epi32(pixel, int(8 * channel)), K32_000000FF);
+        }
+
+        SIMD_INLINE __m512i WarpInterpolate(__m512i p00, __m512i p01, __m512i p10, __m512i p11, __m512i kx0, __m512i kx1, __m512i ky0, __m512i ky1)
+        {
+            __m512i t0 = _mm512_add_epi32(_mm512_mullo_epi32(p00, kx0), _mm512_mullo_epi32(p01, kx1));
+            __m512i t1 = _mm512_add_epi32(_mm512_mullo_epi32(p10, kx0), _mm512_mullo_epi32(p11, kx1));
+            __m512i sum = _mm512_add_epi32(_mm512_mullo_epi32(t0, ky0), _mm512_mullo_epi32(t1, ky1));
+            return _mm512_srli_epi32(_mm512_add_epi32(sum, K32_WARP_ROUND), 2 * WARP_SHIFT);
+        }
+
+        template<size_t N> SIMD_INLINE void WarpStore(__m512i value, uint8_t * dst);
+
+        template<> SIMD_INLINE void WarpStore<1>(__m512i value, uint8_t * dst)
+        {
+            _mm_storeu_si128((__m128i*)dst, _mm512_cvtepi32_epi8(value));
+        }
+
+        template<> SIMD_INLINE void WarpStore<2>(__m512i value, uint8_t * dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst, _mm512_cvtepi32_epi16(value));
+        }
+
+        const __m512i K8_WARP_SHUFFLE_3 = SIMD_MM512_SETR_EPI8(
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+        template<> SIMD_INLINE void WarpStore<3>(__m512i value, uint8_t * dst)
+        {
+            value = _mm512_shuffle_epi8(value, K8_WARP_SHUFFLE_3);
+            _mm_mask_storeu_epi8(dst + 0x00, 0x0FFF, _mm512_extracti32x4_epi32(value, 0));
+            _mm_mask_storeu_epi8(dst + 0x0C, 0x0FFF, _mm512_extracti32x4_epi32(value, 1));
+            _mm_mask_storeu_epi8(dst + 0x18, 0x0FFF, _mm512_extracti32x4_epi32(value, 2));
+            _mm_mask_storeu_epi8(dst + 0x24, 0x0FFF, _mm512_extracti32x4_epi32(value, 3));
+        }
+
+        template<> SIMD_INLINE void WarpStore<4>(__m512i value, uint8_t * dst)
+        {
+            _mm512_storeu_si512(dst, value);
+        }
+
+        template<size_t N> SIMD_INLINE void WarpByte(const uint8_t * src, size_t stride, __m512i offs, __m512i fx, __m512i fy, uint8_t * dst)
+        {
+            __m512i kx0 = _mm512_sub_epi32(K32_WARP_RANGE, fx), ky0 = _mm512_sub_epi32(K32_WARP_RANGE, fy);
+            const uint8_t * s0 = src, * s1 = src + stride;
+            __m512i value = _mm512_setzero_si512();
+            if (N == 4)
+            {
+                __m512i p00 = _mm512_i32gather_epi32(offs, s0, 1);
+                __m512i p01 = _mm512_i32gather_epi32(offs, s0 + 4, 1);
+                __m512i p10 = _mm512_i32gather_epi32(offs, s1, 1);
+                __m512i p11 = _mm512_i32gather_epi32(offs, s1 + 4, 1);
+                for (size_t c = 0; c < N; ++c)
+                {
+                    __m512i r = WarpInterpolate(WarpChannel(p00, c), WarpChannel(p01, c), WarpChannel(p10, c), WarpChannel(p11, c), kx0, fx, ky0, fy);
+                    value = _mm512_or_si512(value, _mm512_slli_epi32(r, int(8 * c)));
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < N; ++c)
+                {
+                    __m512i p00 = _mm512_and_si512(_mm512_i32gather_epi32(offs, s0 + c, 1), K32_000000FF);
+                    __m512i p01 = _mm512_and_si512(_mm512_i32gather_epi32(offs, s0 + c + N, 1), K32_000000FF);
+                    __m512i p10 = _mm512_srli_epi32(_mm512_i32gather_epi32(offs, s1 + c - 3, 1), 24);
+                    __m512i p11 = _mm512_srli_epi32(_mm512_i32gather_epi32(offs, s1 + c + N - 3, 1), 24);
+                    __m512i r = WarpInterpolate(p00, p01, p10, p11, kx0, fx, ky0, fy);
+                    value = _mm512_or_si512(value, _mm512_slli_epi32(r, int(8 * c)));
+                }
+            }
+            WarpStore<N>(value, dst);
+        }
+
+        const __m512i K32_WARP_INTERLEAVE_0 = SIMD_MM512_SETR_EPI32(0x00, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x13, 0x04, 0x05, 0x06, 0x07, 0x14, 0x15, 0x16, 0x17);
+        const __m512i K32_WARP_INTERLEAVE_1 = SIMD_MM512_SETR_EPI32(0x08, 0x09, 0x0A, 0x0B, 0x18, 0x19, 0x1A, 0x1B, 0x0C, 0x0D, 0x0E, 0x0F, 0x1C, 0x1D, 0x1E, 0x1F);
+
+        template<size_t N> SIMD_INLINE void WarpFloat(const uint8_t * src, size_t stride, __m512i offs, __m512i fx, __m512i fy, float * dst)
+        {
+            __m512 kx1 = _mm512_mul_ps(_mm512_cvtepi32_ps(fx), _mm512_set1_ps(1.0f / WARP_RANGE)), kx0 = _mm512_sub_ps(_mm512_set1_ps(1.0f), kx1);
+            __m512 ky1 = _mm512_mul_ps(_mm512_cvtepi32_ps(fy), _mm512_set1_ps(1.0f / WARP_RANGE)), ky0 = _mm512_sub_ps(_mm512_set1_ps(1.0f), ky1);
+            const uint8_t * s0 = src, * s1 = src + stride;
+            __m512 r[4];
+            for (size_t c = 0; c < N; ++c)
+            {
+                size_t c0 = c * 4, c1 = (c + N) * 4;
+                __m512 t0 = _mm512_add_ps(_mm512_mul_ps(_mm512_i32gather_ps(offs, s0 + c0, 1), kx0), _mm512_mul_ps(_mm512_i32gather_ps(offs, s0 + c1, 1), kx1));
+                __m512 t1 = _mm512_add_ps(_mm512_mul_ps(_mm512_i32gather_ps(offs, s1 + c0, 1), kx0), _mm512_mul_ps(_mm512_i32gather_ps(offs, s1 + c1, 1), kx1));
+                r[c] = _mm512_add_ps(_mm512_mul_ps(t0, ky0), _mm512_mul_ps(t1, ky1));
+            }
+            if (N == 1)
+                _mm512_storeu_ps(dst, r[0]);
+            else if (N == 2)
+            {
+                __m512 lo = _mm512_unpacklo_ps(r[0], r[1]), hi = _mm512_unpackhi_ps(r[0], r[1]);
+                _mm512_storeu_ps(dst + 0, _mm512_permutex2var_ps(lo, K32_WARP_INTERLEAVE_0, hi));
+                _mm512_storeu_ps(dst + F, _mm512_permutex2var_ps(lo, K32_WARP_INTERLEAVE_1, hi));
+            }
+            else
+            {
+                SIMD_ALIGNED(64) float buf[4][F];
+                for (size_t c = 0; c < N; ++c)
+                    _mm512_store_ps(buf[c], r[c]);
+                if (N == 4)
+                {
+                    for (size_t i = 0; i < F; i += 4)
+                    {
+                        __m128 v0 = _mm_load_ps(buf[0] + i), v1 = _mm_load_ps(buf[1] + i), v2 = _mm_load_ps(buf[2] + i), v3 = _mm_load_ps(buf[3] + i);
+                        _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+                        _mm_storeu_ps(dst + 4 * i + 0, v0);
+                        _mm_storeu_ps(dst + 4 * i + 4, v1);
+                        _mm_storeu_ps(dst + 4 * i + 8, v2);
+                        _mm_storeu_ps(dst + 4 * i + 12, v3);
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < F; ++i)
+                        for (size_t c = 0; c < N; ++c)
+                            dst[i * N + c] = buf[c][i];
+                }
+            }
+        }
+
+        template<class T, size_t N> void WarpRow(const WarpParam & p, const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst)
+        {
+            size_t dstW = p.dstW, dstWF = srcStride >= 4 ? AlignLo(dstW, F) : 0, x = 0;
+            __m512i w = _mm512_set1_epi32((int32_t)p.srcW - 1), h = _mm512_set1_epi32((int32_t)p.srcH - 1);
+            __m512i stride = _mm512_set1_epi32((int32_t)srcStride), size = _mm512_set1_epi32(int32_t(N * sizeof(T)));
+            for (; x < dstWF; x += F)
+            {
+                __m512i fx = _mm512_loadu_si512(sx + x);
+                __m512i fy = _mm512_loadu_si512(sy + x);
+                __m512i ix = _mm512_srai_epi32(fx, WARP_SHIFT);
+                __m512i iy = _mm512_srai_epi32(fy, WARP_SHIFT);
+                if (!WarpInside(ix, iy, w, h))
+                {
+                    Base::WarpRow<T, N>(p, src, srcStride, sx, sy, x, x + F, dst);
+                    continue;
+                }
+                __m512i offs = _mm512_add_epi32(_mm512_mullo_epi32(iy, stride), _mm512_mullo_epi32(ix, size));
+                fx = _mm512_and_si512(fx, K32_WARP_MASK);
+                fy = _mm512_and_si512(fy, K32_WARP_MASK);
+                if (sizeof(T) == 1)
+                    WarpByte<N>(src, srcStride, offs, fx, fy, dst + x * N);
+                else
+                    WarpFloat<N>(src, srcStride, offs, fx, fy, (float*)dst + x * N);
+            }
+            Base::WarpRow<T, N>(p, src, srcStride, sx, sy, x, dstW, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpBilinear::WarpBilinear(const WarpParam & param)
+            : Base::WarpBilinear(param)
+        {
+        }
+
+        void WarpBilinear::EstimateCoords(size_t y, int32_t * sx, int32_t * sy)
+        {
+            if (_param.perspective)
+            {
+                Base::WarpBilinear::EstimateCoords(y, sx, sy);
+                return;
+            }
+            const double * m = _param.inv;
+            int32_t x0 = Base::WarpRound(m[1] * y + m[2]), y0 = Base::WarpRound(m[4] * y + m[5]);
+            size_t dstW = _param.dstW, dstWF = AlignLo(dstW, F), x = 0;
+            __m512i _x0 = _mm512_set1_epi32(x0), _y0 = _mm512_set1_epi32(y0);
+            for (; x < dstWF; x += F)
+            {
+                _mm512_storeu_si512(sx + x, _mm512_add_epi32(_x0, _mm512_loadu_si512(_ax.data + x)));
+                _mm512_storeu_si512(sy + x, _mm512_add_epi32(_y0, _mm512_loadu_si512(_ay.data + x)));
+            }
+            if (x < dstW)
+            {
+                __mmask16 tail = TailMask16(dstW - x);
+                _mm512_mask_storeu_epi32(sx + x, tail, _mm512_add_epi32(_x0, _mm512_maskz_loadu_epi32(tail, _ax.data + x)));
+                _mm512_mask_storeu_epi32(sy + x, tail, _mm512_add_epi32(_y0, _mm512_maskz_loadu_epi32(tail, _ay.data + x)));
+            }
+        }
+
+        void WarpBilinear::RunRow(const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst)
+        {
+            if (_param.type == SimdResizeChannelByte)
+            {
+                switch (_param.channels)
+                {
+                case 1: WarpRow<uint8_t, 1>(_param, src, srcStride, sx, sy, dst); break;
+                case 2: WarpRow<uint8_t, 2>(_param, src, srcStride, sx, sy, dst); break;
+                case 3: WarpRow<uint8_t, 3>(_param, src, srcStride, sx, sy, dst); break;
+                case 4: WarpRow<uint8_t, 4>(_param, src, srcStride, sx, sy, dst); break;
+                default: assert(0);
+                }
+            }
+            else
+            {
+                switch (_param.channels)
+                {
+                case 1: WarpRow<float, 1>(_param, src, srcStride, sx, sy, dst); break;
+                case 2: WarpRow<float, 2>(_param, src, srcStride, sx, sy, dst); break;
+                case 3: WarpRow<float, 3>(_param, src, srcStride, sx, sy, dst); break;
+                case 4: WarpRow<float, 4>(_param, src, srcStride, sx, sy, dst); break;
+                default: assert(0);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, false, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarpBilinear(param);
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, true, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarpBilinear(param);
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
@@ -2237,6 +2237,24 @@ namespace Simd
             ConvParam32f param(batch, conv, gemm);
             if (!param.Valid())
                 return NULL;
+            else if (Base::GetTuningMode())
+            {
+                SynetConvolution32fTuned::Candidates candidates;
+                if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+                    candidates.push_back(new Avx::SynetConvolution32fDepthwiseDotProduct(param));
+                if (SynetConvolution32fWinograd::Applicable(param))
+                    candidates.push_back(new SynetConvolution32fWinograd(param));
+                if (SynetConvolution32fGemmNT::Applicable(param))
+                    candidates.push_back(new SynetConvolution32fGemmNT(param));
+                if (SynetConvolution32fDirectNchw::Preferable(param))
+                    candidates.push_back(new Avx512f::SynetConvolution32fDirectNchw(param));
+                if (SynetConvolution32fNhwcDirect::Preferable(param))
+                    candidates.push_back(new SynetConvolution32fNhwcDirect(param));
+                if (SynetConvolution32fDirectNhwc::Applicable(param))
+                    candidates.push_back(new SynetConvolution32fDirectNhwc(param));
+                candidates.push_back(new SynetConvolution32fGemmNN(param));
+                return SynetConvolution32fTuned::Create(param, candidates);
+            }
             else if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new Avx::SynetConvolution32fDepthwiseDotProduct(param);
             else if (SynetConvolution32fWinograd::Preferable(param))
@@ -28,6 +28,7 @@
 #include <thread>
 #include <sstream>
 #include <iostream>
+#include <string.h>
 
 #ifdef __GNUC__
 #include <unistd.h>
@@ -135,5 +136,40 @@ namespace Simd
 #else
 #error This platform is unsupported!
 #endif
+
+        std::string CpuModel()
+        {
+            std::string model;
+#if defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
+            unsigned int registers[12] = { 0 };
+#if defined(_MSC_VER)
+            int max[4];
+            __cpuid(max, 0x80000000);
+            if ((unsigned int)max[0] >= 0x80000004)
+            {
+                for (int i = 0; i < 3; ++i)
+                    __cpuid((int*)registers + 4 * i, 0x80000002 + i);
+            }
+#else
+            if (__get_cpuid_max(0x80000000, NULL) >= 0x80000004)
+            {
+                for (unsigned int i = 0; i < 3; ++i)
+                    __cpuid(0x80000002 + i, registers[4 * i + 0], registers[4 * i + 1], registers[4 * i + 2], registers[4 * i + 3]);
+            }
+#endif
+            model.assign((char*)registers, strnlen((char*)registers, sizeof(registers)));
+#elif defined(__GNUC__)
+            ::FILE * p = ::popen("grep -m 1 -E '^(model name|Hardware|CPU part)' /proc/cpuinfo | cut -d ':' -f 2", "r");
+            if (p)
+            {
+                char buffer[PATH_MAX] = { 0 };
+                if (::fgets(buffer, PATH_MAX, p))
+                    model = buffer;
+                ::pclose(p);
+            }
+#endif
+            size_t beg = model.find_first_not_of(" \t\n"), end = model.find_last_not_of(" \t\n");
+            return beg == std::string::npos ? std::string("unknown") : model.substr(beg, end - beg + 1);
+        }
     }
 }
@@ -29,6 +29,7 @@
 #include <stdexcept>
 #include <iostream>
 #include <sstream>
+#include <fstream>
 
 #define SIMD_EX(message) \
 { \
@@ -332,6 +333,224 @@ namespace Simd
             }
         }
 
+        namespace Binary
+        {
+            const uint32_t MAGIC = 0x43444D53; // "SMDC"
+            const uint32_t VERSION = 1;
+            const size_t ALIGN = 64;
+            const size_t ARRAYS = 7;
+
+            struct Header
+            {
+                uint32_t magic, version, headerSize, align;
+                uint32_t recordSize[ARRAYS];
+                int32_t featureType, ncategories, width, height;
+                uint8_t isStumpBased, hasTilted, canInt16, reserved;
+                uint64_t count[ARRAYS];
+            };
+
+            SIMD_INLINE void SetRecordSizes(Header & header)
+            {
+                header.recordSize[0] = sizeof(Data::Stage);
+                header.recordSize[1] = sizeof(Data::DTree);
+                header.recordSize[2] = sizeof(Data::DTreeNode);
+                header.recordSize[3] = sizeof(float);
+                header.recordSize[4] = sizeof(int);
+                header.recordSize[5] = sizeof(Data::HaarFeature);
+                header.recordSize[6] = sizeof(Data::LbpFeature);
+            }
+
+            template<class T> void Write(std::ofstream & ofs, const std::vector<T> & array)
+            {
+                static const char zero[ALIGN] = { 0 };
+                size_t pos = (size_t)ofs.tellp();
+                ofs.write(zero, AlignHi(pos, ALIGN) - pos);
+                if (array.size())
+                    ofs.write((const char*)array.data(), array.size() * sizeof(T));
+            }
+
+            template<class T> void Read(const std::vector<char> & blob, size_t & offset, uint64_t count, std::vector<T> & array)
+            {
+                offset = AlignHi(offset, ALIGN);
+                if (offset > blob.size() || count > (blob.size() - offset) / sizeof(T))
+                    SIMD_EX("Binary cascade is truncated!");
+                array.resize((size_t)count);
+                if (count)
+                    memcpy(array.data(), blob.data() + offset, (size_t)count * sizeof(T));
+                offset += (size_t)count * sizeof(T);
+            }
+
+            SIMD_INLINE bool Inside(int64_t left, int64_t top, int64_t right, int64_t bottom, const Size & size)
+            {
+                return left >= 0 && top >= 0 && right <= size.x && bottom <= size.y;
+            }
+
+            SIMD_INLINE bool Valid(const Data::HaarFeature & feature, const Size & size)
+            {
+                for (int i = 0; i < Data::HaarFeature::RECT_NUM; ++i)
+                {
+                    const Data::Rect & r = feature.rect[i].r;
+                    if (r.x == 0 && r.y == 0 && r.width == 0 && r.height == 0)
+                        continue;
+                    if (r.width < 0 || r.height < 0)
+                        return false;
+                    if (feature.tilted)
+                    {
+                        if (!Inside((int64_t)r.x - r.height, r.y, (int64_t)r.x + r.width, (int64_t)r.y + r.width + r.height, size))
+                            return false;
+                    }
+                    else
+                    {
+                        if (!Inside(r.x, r.y, (int64_t)r.x + r.width, (int64_t)r.y + r.height, size))
+                            return false;
+                    }
+                }
+                return true;
+            }
+
+            SIMD_INLINE bool Valid(const Data::LbpFeature & feature, const Size & size)
+            {
+                const Data::Rect & r = feature.rect;
+                return r.width > 0 && r.height > 0 && Inside(r.x, r.y, (int64_t)r.x + 3 * r.width, (int64_t)r.y + 3 * r.height, size);
+            }
+        }
+
+        bool DetectionSaveBinary(const void * _data, const char * path)
+        {
+            const Data * data = (const Data*)_data;
+            if (data == NULL)
+                return false;
+
+            std::ofstream ofs(path, std::ofstream::binary);
+            if (!ofs.is_open())
+                return false;
+
+            Binary::Header header;
+            memset(&header, 0, sizeof(header));
+            header.magic = Binary::MAGIC;
+            header.version = Binary::VERSION;
+            header.headerSize = sizeof(Binary::Header);
+            header.align = Binary::ALIGN;
+            Binary::SetRecordSizes(header);
+            header.featureType = data->featureType;
+            header.ncategories = data->ncategories;
+            header.width = (int32_t)data->origWinSize.x;
+            header.height = (int32_t)data->origWinSize.y;
+            header.isStumpBased = data->isStumpBased ? 1 : 0;
+            header.hasTilted = data->hasTilted ? 1 : 0;
+            header.canInt16 = data->canInt16 ? 1 : 0;
+            header.count[0] = data->stages.size();
+            header.count[1] = data->classifiers.size();
+            header.count[2] = data->nodes.size();
+            header.count[3] = data->leaves.size();
+            header.count[4] = data->subsets.size();
+            header.count[5] = data->haarFeatures.size();
+            header.count[6] = data->lbpFeatures.size();
+            ofs.write((const char*)&header, sizeof(header));
+
+            Binary::Write(ofs, data->stages);
+            Binary::Write(ofs, data->classifiers);
+            Binary::Write(ofs, data->nodes);
+            Binary::Write(ofs, data->leaves);
+            Binary::Write(ofs, data->subsets);
+            Binary::Write(ofs, data->haarFeatures);
+            Binary::Write(ofs, data->lbpFeatures);
+
+            return ofs.good();
+        }
+
+        void * DetectionLoadBinary(const char * path)
+        {
+            Data * data = NULL;
+            try
+            {
+                std::ifstream ifs(path, std::ifstream::binary);
+                if (!ifs.is_open())
+                    SIMD_EX("Can't open binary cascade '" << path << "'!");
+                ifs.seekg(0, std::ios::end);
+                std::vector<char> blob((size_t)ifs.tellg());
+                ifs.seekg(0, std::ios::beg);
+                ifs.read(blob.data(), blob.size());
+                if (!ifs)
+                    SIMD_EX("Can't read binary cascade '" << path << "'!");
+
+                Binary::Header header, reference;
+                if (blob.size() < sizeof(header))
+                    SIMD_EX("Invalid format of binary cascade '" << path << "'!");
+                memcpy(&header, blob.data(), sizeof(header));
+                Binary::SetRecordSizes(reference);
+                if (header.magic != Binary::MAGIC || header.headerSize != sizeof(header) || header.align != Binary::ALIGN)
+                    SIMD_EX("Invalid format of binary cascade '" << path << "'!");
+                if (header.version != Binary::VERSION || memcmp(header.recordSize, reference.recordSize, sizeof(reference.recordSize)))
+                    SIMD_EX("Incompatible version of binary cascade '" << path << "'!");
+                if (header.featureType != SimdDetectionInfoFeatureHaar && header.featureType != SimdDetectionInfoFeatureLbp)
+                    SIMD_EX("Invalid cascade feature type!");
+                if (header.width <= 0 || header.height <= 0)
+                    SIMD_EX("Invalid cascade width or height!");
+                if (!header.isStumpBased)
+                    SIMD_EX("Tree classifier cascades are not supported!");
+
+                data = new Data();
+                data->stageType = 0;
+                data->featureType = (SimdDetectionInfoFlags)header.featureType;
+                data->ncategories = header.ncategories;
+                data->origWinSize.x = header.width;
+                data->origWinSize.y = header.height;
+                data->isStumpBased = header.isStumpBased != 0;
+                data->hasTilted = header.hasTilted != 0;
+                data->canInt16 = header.canInt16 != 0;
+
+                size_t offset = sizeof(header);
+                Binary::Read(blob, offset, header.count[0], data->stages);
+                Binary::Read(blob, offset, header.count[1], data->classifiers);
+                Binary::Read(blob, offset, header.count[2], data->nodes);
+                Binary::Read(blob, offset, header.count[3], data->leaves);
+                Binary::Read(blob, offset, header.count[4], data->subsets);
+                Binary::Read(blob, offset, header.count[5], data->haarFeatures);
+                Binary::Read(blob, offset, header.count[6], data->lbpFeatures);
+
+                int nodes = (int)data->nodes.size();
+                size_t features = data->featureType == SimdDetectionInfoFeatureHaar ? data->haarFeatures.size() : data->lbpFeatures.size();
+                size_t subsetSize = data->featureType == SimdDetectionInfoFeatureLbp ? (data->ncategories + 31) / 32 : 0;
+                if (data->classifiers.size() != data->nodes.size() || data->leaves.size() != 2 * data->nodes.size() ||
+                    data->subsets.size() != subsetSize * data->nodes.size())
+                    SIMD_EX("Invalid binary cascade '" << path << "'!");
+                for (size_t i = 0; i < data->stages.size(); ++i)
+                {
+                    const Data::Stage & stage = data->stages[i];
+                    if (stage.first < 0 || stage.ntrees < 0 || stage.first > nodes - stage.ntrees)
+                        SIMD_EX("Invalid binary cascade '" << path << "'!");
+                }
+                for (size_t i = 0; i < data->nodes.size(); ++i)
+                {
+                    if (data->nodes[i].featureIdx < 0 || (size_t)data->nodes[i].featureIdx >= features)
+                        SIMD_EX("Invalid binary cascade '" << path << "'!");
+                }
+                for (size_t i = 0; i < data->classifiers.size(); ++i)
+                {
+                    if (data->classifiers[i].nodeCount != 1)
+                        SIMD_EX("Invalid binary cascade '" << path << "'!");
+                }
+                for (size_t i = 0; i < data->haarFeatures.size(); ++i)
+                {
+                    if (!Binary::Valid(data->haarFeatures[i], data->origWinSize))
+                        SIMD_EX("Invalid binary cascade '" << path << "'!");
+                }
+                for (size_t i = 0; i < data->lbpFeatures.size(); ++i)
+                {
+                    if (!Binary::Valid(data->lbpFeatures[i], data->origWinSize))
+                        SIMD_EX("Invalid binary cascade '" << path << "'!");
+                }
+            }
+            catch (...)
+            {
+                delete data;
+                data = NULL;
+            }
+
+            return data;
+        }
+
         HidHaarCascade * CreateHidHaar(const Data & data)
         {
             if (data.featureType != SimdDetectionInfoFeatureHaar)
@@ -350,7 +569,6 @@ namespace Simd
             hid->nodes.resize(data.nodes.size());
             for (size_t i = 0; i < data.nodes.size(); ++i)
             {
-                hid->nodes[i].featureIdx = data.nodes[i].featureIdx;
                 hid->nodes[i].left = data.nodes[i].left;
                 hid->nodes[i].right = data.nodes[i].right;
                 hid->nodes[i].threshold = data.nodes[i].threshold;
@@ -373,12 +591,13 @@ namespace Simd
                 }
             }
 
-            hid->features.resize(data.haarFeatures.size());
+            hid->features.resize(data.nodes.size());
             for (size_t i = 0; i < hid->features.size(); ++i)
             {
+                const Data::HaarFeature & feature = data.haarFeatures[data.nodes[i].featureIdx];
                 for (int j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
-                    hid->features[i].rect[j].weight = data.haarFeatures[i].rect[j].weight;
-                if (data.haarFeatures[i].tilted)
+                    hid->features[i].rect[j].weight = feature.rect[j].weight;
+                if (feature.tilted)
                     hid->hasTilted = true;
             }
 
@@ -427,7 +646,7 @@ namespace Simd
             Image tilted = hid->isThroughColumn ? hid->itilted : hid->tilted;
             for (size_t i = 0; i < hid->features.size(); i++)
             {
-                const Data::HaarFeature & df = data.haarFeatures[i];
+                const Data::HaarFeature & df = data.haarFeatures[data.nodes[i].featureIdx];
                 HidHaarCascade::Feature & hf = hid->features[i];
                 for (int j = 0; j < Data::HaarFeature::RECT_NUM; ++j)
                 {
@@ -540,7 +759,6 @@ namespace Simd
             hid->nodes.resize(data.nodes.size());
             for (size_t i = 0; i < data.nodes.size(); ++i)
             {
-                hid->nodes[i].featureIdx = data.nodes[i].featureIdx;
                 hid->nodes[i].left = data.nodes[i].left;
                 hid->nodes[i].right = data.nodes[i].right;
             }
@@ -558,13 +776,14 @@ namespace Simd
                 hid->subsets[i] = data.subsets[i];
             }
 
-            hid->features.resize(data.lbpFeatures.size());
+            hid->features.resize(data.nodes.size());
             for (size_t i = 0; i < hid->features.size(); ++i)
             {
-                hid->features[i].rect.left = data.lbpFeatures[i].rect.x;
-                hid->features[i].rect.top = data.lbpFeatures[i].rect.y;
-                hid->features[i].rect.right = data.lbpFeatures[i].rect.x + data.lbpFeatures[i].rect.width;
-                hid->features[i].rect.bottom = data.lbpFeatures[i].rect.y + data.lbpFeatures[i].rect.height;
+                const Data::Rect & rect = data.lbpFeatures[data.nodes[i].featureIdx].rect;
+                hid->features[i].rect.left = rect.x;
+                hid->features[i].rect.top = rect.y;
+                hid->features[i].rect.right = rect.x + rect.width;
+                hid->features[i].rect.bottom = rect.y + rect.height;
             }
 
             return hid;
@@ -634,80 +853,88 @@ namespace Simd
             }
         }
 
-        void PrepareThroughColumn32i(const Image & src, Image & dst)
+        void PrepareThroughColumn32i(const Image & src, Image & dst, const Rect & region)
         {
             assert(Simd::Compatible(src, dst) && src.format == Image::Int32);
 
-            for (size_t row = 0; row < src.height; ++row)
+            Rect rect = region.Intersection(Rect(src.Size()));
+            for (ptrdiff_t row = rect.top; row < rect.bottom; ++row)
             {
                 const uint32_t * s = &src.At<uint32_t>(0, row);
 
                 uint32_t * evenDst = &dst.At<uint32_t>(0, row);
-                for (size_t col = 0; col < src.width; col += 2)
+                for (ptrdiff_t col = rect.left + (rect.left & 1); col < rect.right; col += 2)
                     evenDst[col >> 1] = s[col];
 
                 uint32_t * oddDst = &dst.At<uint32_t>((dst.width + 1) >> 1, row);
-                for (size_t col = 1; col < src.width; col += 2)
+                for (ptrdiff_t col = rect.left | 1; col < rect.right; col += 2)
                     oddDst[col >> 1] = s[col];
             }
         }
 
-        void Prepare16i(const Image & src, bool throughColumn, Image & dst)
+        void Prepare16i(const Image & src, bool throughColumn, Image & dst, const Rect & region)
         {
             assert(Simd::EqualSize(src, dst) && src.format == Image::Int32 && dst.format == Image::Int16);
 
+            Rect rect = region.Intersection(Rect(src.Size()));
             if (throughColumn)
             {
-                for (size_t row = 0; row < src.height; ++row)
+                for (ptrdiff_t row = rect.top; row < rect.bottom; ++row)
                 {
                     const uint32_t * s = &src.At<uint32_t>(0, row);
 
                     uint16_t * evenDst = &dst.At<uint16_t>(0, row);
-                    for (size_t col = 0; col < src.width; col += 2)
+                    for (ptrdiff_t col = rect.left + (rect.left & 1); col < rect.right; col += 2)
                         evenDst[col >> 1] = (uint16_t)s[col];
 
                     uint16_t * oddDst = &dst.At<uint16_t>((dst.width + 1) >> 1, row);
-                    for (size_t col = 1; col < src.width; col += 2)
+                    for (ptrdiff_t col = rect.left | 1; col < rect.right; col += 2)
                         oddDst[col >> 1] = (uint16_t)s[col];
                 }
             }
             else
             {
-                for (size_t row = 0; row < src.height; ++row)
+                for (ptrdiff_t row = rect.top; row < rect.bottom; ++row)
                 {
                     const uint32_t * s = &src.At<uint32_t>(0, row);
                     uint16_t * d = &dst.At<uint16_t>(0, row);
-                    for (size_t col = 0; col < src.width; ++col)
+                    for (ptrdiff_t col = rect.left; col < rect.right; ++col)
                         d[col] = (uint16_t)s[col];
                 }
             }
         }
 
-        void DetectionPrepare(void * _hid)
+        void DetectionPrepareRegion(void * _hid, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom)
         {
             HidBase * hidBase = (HidBase*)_hid;
+            Rect rect(left, top, right, bottom);
             if (hidBase->featureType == SimdDetectionInfoFeatureHaar && hidBase->isThroughColumn)
             {
                 HidHaarCascade * hid = (HidHaarCascade*)hidBase;
-                PrepareThroughColumn32i(hid->sum, hid->isum);
+                PrepareThroughColumn32i(hid->sum, hid->isum, rect);
                 if (hid->hasTilted)
-                    PrepareThroughColumn32i(hid->tilted, hid->itilted);
+                    PrepareThroughColumn32i(hid->tilted, hid->itilted, rect);
             }
             else if (hidBase->featureType == SimdDetectionInfoFeatureLbp)
             {
                 if (hidBase->isInt16)
                 {
                     HidLbpCascade<int, short> * hid = (HidLbpCascade<int, short>*)hidBase;
-                    Prepare16i(hid->sum, hid->isThroughColumn, hid->isum);
+                    Prepare16i(hid->sum, hid->isThroughColumn, hid->isum, rect);
                 }
                 else if (hidBase->isThroughColumn)
                 {
                     HidLbpCascade<float, int> * hid = (HidLbpCascade<float, int>*)hidBase;
-                    PrepareThroughColumn32i(hid->sum, hid->isum);
+                    PrepareThroughColumn32i(hid->sum, hid->isum, rect);
                 }
             }
         }
 
+        void DetectionPrepare(void * hid)
+        {
+            DetectionPrepareRegion(hid, 0, 0, PTRDIFF_MAX, PTRDIFF_MAX);
+        }
+
         int Detect32f(const HidHaarCascade & hid, size_t offset, int startStage, float norm)
         {
             typedef HidHaarCascade Hid;
@@ -715,6 +942,7 @@ namespace Simd
             if (startStage >= (int)hid.stages.size())
                 return 1;
             const Hid::Node * node = hid.nodes.data() + stages[startStage].first;
+            const Hid::Feature * feature = hid.features.data() + stages[startStage].first;
             const float * leaves = hid.leaves.data() + stages[startStage].first * 2;
             for (int i = startStage, n = (int)hid.stages.size(); i < n; ++i)
             {
@@ -725,21 +953,19 @@ namespace Simd
                 float stageSum = 0.0;
                 if (stage.hasThree)
                 {
-                    for (; node < end; ++node, leaves += 2)
+                    for (; node < end; ++node, ++feature, leaves += 2)
                     {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        float sum = WeightedSum32f(feature.rect[0], offset) + WeightedSum32f(feature.rect[1], offset);
-                        if (feature.rect[2].p0)
-                            sum += WeightedSum32f(feature.rect[2], offset);
+                        float sum = WeightedSum32f(feature->rect[0], offset) + WeightedSum32f(feature->rect[1], offset);
+                        if (feature->rect[2].p0)
+                            sum += WeightedSum32f(feature->rect[2], offset);
                         stageSum += leaves[sum >= node->threshold*norm];
                     }
                 }
                 else
                 {
-                    for (; node < end; ++node, leaves += 2)
+                    for (; node < end; ++node, ++feature, leaves += 2)
                     {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        float sum = WeightedSum32f(feature.rect[0], offset) + WeightedSum32f(feature.rect[1], offset);
+                        float sum = WeightedSum32f(feature->rect[0], offset) + WeightedSum32f(feature->rect[1], offset);
                         stageSum += leaves[sum >= node->threshold*norm];
                     }
                 }
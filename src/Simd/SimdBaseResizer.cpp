@@ -346,6 +346,543 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : ResizerFloatBilinear(param)
+        {
+        }
+
+        void ResizerShortBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            Run((const uint16_t*)src, srcStride / sizeof(uint16_t), (uint16_t*)dst, dstStride / sizeof(uint16_t));
+        }
+
+        void ResizerShortBilinear::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            float * pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t prev = -2;
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                int32_t sy = _iy[dy];
+                int32_t k = 0;
+
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+
+                prev = sy;
+
+                for (; k < 2; k++)
+                    RunX(src + (sy + k)*srcStride, pbx[k]);
+
+                RunY(pbx[0], pbx[1], _ay[dy], dst);
+            }
+        }
+
+        void ResizerShortBilinear::RunX(const uint16_t * src, float * dst)
+        {
+            size_t cn = _param.channels;
+            size_t rs = _param.dstW * cn;
+            for (size_t dx = 0; dx < rs; dx++)
+            {
+                int32_t sx = _ix[dx];
+                float fx = _ax[dx];
+                dst[dx] = src[sx] * (1.0f - fx) + src[sx + cn] * fx;
+            }
+        }
+
+        void ResizerShortBilinear::RunY(const float * src0, const float * src1, float fy, uint16_t * dst)
+        {
+            size_t rs = _param.dstW * _param.channels;
+            float fy0 = 1.0f - fy;
+            for (size_t dx = 0; dx < rs; dx++)
+                dst[dx] = ResizerShortRound(src0[dx] * fy0 + src1[dx] * fy);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatArea::ResizerFloatArea(const ResParam & param)
+            : Resizer(param)
+        {
+            _ay.Resize(_param.dstH + 1);
+            _iy.Resize(_param.dstH + 1);
+            EstimateParams(_param.srcH, _param.dstH, _ay.data, _iy.data);
+
+            _ax.Resize(_param.dstW + 1);
+            _ix.Resize(_param.dstW + 1);
+            EstimateParams(_param.srcW, _param.dstW, _ax.data, _ix.data);
+
+            _by.Resize(AlignHi(_param.srcW*_param.channels, _param.align), false, _param.align);
+        }
+
+        void ResizerFloatArea::EstimateParams(size_t srcSize, size_t dstSize, float * alpha, int32_t * index)
+        {
+            float scale = (float)srcSize / dstSize;
+
+            for (size_t ds = 0; ds <= dstSize; ++ds)
+            {
+                float a = (float)ds*scale;
+                size_t i = (size_t)::floor(a);
+                a -= i;
+                if (i == srcSize)
+                {
+                    i--;
+                    a = 1.0f;
+                }
+                alpha[ds] = (1.0f - a) / scale;
+                index[ds] = int32_t(i);
+            }
+        }
+
+        template<class T> SIMD_INLINE void ResizerFloatAreaRowSum(const T * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst)
+        {
+            float alpha = count ? curr : curr - next;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = src[i] * alpha;
+            for (size_t c = 1; c <= count; ++c)
+            {
+                src += stride;
+                alpha = c < count ? zero : zero - next;
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] += src[i] * alpha;
+            }
+        }
+
+        void ResizerFloatArea::RowSum(const float * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst)
+        {
+            ResizerFloatAreaRowSum(src, stride, count, size, curr, zero, next, dst);
+        }
+
+        template<class T> SIMD_INLINE void ResizerFloatAreaSet(float value, T * dst)
+        {
+            *dst = value;
+        }
+
+        template<> SIMD_INLINE void ResizerFloatAreaSet<uint16_t>(float value, uint16_t * dst)
+        {
+            *dst = ResizerShortRound(value);
+        }
+
+        template<class T> void ResizerFloatAreaColSum(const float * src, const int32_t * ix, const float * ax, size_t dstW, size_t cn, T * dst)
+        {
+            float zero = ax[0];
+            for (size_t dx = 0; dx < dstW; dx++, dst += cn)
+            {
+                size_t count = ix[dx + 1] - ix[dx];
+                float curr = ax[dx], next = ax[dx + 1];
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    const float * s = src + c;
+                    float sum = s[0] * curr;
+                    for (size_t i = 0; i < count; ++i)
+                        s += cn, sum += s[0] * zero;
+                    ResizerFloatAreaSet(sum - s[0] * next, dst + c);
+                }
+                src += count * cn;
+            }
+        }
+
+        void ResizerFloatArea::ColSum(const float * src, float * dst)
+        {
+            ResizerFloatAreaColSum(src, _ix.data, _ax.data, _param.dstW, _param.channels, dst);
+        }
+
+        void ResizerFloatArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            Run((const float*)src, srcStride / sizeof(float), (float*)dst, dstStride / sizeof(float));
+        }
+
+        void ResizerFloatArea::Run(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            size_t cn = _param.channels, rowSize = _param.srcW*cn;
+            const int32_t * iy = _iy.data;
+            const float * ay = _ay.data;
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                size_t yn = iy[dy + 1] - iy[dy];
+                RowSum(src, srcStride, yn, rowSize, ay[dy], ay[0], ay[dy + 1], _by.data), src += yn * srcStride;
+                ColSum(_by.data, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : ResizerFloatArea(param)
+        {
+        }
+
+        void ResizerShortArea::RowSum(const uint16_t * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst)
+        {
+            ResizerFloatAreaRowSum(src, stride, count, size, curr, zero, next, dst);
+        }
+
+        void ResizerShortArea::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            Run((const uint16_t*)src, srcStride / sizeof(uint16_t), (uint16_t*)dst, dstStride / sizeof(uint16_t));
+        }
+
+        void ResizerShortArea::Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride)
+        {
+            size_t cn = _param.channels, rowSize = _param.srcW*cn;
+            const int32_t * iy = _iy.data;
+            const float * ay = _ay.data;
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                size_t yn = iy[dy + 1] - iy[dy];
+                RowSum(src, srcStride, yn, rowSize, ay[dy], ay[0], ay[dy + 1], _by.data), src += yn * srcStride;
+                ResizerFloatAreaColSum(_by.data, _ix.data, _ax.data, _param.dstW, cn, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerNearest::ResizerNearest(const ResParam & param)
+            : Resizer(param)
+        {
+            _pixelSize = _param.ChannelSize() * _param.channels;
+            _ix.Resize(_param.dstW);
+            _iy.Resize(_param.dstH);
+            EstimateIndex(_param.srcW, _param.dstW, _pixelSize, _ix.data);
+            EstimateIndex(_param.srcH, _param.dstH, 1, _iy.data);
+        }
+
+        void ResizerNearest::EstimateIndex(size_t srcSize, size_t dstSize, size_t pixelSize, int32_t * indices)
+        {
+            float scale = (float)srcSize / dstSize;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                size_t index = (size_t)((i + 0.5f)*scale);
+                indices[i] = (int32_t)(Simd::Min(index, srcSize - 1)*pixelSize);
+            }
+        }
+
+        template<size_t N> void ResizerNearest::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                const uint8_t * ps = src + _iy[dy] * srcStride;
+                for (size_t dx = 0, offset = 0; dx < _param.dstW; dx++, offset += N)
+                    memcpy(dst + offset, ps + _ix[dx], N);
+            }
+        }
+
+        void ResizerNearest::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            switch (_pixelSize)
+            {
+            case 1: Run<1>(src, srcStride, dst, dstStride); return;
+            case 2: Run<2>(src, srcStride, dst, dstStride); return;
+            case 3: Run<3>(src, srcStride, dst, dstStride); return;
+            case 4: Run<4>(src, srcStride, dst, dstStride); return;
+            case 8: Run<8>(src, srcStride, dst, dstStride); return;
+            case 12: Run<12>(src, srcStride, dst, dstStride); return;
+            case 16: Run<16>(src, srcStride, dst, dstStride); return;
+            }
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                const uint8_t * ps = src + _iy[dy] * srcStride;
+                for (size_t dx = 0, offset = 0; dx < _param.dstW; dx++, offset += _pixelSize)
+                    memcpy(dst + offset, ps + _ix[dx], _pixelSize);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE float Lanczos3(float x)
+        {
+            if (::fabs(x) < 0.000001f)
+                return 1.0f;
+            if (::fabs(x) >= 3.0f)
+                return 0.0f;
+            double px = M_PI * x;
+            return float(3.0 * ::sin(px) * ::sin(px / 3.0) / (px * px));
+        }
+
+        SIMD_INLINE float Bicubic(float x)
+        {
+            const float A = -0.75f;
+            x = ::fabs(x);
+            if (x < 1.0f)
+                return ((A + 2) * x - (A + 3)) * x * x + 1;
+            if (x < 2.0f)
+                return ((A * x - 5 * A) * x + 8 * A) * x - 4 * A;
+            return 0.0f;
+        }
+
+        SIMD_INLINE size_t ResizerFilterSize(SimdResizeMethodType method, size_t srcSize, size_t dstSize)
+        {
+            float scale = Simd::Max((float)srcSize / dstSize, 1.0f);
+            if (method == SimdResizeMethodBilinearAntiAlias)
+                return (size_t)::ceil(2.0f * scale);
+            if (method == SimdResizeMethodBicubic)
+                return 2 * (size_t)::ceil(2.0f * scale);
+            if (method == SimdResizeMethodLanczos3)
+                return 2 * (size_t)::ceil(3.0f * scale);
+            return 2;
+        }
+
+        void ResizerFilterEstimate(SimdResizeMethodType method, size_t srcSize, size_t dstSize, int32_t * first, int32_t * indices, float * alphas)
+        {
+            size_t size = ResizerFilterSize(method, srcSize, dstSize), half = size / 2 - 1;
+            float scale = (float)srcSize / dstSize;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                float pos = (float)((i + 0.5f)*scale - 0.5f);
+                float index = ::floor(pos);
+                float x = pos - index;
+                ptrdiff_t beg = (ptrdiff_t)index - half;
+                float * a = alphas + i * size;
+                if (method == SimdResizeMethodBilinearAntiAlias)
+                {
+                    float support = Simd::Max(scale, 1.0f), sum = 0;
+                    beg = (ptrdiff_t)::floor(pos - support) + 1;
+                    for (size_t k = 0; k < size; ++k)
+                    {
+                        a[k] = Simd::Max(1.0f - ::fabs(pos - float(beg + k)) / support, 0.0f);
+                        sum += a[k];
+                    }
+                    for (size_t k = 0; k < size; ++k)
+                        a[k] /= sum;
+                }
+                else if (method == SimdResizeMethodBilinear)
+                {
+                    a[0] = 1.0f - x;
+                    a[1] = x;
+                }
+                else if (scale > 1.0f)
+                {
+                    float sum = 0;
+                    for (size_t k = 0; k < size; ++k)
+                    {
+                        float d = (pos - float(beg + (ptrdiff_t)k)) / scale;
+                        a[k] = method == SimdResizeMethodBicubic ? Bicubic(d) : Lanczos3(d);
+                        sum += a[k];
+                    }
+                    for (size_t k = 0; k < size; ++k)
+                        a[k] /= sum;
+                }
+                else if (method == SimdResizeMethodBicubic)
+                {
+                    const float A = -0.75f;
+                    a[0] = ((A*(x + 1) - 5 * A)*(x + 1) + 8 * A)*(x + 1) - 4 * A;
+                    a[1] = ((A + 2)*x - (A + 3))*x*x + 1;
+                    a[2] = ((A + 2)*(1 - x) - (A + 3))*(1 - x)*(1 - x) + 1;
+                    a[3] = 1.0f - a[0] - a[1] - a[2];
+                }
+                else
+                {
+                    float sum = 0;
+                    for (size_t k = 0; k < size; ++k)
+                    {
+                        a[k] = Lanczos3(x + half - k);
+                        sum += a[k];
+                    }
+                    for (size_t k = 0; k < size; ++k)
+                        a[k] /= sum;
+                }
+                first[i] = (int32_t)beg;
+                for (size_t k = 0; k < size; ++k)
+                    indices[i * size + k] = (int32_t)Simd::RestrictRange<ptrdiff_t>(beg + k, 0, srcSize - 1);
+            }
+        }
+
+        SIMD_INLINE void ResizerFilterToFixed(const float * src, size_t size, int16_t * dst)
+        {
+            int32_t sum = 0;
+            size_t max = 0;
+            for (size_t k = 0; k < size; ++k)
+            {
+                dst[k] = (int16_t)::floor(src[k] * FILTER_RANGE + 0.5f);
+                sum += dst[k];
+                if (src[k] > src[max])
+                    max = k;
+            }
+            dst[max] += int16_t(FILTER_RANGE - sum);
+        }
+
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Resizer(param)
+        {
+            _sizeX = ResizerFilterSize(_param.method, _param.srcW, _param.dstW);
+            _sizeY = ResizerFilterSize(_param.method, _param.srcH, _param.dstH);
+            _stride = AlignHi(_param.dstW * _param.channels, SIMD_ALIGN);
+            Array32i index(Simd::Max(_param.dstW * _sizeX, _param.dstH * _sizeY));
+            Array32f alpha(Simd::Max(_param.dstW * _sizeX, _param.dstH * _sizeY));
+
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH * _sizeY);
+            ResizerFilterEstimate(_param.method, _param.srcH, _param.dstH, _iy.data, index.data, alpha.data);
+            for (size_t dy = 0; dy < _param.dstH; ++dy)
+                ResizerFilterToFixed(alpha.data + dy * _sizeY, _sizeY, _ay.data + dy * _sizeY);
+
+            Array32i first(_param.dstW);
+            _ix.Resize(_param.dstW * _sizeX);
+            _ax.Resize(_param.dstW * _sizeX);
+            ResizerFilterEstimate(_param.method, _param.srcW, _param.dstW, first.data, _ix.data, alpha.data);
+            for (size_t dx = 0; dx < _param.dstW; ++dx)
+                ResizerFilterToFixed(alpha.data + dx * _sizeX, _sizeX, _ax.data + dx * _sizeX);
+            for (size_t i = 0; i < _ix.size; ++i)
+                _ix[i] *= (int32_t)_param.channels;
+
+            _bx.Resize(_sizeY * _stride);
+            _rows.Resize(_sizeY);
+            _srcRow = 0;
+            _dstRow = 0;
+        }
+
+        void ResizerByteFilter::RunX(const uint8_t * src, int16_t * dst)
+        {
+            size_t cn = _param.channels;
+            for (size_t dx = 0; dx < _param.dstW; dx++)
+            {
+                const int32_t * ix = _ix.data + dx * _sizeX;
+                const int16_t * ax = _ax.data + dx * _sizeX;
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < _sizeX; ++k)
+                        sum += src[ix[k] + c] * ax[k];
+                    *dst++ = (int16_t)((sum + FILTER_ROUND_X) >> FILTER_SHIFT_X);
+                }
+            }
+        }
+
+        void ResizerByteFilter::RunY(const int16_t * const * src, const int16_t * alpha, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                int32_t sum = 0;
+                for (size_t k = 0; k < _sizeY; ++k)
+                    sum += src[k][i] * alpha[k];
+                dst[i] = (uint8_t)RestrictRange((sum + FILTER_ROUND_Y) >> FILTER_SHIFT_Y);
+            }
+        }
+
+        void ResizerByteFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            _srcRow = 0;
+            _dstRow = 0;
+            Stream(src, srcStride, _param.srcH, dst, dstStride);
+        }
+
+        size_t ResizerByteFilter::Stream(const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride)
+        {
+            const int16_t ** rows = _rows.data;
+            int32_t size = (int32_t)_sizeY, srcH = (int32_t)_param.srcH, last = srcH - 1;
+            size_t done = 0;
+            for (size_t i = 0; i < srcRows && _srcRow < _param.srcH; ++i, src += srcStride)
+            {
+                int32_t sy = (int32_t)_srcRow++;
+                if (_dstRow < _param.dstH && sy >= Simd::Max(_iy[_dstRow], 0))
+                    RunX(src, _bx.data + sy % size * _stride);
+                for (; _dstRow < _param.dstH && Simd::Min(_iy[_dstRow] + size - 1, last) <= sy; ++_dstRow, ++done, dst += dstStride)
+                {
+                    for (int32_t k = 0; k < size; ++k)
+                        rows[k] = _bx.data + Simd::RestrictRange(_iy[_dstRow] + k, 0, last) % size * _stride;
+                    RunY(rows, _ay.data + _dstRow * _sizeY, _param.dstW * _param.channels, dst);
+                }
+            }
+            if (_srcRow == _param.srcH)
+            {
+                _srcRow = 0;
+                _dstRow = 0;
+            }
+            return done;
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Resizer(param)
+        {
+            _sizeX = ResizerFilterSize(_param.method, _param.srcW, _param.dstW);
+            _sizeY = ResizerFilterSize(_param.method, _param.srcH, _param.dstH);
+            _stride = AlignHi(_param.dstW * _param.channels, SIMD_ALIGN);
+            Array32i index(_param.dstH * _sizeY);
+
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH * _sizeY);
+            ResizerFilterEstimate(_param.method, _param.srcH, _param.dstH, _iy.data, index.data, _ay.data);
+
+            Array32i first(_param.dstW);
+            _ix.Resize(_param.dstW * _sizeX);
+            _ax.Resize(_param.dstW * _sizeX);
+            ResizerFilterEstimate(_param.method, _param.srcW, _param.dstW, first.data, _ix.data, _ax.data);
+            for (size_t i = 0; i < _ix.size; ++i)
+                _ix[i] *= (int32_t)_param.channels;
+
+            _bx.Resize(_sizeY * _stride);
+            _rows.Resize(_sizeY);
+            _srcRow = 0;
+            _dstRow = 0;
+        }
+
+        void ResizerFloatFilter::RunX(const float * src, float * dst)
+        {
+            size_t cn = _param.channels;
+            for (size_t dx = 0; dx < _param.dstW; dx++)
+            {
+                const int32_t * ix = _ix.data + dx * _sizeX;
+                const float * ax = _ax.data + dx * _sizeX;
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    float sum = 0;
+                    for (size_t k = 0; k < _sizeX; ++k)
+                        sum += src[ix[k] + c] * ax[k];
+                    *dst++ = sum;
+                }
+            }
+        }
+
+        void ResizerFloatFilter::RunY(const float * const * src, const float * alpha, size_t size, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < _sizeY; ++k)
+                    sum += src[k][i] * alpha[k];
+                dst[i] = sum;
+            }
+        }
+
+        void ResizerFloatFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            _srcRow = 0;
+            _dstRow = 0;
+            Stream(src, srcStride, _param.srcH, dst, dstStride);
+        }
+
+        size_t ResizerFloatFilter::Stream(const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride)
+        {
+            const float ** rows = _rows.data;
+            int32_t size = (int32_t)_sizeY, srcH = (int32_t)_param.srcH, last = srcH - 1;
+            size_t done = 0;
+            for (size_t i = 0; i < srcRows && _srcRow < _param.srcH; ++i, src += srcStride)
+            {
+                int32_t sy = (int32_t)_srcRow++;
+                if (_dstRow < _param.dstH && sy >= Simd::Max(_iy[_dstRow], 0))
+                    RunX((float*)src, _bx.data + sy % size * _stride);
+                for (; _dstRow < _param.dstH && Simd::Min(_iy[_dstRow] + size - 1, last) <= sy; ++_dstRow, ++done, dst += dstStride)
+                {
+                    for (int32_t k = 0; k < size; ++k)
+                        rows[k] = _bx.data + Simd::RestrictRange(_iy[_dstRow] + k, 0, last) % size * _stride;
+                    RunY(rows, _ay.data + _dstRow * _sizeY, _param.dstW * _param.channels, (float*)dst);
+                }
+            }
+            if (_srcRow == _param.srcH)
+            {
+                _srcRow = 0;
+                _dstRow = 0;
+            }
+            return done;
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
@@ -355,6 +892,29 @@ namespace Simd
                 return new ResizerByteArea(param);
             else if (type == SimdResizeChannelFloat && (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp))
                 return new ResizerFloatBilinear(param);
+            else if (type == SimdResizeChannelFloat && method == SimdResizeMethodArea)
+                return new ResizerFloatArea(param);
+            else if (type == SimdResizeChannelShort && (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp))
+                return new ResizerShortBilinear(param);
+            else if (type == SimdResizeChannelShort && method == SimdResizeMethodArea)
+                return new ResizerShortArea(param);
+            else if (method == SimdResizeMethodNearest)
+                return new ResizerNearest(param);
+            else if (type == SimdResizeChannelByte && param.IsFilter())
+                return new ResizerByteFilter(param);
+            else if (type == SimdResizeChannelFloat && (param.IsFilter() || method == SimdResizeMethodBilinearAntiAlias))
+                return new ResizerFloatFilter(param);
+            else
+                return NULL;
+        }
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
+            if (type == SimdResizeChannelByte && (method == SimdResizeMethodBilinear || param.IsFilter()))
+                return new ResizerByteFilter(param);
+            else if (type == SimdResizeChannelFloat && (method == SimdResizeMethodBilinear || method == SimdResizeMethodBilinearAntiAlias || param.IsFilter()))
+                return new ResizerFloatFilter(param);
             else
                 return NULL;
         }
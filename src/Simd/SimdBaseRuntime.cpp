@@ -0,0 +1,130 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRuntime.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+#include <fstream>
+
+namespace Simd
+{
+    const char * const RUNTIME_CACHE_MAGIC = "SimdRuntimeCache 1";
+
+    RuntimeCache::RuntimeCache()
+        : _updates(0)
+    {
+        _id = String(::SimdVersion()) + "|" + Base::CpuModel() + "|";
+    }
+
+    RuntimeCache & RuntimeCache::Global()
+    {
+        static RuntimeCache cache;
+        return cache;
+    }
+
+    String RuntimeCache::Full(const String & key) const
+    {
+        return _id + ToStr(Base::GetThreadNumber()) + "|" + key;
+    }
+
+    bool RuntimeCache::Find(const String & key, String & name) const
+    {
+        String full = Full(key);
+        std::lock_guard<std::mutex> lock(_mutex);
+        Map::const_iterator it = _map.find(full);
+        if (it == _map.end())
+            return false;
+        name = it->second;
+        return true;
+    }
+
+    void RuntimeCache::Update(const String & key, const String & name)
+    {
+        String full = Full(key);
+        std::lock_guard<std::mutex> lock(_mutex);
+        _map[full] = name;
+        _updates++;
+    }
+
+    size_t RuntimeCache::Updates() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _updates;
+    }
+
+    bool RuntimeCache::Load(const String & path)
+    {
+        std::ifstream ifs(path.c_str());
+        if (!ifs.is_open())
+            return false;
+        String line;
+        if (!std::getline(ifs, line) || line != RUNTIME_CACHE_MAGIC)
+            return false;
+        Map map;
+        while (std::getline(ifs, line))
+        {
+            size_t tab = line.rfind('\t');
+            if (tab == String::npos || tab == 0 || tab + 1 == line.size())
+                return false;
+            map[line.substr(0, tab)] = line.substr(tab + 1);
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (Map::const_iterator it = map.begin(); it != map.end(); ++it)
+            _map[it->first] = it->second;
+        return true;
+    }
+
+    bool RuntimeCache::Save(const String & path) const
+    {
+        std::ofstream ofs(path.c_str());
+        if (!ofs.is_open())
+            return false;
+        ofs << RUNTIME_CACHE_MAGIC << std::endl;
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (Map::const_iterator it = _map.begin(); it != _map.end(); ++it)
+            ofs << it->first << "\t" << it->second << std::endl;
+        return (bool)ofs;
+    }
+
+    void RuntimeCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _map.clear();
+    }
+
+    namespace Base
+    {
+        SimdBool g_tuningMode = SimdFalse;
+
+        SimdBool GetTuningMode()
+        {
+            return g_tuningMode;
+        }
+
+        void SetTuningMode(SimdBool value)
+        {
+            g_tuningMode = value;
+        }
+    }
+}
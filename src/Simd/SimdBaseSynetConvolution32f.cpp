@@ -28,8 +28,236 @@
 
 namespace Simd
 {
+    size_t SynetConvolution32f::EpilogueBufferSize() const
+    {
+        const ConvParam32f & p = _param;
+        if (!_epilogue.enable)
+            return 0;
+        if (FusedEpilogue())
+            return SynetConvolution32fRowsBufferSize(p);
+        return _epilogue.pool || _epilogue.add ? p.batch * p.dstC * p.dstH * p.dstW : 0;
+    }
+
+    void SynetConvolution32f::ForwardEpilogue(const float * src, float * buf, float * dst)
+    {
+        if (!_epilogue.enable || FusedEpilogue())
+            Forward(src, buf, dst);
+        else
+        {
+            const ConvParam32f & p = _param;
+            size_t sizeC = p.dstC * p.dstH * p.dstW, sizeE = p.dstC * _epilogue.DstH(p) * _epilogue.DstW(p);
+            buf = Buffer(buf);
+            float * tmp = _epilogue.pool || _epilogue.add ? buf + ExternalBufferSize() : dst;
+            Forward(src, buf, tmp);
+            size_t threads = SynetConvolution32fThreadNumber(p);
+            SynetConvolution32fParallel(threads, p.batch, (p.dstH + 1) / 2, 1, [&](size_t thread, size_t b, size_t beg, size_t end)
+            {
+                Base::SynetConvolution32fEpilogue(p, _epilogue, tmp + b * sizeC, 0, p.dstH, beg * 2, Simd::Min(end * 2, p.dstH), dst + b * sizeE);
+            });
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    SynetConvolution32f * SynetConvolution32fTuned::Create(const ConvParam32f & p, const Candidates & candidates)
+    {
+        assert(candidates.size());
+        String key = "SynetConvolution32f-" + p.Key(), name;
+        for (size_t i = 0; i < candidates.size(); ++i)
+            key += (i ? "," : ":") + candidates[i]->Desc();
+        size_t best = candidates.size();
+        if (candidates.size() == 1)
+            best = 0;
+        else if (RuntimeCache::Global().Find(key, name))
+        {
+            for (size_t i = 0; i < candidates.size() && best == candidates.size(); ++i)
+                if (candidates[i]->Desc() == name)
+                    best = i;
+        }
+        if (best == candidates.size())
+            return new SynetConvolution32fTuned(p, candidates, key);
+        for (size_t i = 0; i < candidates.size(); ++i)
+            if (i != best)
+                delete candidates[i];
+        return candidates[best];
+    }
+
+    SynetConvolution32fTuned::SynetConvolution32fTuned(const ConvParam32f & p, const Candidates & candidates, const String & key)
+        : SynetConvolution32f(p)
+        , _candidates(candidates)
+        , _best(NULL)
+        , _key(key)
+    {
+    }
+
+    SynetConvolution32fTuned::~SynetConvolution32fTuned()
+    {
+        for (size_t i = 0; i < _candidates.size(); ++i)
+            delete _candidates[i];
+    }
+
+    String SynetConvolution32fTuned::Ext() const
+    {
+        return _best ? _best->Ext() : _candidates[0]->Ext();
+    }
+
+    String SynetConvolution32fTuned::Desc() const
+    {
+        return _best ? _best->Desc() : Ext() + "::Tuned";
+    }
+
+    size_t SynetConvolution32fTuned::ExternalBufferSize() const
+    {
+        if (_best)
+            return _best->ExternalBufferSize();
+        size_t size = 1;
+        for (size_t i = 0; i < _candidates.size(); ++i)
+            size = Simd::Max(size, _candidates[i]->ExternalBufferSize());
+        return size;
+    }
+
+    size_t SynetConvolution32fTuned::InternalBufferSize() const
+    {
+        if (_best)
+            return _best->InternalBufferSize();
+        size_t size = 0;
+        for (size_t i = 0; i < _candidates.size(); ++i)
+            size += _candidates[i]->InternalBufferSize();
+        return size;
+    }
+
+    void SynetConvolution32fTuned::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
+    {
+        if (_best)
+        {
+            _best->SetParams(weight, internal, bias, params);
+            return;
+        }
+        const ConvParam32f & p = _param;
+        Array32f src(p.batch * p.srcC * p.srcH * p.srcW), dst(p.batch * p.dstC * p.dstH * p.dstW), buf(ExternalBufferSize() + EpilogueBufferSize());
+        for (size_t i = 0; i < src.size; ++i)
+            src[i] = float(int(i % 17) - 8) / 8.0f;
+        std::vector<SimdBool> internals(_candidates.size(), SimdFalse);
+        double min = std::numeric_limits<double>::max();
+        size_t best = 0;
+        for (size_t i = 0; i < _candidates.size(); ++i)
+        {
+            SynetConvolution32f * candidate = _candidates[i];
+            candidate->SetParams(weight, &internals[i], bias, params);
+            candidate->ForwardEpilogue(src.data, buf.data, dst.data);
+            double time = std::numeric_limits<double>::max();
+            for (size_t t = 0; t < TEST_COUNT; ++t)
+            {
+                double start = Simd::Time();
+                candidate->ForwardEpilogue(src.data, buf.data, dst.data);
+                time = Simd::Min(time, Simd::Time() - start);
+            }
+            if (time < min)
+            {
+                min = time;
+                best = i;
+            }
+        }
+        _best = _candidates[best];
+        for (size_t i = 0; i < _candidates.size(); ++i)
+            if (i != best)
+                delete _candidates[i];
+        _candidates.assign(1, _best);
+        if (internal)
+            *internal = internals[best];
+        RuntimeCache::Global().Update(_key, _best->Desc());
+    }
+
+    void SynetConvolution32fTuned::Forward(const float * src, float * buf, float * dst)
+    {
+        _best->ForwardEpilogue(src, buf, dst);
+    }
+
+    void SynetConvolution32fTuned::SetEpilogue(const float * scale, const float * shift, SimdBool pool, SimdBool add)
+    {
+        SynetConvolution32f::SetEpilogue(scale, shift, pool, add);
+        for (size_t i = 0; i < _candidates.size(); ++i)
+            _candidates[i]->SetEpilogue(scale, shift, pool, add);
+    }
+
+    size_t SynetConvolution32fTuned::EpilogueBufferSize() const
+    {
+        if (_best)
+            return _best->EpilogueBufferSize();
+        size_t size = 0;
+        for (size_t i = 0; i < _candidates.size(); ++i)
+            size = Simd::Max(size, _candidates[i]->EpilogueBufferSize());
+        return size;
+    }
+
+    bool SynetConvolution32fTuned::FusedEpilogue() const
+    {
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
     namespace Base
     {
+        void SynetConvolution32fEpilogue(const ConvParam32f & p, const ConvEpilogue32f & e, const float * src, size_t srcY, size_t srcH, size_t yBeg, size_t yEnd, float * dst)
+        {
+            size_t dstC = p.dstC, dstH = p.dstH, dstW = p.dstW;
+            const float * scale = e.scale.data, * shift = e.shift.data;
+            if (e.pool)
+            {
+                size_t poolH = e.DstH(p), poolW = e.DstW(p);
+                assert(yBeg % 2 == 0);
+                for (size_t y = yBeg; y < yEnd; y += 2)
+                {
+                    size_t dy = y / 2, ys = Simd::Min<size_t>(2, dstH - y);
+                    for (size_t dx = 0; dx < poolW; ++dx)
+                    {
+                        size_t x = dx * 2, xs = Simd::Min<size_t>(2, dstW - x);
+                        for (size_t c = 0; c < dstC; ++c)
+                        {
+                            float max = -FLT_MAX;
+                            for (size_t sy = y; sy < y + ys; ++sy)
+                            {
+                                for (size_t sx = x; sx < x + xs; ++sx)
+                                {
+                                    float value = p.trans ? src[((sy - srcY) * dstW + sx) * dstC + c] : src[(c * srcH + sy - srcY) * dstW + sx];
+                                    max = Simd::Max(max, value * scale[c] + shift[c]);
+                                }
+                            }
+                            float & out = p.trans ? dst[(dy * poolW + dx) * dstC + c] : dst[(c * poolH + dy) * poolW + dx];
+                            out = e.add ? out + max : max;
+                        }
+                    }
+                }
+            }
+            else if (p.trans)
+            {
+                src += (yBeg - srcY) * dstW * dstC;
+                dst += yBeg * dstW * dstC;
+                for (size_t i = 0, n = (yEnd - yBeg) * dstW; i < n; ++i, src += dstC, dst += dstC)
+                {
+                    if (e.add)
+                        for (size_t c = 0; c < dstC; ++c)
+                            dst[c] += src[c] * scale[c] + shift[c];
+                    else
+                        for (size_t c = 0; c < dstC; ++c)
+                            dst[c] = src[c] * scale[c] + shift[c];
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < dstC; ++c)
+                {
+                    const float * ps = src + (c * srcH + yBeg - srcY) * dstW;
+                    float * pd = dst + (c * dstH + yBeg) * dstW;
+                    for (size_t i = 0, n = (yEnd - yBeg) * dstW; i < n; ++i)
+                        pd[i] = (e.add ? pd[i] : 0.0f) + ps[i] * scale[c] + shift[c];
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst)
         {
             if (activation == ::SimdConvolutionActivationIdentity)
@@ -496,6 +724,11 @@ namespace Simd
             return p.trans == 0 && p.srcH < 6 && p.srcW < 6 && p.group == 1;
         }
 
+        bool SynetConvolution32fGemmNT::Applicable(const ConvParam32f & p)
+        {
+            return p.trans == 0 && p.group == 1;
+        }
+
         void SynetConvolution32fGemmNT::GemmAndBias(const float * src, float * dst)
         {
             const ConvParam32f & p = _param;
@@ -666,13 +899,22 @@ namespace Simd
             }
             else
             {
+                size_t threads = SynetConvolution32fThreadNumber(p), tile = _tileH * _tileW;
                 for (size_t b = 0; b < _batch; ++b)
                 {
-                    _setInput(src, p.srcC, p.srcH, p.srcW, bufS, _strideS, _pad, p.trans);
+                    Simd::Parallel(0, p.srcC, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        _setInput(src + begin * p.srcH * p.srcW, end - begin, p.srcH, p.srcW, bufS + begin * tile, _strideS, _pad, p.trans);
+                    }, threads);
                     for (size_t i = 0; i < _count; ++i)
                         _gemm.Run(GemmArgs(_M, _N, _K, &_1, _winogradWeight.data + i * _strideW, _K, bufS + i * _strideS, _N, &_0, bufD + i * _strideD, _N));
-                    _setOutput(bufD, _strideD, dst, p.dstC, p.dstH, p.dstW, p.trans);
-                    _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst);
+                    Simd::Parallel(0, p.dstC, [&](size_t thread, size_t begin, size_t end)
+                    {
+                        float * out = dst + begin * p.dstH * p.dstW;
+                        const float * params = p.activation == ::SimdConvolutionActivationPrelu ? _params + begin : _params;
+                        _setOutput(bufD + begin * tile, _strideD, out, end - begin, p.dstH, p.dstW, p.trans);
+                        _biasAndActivation(_bias ? _bias + begin : NULL, end - begin, p.dstH*p.dstW, p.activation, params, p.trans, out);
+                    }, threads);
                     src += _sizeS;
                     dst += _sizeD;
                 }
@@ -685,6 +927,12 @@ namespace Simd
                 (p.trans ? (p.srcH >= 4 && p.srcW >= 4 && p.srcH*p.srcW*p.batch >= 36) : (p.srcH >= 6 && p.srcW >= 6));
         }
 
+        bool SynetConvolution32fWinograd::Applicable(const ConvParam32f & p)
+        {
+            return p.IsKernel(3) && p.IsDilation(1) && p.IsStride(1) && (p.IsPad(0) || p.IsPad(1)) && p.group == 1 &&
+                (p.trans ? (p.srcH >= 4 && p.srcW >= 4 && p.srcH*p.srcW*p.batch >= 36) : (p.srcH >= 6 && p.srcW >= 6));
+        }
+
         void SynetConvolution32fWinograd::SetBlock(size_t block)
         {
             const ConvParam32f & p = _param;
@@ -714,10 +962,14 @@ namespace Simd
         void SynetConvolution32fWinograd::ForwardMerged(const float * src, float * bufS, float * bufD, float * dst, size_t merge)
         {
             const ConvParam32f & p = _param;
+            size_t threads = SynetConvolution32fThreadNumber(p);
             for (size_t b = 0; b < _batch; b += merge)
             {
-                for (size_t m = 0; m < merge; ++m)
-                    _setInput(src + m * _sizeS, p.srcC, p.srcH, p.srcW, bufS + m * _strideS, _strideS * merge, _pad, p.trans);
+                Simd::Parallel(0, merge, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t m = begin; m < end; ++m)
+                        _setInput(src + m * _sizeS, p.srcC, p.srcH, p.srcW, bufS + m * _strideS, _strideS * merge, _pad, p.trans);
+                }, threads);
                 for (size_t i = 0; i < _count; ++i)
                 {
                     if (_nhwcWeight.data)
@@ -730,11 +982,14 @@ namespace Simd
                     else
                         _gemm.Run(GemmArgs(_M * merge, _N, _K, &_1, bufS + i * _strideS * merge, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD * merge, _N));
                 }
-                for (size_t m = 0; m < merge; ++m)
+                Simd::Parallel(0, merge, [&](size_t thread, size_t begin, size_t end)
                 {
-                    _setOutput(bufD + m * _strideD, _strideD * merge, dst + m * _sizeD, p.dstC, p.dstH, p.dstW, p.trans);
-                    _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
-                }
+                    for (size_t m = begin; m < end; ++m)
+                    {
+                        _setOutput(bufD + m * _strideD, _strideD * merge, dst + m * _sizeD, p.dstC, p.dstH, p.dstW, p.trans);
+                        _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
+                    }
+                }, threads);
                 src += _sizeS * merge;
                 dst += _sizeD * merge;
             }
@@ -753,13 +1008,14 @@ namespace Simd
             _grS = _srcC * p.srcH * p.srcW;
             _grD = _dstC * p.dstH  * p.dstW;
             _pad = p.IsPad(0) ? 0 : 1;
+            _threadNumber = Base::GetThreadNumber();
             _convolutionBiasActivation = SetConvolutionBiasActivation();
         }
 
         size_t SynetConvolution32fDirectNchw::ExternalBufferSize() const
         {
             if (_pad)
-                return _srcC*_srcH*_srcW;
+                return _srcC*_srcH*_srcW*_threadNumber;
             else
                 return 1;
         }
@@ -769,29 +1025,23 @@ namespace Simd
             const ConvParam32f & p = _param;
             if(_pad)
                 buf = Buffer(buf);
-            for (size_t b = 0; b < p.batch; ++b)
+            size_t threads = Simd::Min(SynetConvolution32fThreadNumber(p), _threadNumber);
+            SynetConvolution32fParallel(threads, p.batch * p.group, _dstC, 1, [&](size_t thread, size_t i, size_t dcBeg, size_t dcEnd)
             {
-                const float * weight = _weight;
-                const float * bias = _bias;
-                const float * params = _params;
-                for (size_t g = 0; g < p.group; ++g)
+                size_t b = i / p.group, g = i % p.group, dc = g * _dstC + dcBeg;
+                const float * s = src + b * p.srcC * p.srcH * p.srcW + g * _grS;
+                const float * weight = _weight + g * _grW + dcBeg * _srcC * p.kernelY * p.kernelX;
+                const float * bias = _bias ? _bias + dc : NULL;
+                const float * params = p.activation == ::SimdConvolutionActivationPrelu ? _params + dc : _params;
+                float * d = dst + b * p.dstC * p.dstH * p.dstW + g * _grD + dcBeg * p.dstH * p.dstW;
+                if (_pad)
                 {
-                    if (_pad)
-                    {
-                        Pad(src, buf);
-                        _convolutionBiasActivation(buf, _srcC, _srcH, _srcW, weight, bias, params, dst, _dstC, p.dstH, p.dstW);
-                    }
-                    else
-                        _convolutionBiasActivation(src, _srcC, _srcH, _srcW, weight, bias, params, dst, _dstC, p.dstH, p.dstW);
-                    weight += _grW;
-                    if (bias)
-                        bias += _dstC;
-                    if (p.activation == ::SimdConvolutionActivationPrelu)
-                        params += _dstC;
-                    src += _grS;
-                    dst += _grD;
+                    float * pad = buf + thread * _srcC * _srcH * _srcW;
+                    Pad(s, pad);
+                    s = pad;
                 }
-            }
+                _convolutionBiasActivation(s, _srcC, _srcH, _srcW, weight, bias, params, d, dcEnd - dcBeg, p.dstH, p.dstW);
+            });
         }
 
         bool SynetConvolution32fDirectNchw::Preferable(const ConvParam32f & p)
@@ -992,12 +1242,13 @@ namespace Simd
 
         void SynetConvolution32fDirectNhwc::Forward(const float * src, float * buf, float * dst)
         {
-            for (size_t b = 0; b < _batch; ++b)
+            const ConvParam32f & p = _param;
+            if (_epilogue.enable)
+                buf = Buffer(buf) + ExternalBufferSize();
+            SynetConvolution32fForwardRows(p, _epilogue, src, buf, dst, [&](const float * src, const ConvParam32f & rows, float * dst)
             {
-                _convolutionBiasActivation(src, _param, _weight, _bias, _params, dst);
-                src += _sizeS;
-                dst += _sizeD;
-            }
+                _convolutionBiasActivation(src, rows, _weight, _bias, _params, dst);
+            });
         }
 
         bool SynetConvolution32fDirectNhwc::Preferable(const ConvParam32f & p)
@@ -1012,6 +1263,15 @@ namespace Simd
             return p.IsDepthwise();
         }
 
+        bool SynetConvolution32fDirectNhwc::Applicable(const ConvParam32f & p)
+        {
+            if (!p.IsDilation(1) || p.trans == 0)
+                return false;
+            if (p.group == 1)
+                return p.kernelY <= p.srcH && p.kernelX <= p.srcW;
+            return p.IsDepthwise();
+        }
+
         static void ConvolutionDirectNhwcConvolutionBiasActivationDefault(const float * src, const ConvParam32f & p, const float * weight, const float * bias, const float * params, float * dst)
         {
             size_t group = p.group;
@@ -1095,23 +1355,28 @@ namespace Simd
        
         void SynetConvolution32fDepthwiseDotProduct::Forward(const float * src, float * buf, float * dst)
         {
-            for (size_t b = 0; b < _batch; ++b)
+            const ConvParam32f & p = _param;
+            size_t threads = SynetConvolution32fThreadNumber(p);
+            SynetConvolution32fParallel(threads, _batch, _count, 1, [&](size_t thread, size_t b, size_t begin, size_t end)
             {
+                const float * s = src + b * _sizeS;
+                float * d = dst + b * _sizeD;
                 if (_bias)
                 {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size) + _bias[i];
+                    for (size_t i = begin; i < end; ++i)
+                        d[i] = DotProduct(s + i * _size, _weight + i * _size, _size) + _bias[i];
                 }
                 else
                 {
-                    for (size_t i = 0; i < _count; ++i)
-                        dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
+                    for (size_t i = begin; i < end; ++i)
+                        d[i] = DotProduct(s + i * _size, _weight + i * _size, _size);
                 }
-                if (_param.activation)
-                    ConvolutionBiasAndActivation(NULL, _count, 1, _param.activation, _params, ::SimdFalse, dst);                
-                src += _sizeS;
-                dst += _sizeD;
-            }
+                if (p.activation)
+                {
+                    const float * params = p.activation == ::SimdConvolutionActivationPrelu ? _params + begin : _params;
+                    ConvolutionBiasAndActivation(NULL, end - begin, 1, p.activation, params, ::SimdFalse, d + begin);
+                }
+            });
         }
 
         bool SynetConvolution32fDepthwiseDotProduct::Preferable(const ConvParam32f & p)
@@ -1223,12 +1488,12 @@ namespace Simd
         void SynetConvolution32fNhwcDirect::Forward(const float * src, float * buf, float * dst)
         {
             const ConvParam32f & p = _param;
-            for (size_t b = 0; b < p.batch; ++b)
+            if (_epilogue.enable)
+                buf = Buffer(buf) + ExternalBufferSize();
+            SynetConvolution32fForwardRows(p, _epilogue, src, buf, dst, [&](const float * src, const ConvParam32f & rows, float * dst)
             {
-                _convolution(src, _param, _alg, _weight, _bias, _params, dst);
-                src += _sizeS;
-                dst += _sizeD;
-            }
+                _convolution(src, rows, _alg, _weight, _bias, _params, dst);
+            });
         }
 
         bool SynetConvolution32fNhwcDirect::Preferable(const ConvParam32f & p)
@@ -1243,6 +1508,24 @@ namespace Simd
             ConvParam32f param(batch, conv, gemm);
             if (!param.Valid())
                 return NULL;
+            else if (Base::GetTuningMode())
+            {
+                SynetConvolution32fTuned::Candidates candidates;
+                if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+                    candidates.push_back(new SynetConvolution32fDepthwiseDotProduct(param));
+                if (SynetConvolution32fWinograd::Applicable(param))
+                    candidates.push_back(new SynetConvolution32fWinograd(param));
+                if (SynetConvolution32fGemmNT::Applicable(param))
+                    candidates.push_back(new SynetConvolution32fGemmNT(param));
+                if (SynetConvolution32fDirectNchw::Preferable(param))
+                    candidates.push_back(new SynetConvolution32fDirectNchw(param));
+                if (SynetConvolution32fNhwcDirect::Preferable(param))
+                    candidates.push_back(new SynetConvolution32fNhwcDirect(param));
+                if (SynetConvolution32fDirectNhwc::Applicable(param))
+                    candidates.push_back(new SynetConvolution32fDirectNhwc(param));
+                candidates.push_back(new SynetConvolution32fGemmNN(param));
+                return SynetConvolution32fTuned::Create(param, candidates);
+            }
             else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
                 return new SynetConvolution32fDepthwiseDotProduct(param);
             else if(SynetConvolution32fWinograd::Preferable(param))
@@ -0,0 +1,408 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    SIMD_INLINE void SynetQuantization8u(float min, float max, float & scale, float & shift)
+    {
+        min = Simd::Min(min, 0.0f);
+        max = Simd::Max(max, 0.0f);
+        scale = max > min ? 255.0f / (max - min) : 1.0f;
+        shift = (float)Simd::RestrictRange(Round(-min * scale), 0, 255);
+    }
+
+    SynetConvolution8i::SynetConvolution8i(const ConvParam8i & p)
+        : _param(p)
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+        , _perf(NULL)
+#endif
+    {
+    }
+
+    void SynetConvolution8i::SetParams(const float * weight, const float * bias, const float * params, const float * const * stats)
+    {
+        const ConvParam8i & p = _param;
+        const float * srcMin = stats ? stats[0] : NULL, * srcMax = stats ? stats[1] : NULL;
+        const float * dstMin = stats ? stats[2] : NULL, * dstMax = stats ? stats[3] : NULL;
+        _srcScale.Resize(p.srcC);
+        _srcShift.Resize(p.srcC);
+        _srcZero.Resize(p.srcC);
+        for (size_t c = 0; c < p.srcC; ++c)
+        {
+            SynetQuantization8u(srcMin ? srcMin[c] : 0.0f, srcMax ? srcMax[c] : 255.0f, _srcScale[c], _srcShift[c]);
+            _srcZero[c] = (uint8_t)_srcShift[c];
+        }
+        _dstScale.Resize(p.dstC + SYNET_CONVOLUTION_8I_N_ALIGN, true);
+        _dstShift.Resize(p.dstC + SYNET_CONVOLUTION_8I_N_ALIGN, true);
+        for (size_t c = 0; c < p.dstC; ++c)
+            SynetQuantization8u(dstMin ? dstMin[c] : 0.0f, dstMax ? dstMax[c] : 255.0f, _dstScale[c], _dstShift[c]);
+        size_t count = p.activation == SimdConvolutionActivationPrelu ? p.dstC : 2;
+        _params.Resize(count + SYNET_CONVOLUTION_8I_N_ALIGN, true);
+        if (params)
+            memcpy(_params.data, params, count * sizeof(float));
+    }
+
+    void SynetConvolution8i::QuantizeSrc(const float * src, uint8_t * dst) const
+    {
+        const ConvParam8i & p = _param;
+        for (size_t i = 0, n = p.srcH * p.srcW; i < n; ++i)
+        {
+            for (size_t c = 0; c < p.srcC; ++c)
+                dst[c] = (uint8_t)Simd::RestrictRange(Round(src[c] * _srcScale[c]) + (int)_srcShift[c], 0, 255);
+            src += p.srcC;
+            dst += p.srcC;
+        }
+    }
+
+    namespace Base
+    {
+        void Gemm8iNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                int32_t * c = C + i * ldc;
+                for (size_t j = 0; j < N; ++j)
+                    c[j] = 0;
+                for (size_t k = 0; k < K; k += 4)
+                {
+                    const uint8_t * a = A + i * lda + k;
+                    const int8_t * b = B + k * ldb;
+                    for (size_t j = 0; j < N; ++j, b += 4)
+                        c[j] += a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+                }
+            }
+        }
+
+        template<::SimdConvolutionActivationType type> void Convert8u(const int32_t * src, size_t M, size_t N, size_t ldS,
+            const float * norm, const float * bias, const float * params, const float * scale, const float * shift, uint8_t * dst, size_t ldD)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; ++j)
+                {
+                    float value = Activate<type>(float(src[j]) * norm[j] + bias[j], params, j);
+                    dst[j] = (uint8_t)Simd::RestrictRange(Round(value * scale[j] + shift[j]), 0, 255);
+                }
+                src += ldS;
+                dst += ldD;
+            }
+        }
+
+        template<::SimdConvolutionActivationType type> void Convert32f(const int32_t * src, size_t M, size_t N, size_t ldS,
+            const float * norm, const float * bias, const float * params, const float * scale, const float * shift, uint8_t * dst, size_t ldD)
+        {
+            float * pDst = (float*)dst;
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; ++j)
+                    pDst[j] = Activate<type>(float(src[j]) * norm[j] + bias[j], params, j);
+                src += ldS;
+                pDst += ldD;
+            }
+        }
+
+        template<::SimdConvolutionActivationType type> SynetConvolution8iGemmNN::ConvertPtr GetConvert(::SimdTensorDataType dstT)
+        {
+            return dstT == SimdTensorData8u ? Convert8u<type> : Convert32f<type>;
+        }
+
+        SynetConvolution8iGemmNN::ConvertPtr GetConvert(::SimdConvolutionActivationType activation, ::SimdTensorDataType dstT)
+        {
+            switch (activation)
+            {
+            case ::SimdConvolutionActivationIdentity: return GetConvert<::SimdConvolutionActivationIdentity>(dstT);
+            case ::SimdConvolutionActivationRelu: return GetConvert<::SimdConvolutionActivationRelu>(dstT);
+            case ::SimdConvolutionActivationLeakyRelu: return GetConvert<::SimdConvolutionActivationLeakyRelu>(dstT);
+            case ::SimdConvolutionActivationRestrictRange: return GetConvert<::SimdConvolutionActivationRestrictRange>(dstT);
+            case ::SimdConvolutionActivationPrelu: return GetConvert<::SimdConvolutionActivationPrelu>(dstT);
+            case ::SimdConvolutionActivationElu: return GetConvert<::SimdConvolutionActivationElu>(dstT);
+            default: assert(0); return NULL;
+            }
+        }
+
+        SynetConvolution8iGemmNN::SynetConvolution8iGemmNN(const ConvParam8i & p)
+            : SynetConvolution8i(p)
+        {
+            _is1x1 = p.Is1x1() && p.group == 1 && p.srcC % 4 == 0;
+            _M = p.dstH * p.dstW;
+            _N = p.dstC / p.group;
+            _K = p.srcC * p.kernelY * p.kernelX / p.group;
+            _kA = AlignHi(_K, 4);
+            _ldB = AlignHi(_N, SYNET_CONVOLUTION_8I_N_ALIGN);
+            _sizeS = p.srcC * p.srcH * p.srcW;
+            _sizeD = p.dstC * p.dstH * p.dstW;
+            _blockM = Simd::Min(_M, Simd::Max<size_t>(4, AlignLo(AlgCacheL2() / 2 / (_kA + _ldB * sizeof(int32_t)), 4)));
+            _gemm = Base::Gemm8iNN;
+            _convert = Base::GetConvert(p.activation, p.dstT);
+        }
+
+        size_t SynetConvolution8iGemmNN::ExternalBufferSize() const
+        {
+            size_t size = _blockM * _ldB * sizeof(int32_t);
+            if (!_is1x1)
+                size += AlignHi(_blockM * _kA, SIMD_ALIGN);
+            if (_param.srcT == SimdTensorData32f)
+                size += AlignHi(_sizeS, SIMD_ALIGN);
+            return size;
+        }
+
+        size_t SynetConvolution8iGemmNN::InternalBufferSize() const
+        {
+            return SynetConvolution8i::InternalBufferSize() + _weight.size + (_norm.size + _bias.size) * sizeof(float);
+        }
+
+        void SynetConvolution8iGemmNN::SetParams(const float * weight, const float * bias, const float * params, const float * const * stats)
+        {
+            SynetConvolution8i::SetParams(weight, bias, params, stats);
+            const ConvParam8i & p = _param;
+            size_t G = p.group, C = p.srcC / G;
+            _weight.Resize(G * _kA * _ldB, true);
+            _norm.Resize(p.dstC + SYNET_CONVOLUTION_8I_N_ALIGN, true);
+            _bias.Resize(p.dstC + SYNET_CONVOLUTION_8I_N_ALIGN, true);
+            Array32f buf(_K);
+            for (size_t g = 0; g < G; ++g)
+            {
+                const float * srcScale = _srcScale.data + g * C;
+                const uint8_t * srcZero = _srcZero.data + g * C;
+                for (size_t j = 0; j < _N; ++j)
+                {
+                    size_t o = g * _N + j;
+                    float max = 0.0f;
+                    for (size_t k = 0; k < _K; ++k)
+                    {
+                        buf[k] = weight[k * p.dstC + o] / srcScale[k % C];
+                        max = Simd::Max(max, ::fabs(buf[k]));
+                    }
+                    float scale = max > 0.0f ? float(SYNET_CONVOLUTION_8I_WEIGHT_MAX) / max : 1.0f;
+                    int8_t * dst = _weight.data + g * _kA * _ldB + j * 4;
+                    int zero = 0;
+                    for (size_t k = 0; k < _K; ++k)
+                    {
+                        int value = Round(buf[k] * scale);
+                        dst[k / 4 * _ldB * 4 + k % 4] = (int8_t)value;
+                        zero += value * srcZero[k % C];
+                    }
+                    _norm[o] = 1.0f / scale;
+                    _bias[o] = (bias ? bias[o] : 0.0f) - _norm[o] * float(zero);
+                }
+            }
+        }
+
+        void SynetConvolution8iGemmNN::Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst)
+        {
+            const ConvParam8i & p = _param;
+            buf = Buffer(buf);
+            uint8_t * bufS = NULL, * bufR = NULL;
+            if (p.srcT == SimdTensorData32f)
+            {
+                bufS = buf;
+                buf += AlignHi(_sizeS, SIMD_ALIGN);
+            }
+            if (!_is1x1)
+            {
+                bufR = buf;
+                buf += AlignHi(_blockM * _kA, SIMD_ALIGN);
+            }
+            int32_t * bufD = (int32_t*)buf;
+            size_t dstE = p.dstT == SimdTensorData32f ? sizeof(float) : sizeof(uint8_t);
+            bool prelu = p.activation == ::SimdConvolutionActivationPrelu;
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                const uint8_t * s = src + b * _sizeS;
+                if (p.srcT == SimdTensorData32f)
+                {
+                    QuantizeSrc((const float*)src + b * _sizeS, bufS);
+                    s = bufS;
+                }
+                uint8_t * d = dst + b * _sizeD * dstE;
+                for (size_t g = 0; g < p.group; ++g)
+                {
+                    const int8_t * w = _weight.data + g * _kA * _ldB;
+                    size_t o = g * _N;
+                    for (size_t m = 0; m < _M; m += _blockM)
+                    {
+                        size_t n = Simd::Min(_blockM, _M - m);
+                        if (_is1x1)
+                            _gemm(n, _ldB, _kA, s + m * p.srcC, p.srcC, w, _ldB, bufD, _ldB);
+                        else
+                        {
+                            ImgToRow(s, m, n, g, bufR);
+                            _gemm(n, _ldB, _kA, bufR, _kA, w, _ldB, bufD, _ldB);
+                        }
+                        _convert(bufD, n, _N, _ldB, _norm.data + o, _bias.data + o, _params.data + (prelu ? o : 0),
+                            _dstScale.data + o, _dstShift.data + o, d + (m * p.dstC + o) * dstE, p.dstC);
+                    }
+                }
+            }
+        }
+
+        void SynetConvolution8iGemmNN::ImgToRow(const uint8_t * src, size_t m, size_t count, size_t g, uint8_t * dst) const
+        {
+            const ConvParam8i & p = _param;
+            size_t C = p.srcC / p.group;
+            const uint8_t * zero = _srcZero.data + g * C;
+            src += g * C;
+            for (size_t i = 0; i < count; ++i, ++m)
+            {
+                size_t dy = m / p.dstW, dx = m % p.dstW;
+                uint8_t * row = dst + i * _kA;
+                for (size_t ky = 0; ky < p.kernelY; ++ky)
+                {
+                    size_t sy = dy * p.strideY + ky * p.dilationY - p.padY;
+                    for (size_t kx = 0; kx < p.kernelX; ++kx)
+                    {
+                        size_t sx = dx * p.strideX + kx * p.dilationX - p.padX;
+                        if (sy < p.srcH && sx < p.srcW)
+                            memcpy(row, src + (sy * p.srcW + sx) * p.srcC, C);
+                        else
+                            memcpy(row, zero, C);
+                        row += C;
+                    }
+                }
+                for (size_t k = _K; k < _kA; ++k)
+                    *row++ = 0;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetConvolution8iDepthwise::SynetConvolution8iDepthwise(const ConvParam8i & p)
+            : SynetConvolution8i(p)
+        {
+            _sizeS = p.srcC * p.srcH * p.srcW;
+            _sizeD = p.dstC * p.dstH * p.dstW;
+            _convert = Base::GetConvert(p.activation, p.dstT);
+        }
+
+        size_t SynetConvolution8iDepthwise::ExternalBufferSize() const
+        {
+            const ConvParam8i & p = _param;
+            size_t size = p.dstW * p.dstC * sizeof(int32_t);
+            if (p.srcT == SimdTensorData32f)
+                size += AlignHi(_sizeS, SIMD_ALIGN);
+            return size;
+        }
+
+        size_t SynetConvolution8iDepthwise::InternalBufferSize() const
+        {
+            return SynetConvolution8i::InternalBufferSize() + _weight.size + (_norm.size + _bias.size) * sizeof(float);
+        }
+
+        void SynetConvolution8iDepthwise::SetParams(const float * weight, const float * bias, const float * params, const float * const * stats)
+        {
+            SynetConvolution8i::SetParams(weight, bias, params, stats);
+            const ConvParam8i & p = _param;
+            size_t K = p.kernelY * p.kernelX, C = p.dstC;
+            _weight.Resize(K * C);
+            _norm.Resize(C + SYNET_CONVOLUTION_8I_N_ALIGN, true);
+            _bias.Resize(C + SYNET_CONVOLUTION_8I_N_ALIGN, true);
+            for (size_t c = 0; c < C; ++c)
+            {
+                float max = 0.0f;
+                for (size_t k = 0; k < K; ++k)
+                    max = Simd::Max(max, ::fabs(weight[k * C + c] / _srcScale[c]));
+                float scale = max > 0.0f ? float(SYNET_CONVOLUTION_8I_WEIGHT_MAX) / max : 1.0f;
+                int zero = 0;
+                for (size_t k = 0; k < K; ++k)
+                {
+                    int value = Round(weight[k * C + c] / _srcScale[c] * scale);
+                    _weight[k * C + c] = (int8_t)value;
+                    zero += value * _srcZero[c];
+                }
+                _norm[c] = 1.0f / scale;
+                _bias[c] = (bias ? bias[c] : 0.0f) - _norm[c] * float(zero);
+            }
+        }
+
+        void SynetConvolution8iDepthwise::Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst)
+        {
+            const ConvParam8i & p = _param;
+            buf = Buffer(buf);
+            uint8_t * bufS = NULL;
+            if (p.srcT == SimdTensorData32f)
+            {
+                bufS = buf;
+                buf += AlignHi(_sizeS, SIMD_ALIGN);
+            }
+            int32_t * bufD = (int32_t*)buf;
+            size_t dstE = p.dstT == SimdTensorData32f ? sizeof(float) : sizeof(uint8_t);
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                const uint8_t * s = src + b * _sizeS;
+                if (p.srcT == SimdTensorData32f)
+                {
+                    QuantizeSrc((const float*)src + b * _sizeS, bufS);
+                    s = bufS;
+                }
+                uint8_t * d = dst + b * _sizeD * dstE;
+                for (size_t dy = 0; dy < p.dstH; ++dy)
+                {
+                    Forward(s, dy, bufD);
+                    _convert(bufD, p.dstW, p.dstC, p.dstC, _norm.data, _bias.data, _params.data, 
+                        _dstScale.data, _dstShift.data, d + dy * p.dstW * p.dstC * dstE, p.dstC);
+                }
+            }
+        }
+
+        void SynetConvolution8iDepthwise::Forward(const uint8_t * src, size_t dy, int32_t * dst) const
+        {
+            const ConvParam8i & p = _param;
+            size_t C = p.dstC;
+            for (size_t dx = 0; dx < p.dstW; ++dx, dst += C)
+            {
+                for (size_t c = 0; c < C; ++c)
+                    dst[c] = 0;
+                for (size_t ky = 0; ky < p.kernelY; ++ky)
+                {
+                    size_t sy = dy * p.strideY + ky * p.dilationY - p.padY;
+                    for (size_t kx = 0; kx < p.kernelX; ++kx)
+                    {
+                        size_t sx = dx * p.strideX + kx * p.dilationX - p.padX;
+                        const int8_t * w = _weight.data + (ky * p.kernelX + kx) * C;
+                        const uint8_t * s = sy < p.srcH && sx < p.srcW ? src + (sy * p.srcW + sx) * C : _srcZero.data;
+                        for (size_t c = 0; c < C; ++c)
+                            dst[c] += int(s[c]) * int(w[c]);
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv)
+        {
+            ConvParam8i param(batch, conv);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsDepthwise())
+                return new SynetConvolution8iDepthwise(param);
+            return new SynetConvolution8iGemmNN(param);
+        }
+    }
+}
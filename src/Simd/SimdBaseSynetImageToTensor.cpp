@@ -0,0 +1,353 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetImageToTensor.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        static void EstimateIndexAlpha(size_t srcSize, size_t dstSize, int32_t * indices, float * alphas)
+        {
+            float scale = (float)srcSize / dstSize;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                float alpha = (float)((i + 0.5f)*scale - 0.5f);
+                ptrdiff_t index = (ptrdiff_t)::floor(alpha);
+                alpha -= index;
+                if (index < 0)
+                {
+                    index = 0;
+                    alpha = 0;
+                }
+                if (index > (ptrdiff_t)srcSize - 2)
+                {
+                    index = Simd::Max<ptrdiff_t>(srcSize - 2, 0);
+                    alpha = srcSize > 1 ? 1.0f : 0.0f;
+                }
+                indices[i] = (int32_t)index;
+                alphas[i] = alpha;
+            }
+        }
+
+        SynetImageToTensor::SynetImageToTensor(const ImgToTenParam & param)
+            : Simd::SynetImageToTensor(param)
+        {
+            const ImgToTenParam & p = _param;
+            size_t cn = p.channels;
+            _size = p.dstW*cn;
+            _dx = p.srcW > 1 ? cn : 0;
+            _dy = p.srcH > 1 ? 1 : 0;
+            _rowSize = p.srcW*cn;
+
+            Array32i ix(p.dstW);
+            Array32f ax(p.dstW);
+            EstimateIndexAlpha(p.srcW, p.dstW, ix.data, ax.data);
+            _ix.Resize(_size);
+            _ax.Resize(_size);
+            _scale.Resize(_size);
+            _shift.Resize(_size);
+            for (size_t x = 0; x < p.dstW; ++x)
+            {
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    size_t i = p.dstF == SimdTensorFormatNhwc ? x*cn + c : c*p.dstW + x;
+                    _ix[i] = int32_t(ix[x] * cn + c);
+                    _ax[i] = ax[x];
+                    _scale[i] = p.scale[c];
+                    _shift[i] = -p.mean[c] * p.scale[c];
+                }
+            }
+
+            _iy.Resize(p.dstH);
+            _ay.Resize(p.dstH);
+            EstimateIndexAlpha(p.srcH, p.dstH, _iy.data, _ay.data);
+
+            _bx[0].Resize(_size);
+            _bx[1].Resize(_size);
+            _bgr.Resize(p.srcW*cn*(p.IsYuv() ? 2 : 1));
+            if (p.srcF == SimdFrameFormatNv12)
+            {
+                _u.Resize(p.srcW / 2);
+                _v.Resize(p.srcW / 2);
+            }
+
+            SetConverters(Base::BgraToBgr, Base::GrayToBgr, Base::BgrToGray, Base::BgraToGray, Base::DeinterleaveUv, Base::Yuv420pToBgr);
+        }
+
+        void SynetImageToTensor::SetConverters(ConvertPtr bgraToBgr, ConvertPtr grayToBgr, ConvertPtr bgrToGray, ConvertPtr bgraToGray, DeinterleaveUvPtr deinterleaveUv, Yuv420pToBgrPtr yuv420pToBgr)
+        {
+            const ImgToTenParam & p = _param;
+            _convert = NULL;
+            if (p.srcF == SimdFrameFormatBgra32)
+                _convert = p.channels == 3 ? bgraToBgr : bgraToGray;
+            else if (p.srcF == SimdFrameFormatBgr24 && p.channels == 1)
+                _convert = bgrToGray;
+            else if (p.srcF == SimdFrameFormatGray8 && p.channels == 3)
+                _convert = grayToBgr;
+            _deinterleaveUv = deinterleaveUv;
+            _yuv420pToBgr = yuv420pToBgr;
+        }
+
+        const uint8_t * SynetImageToTensor::SrcRow(const uint8_t * const * src, const size_t * srcStride, size_t y)
+        {
+            const ImgToTenParam & p = _param;
+            if (p.IsYuv())
+            {
+                if (p.channels == 1)
+                    return src[0] + y*srcStride[0];
+                ptrdiff_t pair = y / 2;
+                if (_pair != pair)
+                {
+                    const uint8_t * u, * v;
+                    if (p.srcF == SimdFrameFormatNv12)
+                    {
+                        _deinterleaveUv(src[1] + pair*srcStride[1], srcStride[1], p.srcW / 2, 1, _u.data, _u.size, _v.data, _v.size);
+                        u = _u.data, v = _v.data;
+                    }
+                    else
+                    {
+                        u = src[1] + pair*srcStride[1];
+                        v = src[2] + pair*srcStride[2];
+                    }
+                    _yuv420pToBgr(src[0] + 2 * pair*srcStride[0], srcStride[0], u, 0, v, 0, p.srcW, 2, _bgr.data, p.srcW * 3);
+                    _pair = pair;
+                }
+                return _bgr.data + (y & 1)*p.srcW * 3;
+            }
+            if (_convert)
+            {
+                _convert(src[0] + y*srcStride[0], p.srcW, 1, srcStride[0], _bgr.data, _bgr.size);
+                return _bgr.data;
+            }
+            return src[0] + y*srcStride[0];
+        }
+
+        const float * SynetImageToTensor::RowX(const uint8_t * const * src, const size_t * srcStride, size_t y)
+        {
+            float * dst = _bx[y & 1].data;
+            if (_rows[y & 1] != (ptrdiff_t)y)
+            {
+                RunX(SrcRow(src, srcStride, y), dst);
+                _rows[y & 1] = y;
+            }
+            return dst;
+        }
+
+        void SynetImageToTensor::RowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            SynetImageToTensorRowY(src0, src1, alpha, scale, shift, size, dst);
+        }
+
+        void SynetImageToTensor::RunX(const uint8_t * src, float * dst)
+        {
+            SynetImageToTensorRowX(src, _rowSize, _ix.data, _ax.data, _dx, _size, dst);
+        }
+
+        void SynetImageToTensor::Run(const uint8_t * const * src, const size_t * srcStride, float * dst)
+        {
+            const ImgToTenParam & p = _param;
+            _pair = -1;
+            _rows[0] = -1;
+            _rows[1] = -1;
+            for (size_t dy = 0; dy < p.dstH; ++dy)
+            {
+                size_t sy = _iy[dy];
+                const float * row0 = RowX(src, srcStride, sy);
+                const float * row1 = RowX(src, srcStride, sy + _dy);
+                if (p.dstF == SimdTensorFormatNhwc)
+                    RowY(row0, row1, _ay[dy], _scale.data, _shift.data, _size, dst + dy*_size);
+                else
+                {
+                    for (size_t c = 0, o = 0; c < p.channels; ++c, o += p.dstW)
+                        RowY(row0 + o, row1 + o, _ay[dy], _scale.data + o, _shift.data + o, p.dstW, dst + (c*p.dstH + dy)*p.dstW);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat)
+        {
+            ImgToTenParam param(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+            if (!param.Valid())
+                return NULL;
+            return new SynetImageToTensor(param);
+        }
+
+        void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                const uint8_t * s = src + ix[i];
+                float s0 = s[0];
+                dst[i] = s0 + (s[dx] - s0)*ax[i];
+            }
+        }
+
+        void SynetImageToTensorRowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (src0[i] + (src1[i] - src0[i])*alpha)*scale[i] + shift[i];
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetCropResize::SynetCropResize(const CropResParam & param, SynetImageToTensorRowXPtr rowX, SynetImageToTensorRowYPtr rowY)
+            : Simd::SynetCropResize(param)
+            , _rowX(rowX)
+            , _rowY(rowY)
+            , _threads(0)
+        {
+            const CropResParam & p = _param;
+            size_t cn = p.channels;
+            _rowSize = p.dstW*cn;
+            _dstSize = _rowSize*p.dstH*(p.dstT == SimdTensorData32f ? sizeof(float) : 1);
+            _bufSize = _rowSize + p.dstW + p.dstH;
+            _scale.Resize(_rowSize);
+            _shift.Resize(_rowSize);
+            for (size_t x = 0; x < p.dstW; ++x)
+            {
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    size_t i = p.dstF == SimdTensorFormatNhwc ? x*cn + c : c*p.dstW + x;
+                    _scale[i] = p.scale[c];
+                    _shift[i] = -p.mean[c] * p.scale[c];
+                }
+            }
+        }
+
+        void SynetCropResize::Run(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const ptrdiff_t * rois, size_t count, uint8_t * dst)
+        {
+            size_t threads = Simd::Max<size_t>(Simd::Min(Base::GetThreadNumber(), count), 1);
+            if (threads > _threads)
+            {
+                _index.Resize(threads*_bufSize);
+                _alpha.Resize(threads*_bufSize);
+                _rows.Resize(threads*_rowSize * 2);
+                _threads = threads;
+            }
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    RunRoi(src, srcStride, srcWidth, srcHeight, rois + 4 * i, thread, dst + i*_dstSize);
+            }, threads);
+        }
+
+        static void CropResizeRowY(const float * src0, const float * src1, float alpha, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (uint8_t)RestrictRange(Round(src0[i] + (src1[i] - src0[i])*alpha));
+        }
+
+        void SynetCropResize::RunRoi(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const ptrdiff_t * roi, size_t thread, uint8_t * dst)
+        {
+            const CropResParam & p = _param;
+            size_t cn = p.channels;
+            ptrdiff_t left = Simd::RestrictRange<ptrdiff_t>(roi[0], 0, srcWidth);
+            ptrdiff_t top = Simd::RestrictRange<ptrdiff_t>(roi[1], 0, srcHeight);
+            ptrdiff_t right = Simd::RestrictRange<ptrdiff_t>(roi[2], left, srcWidth);
+            ptrdiff_t bottom = Simd::RestrictRange<ptrdiff_t>(roi[3], top, srcHeight);
+            size_t roiW = right - left, roiH = bottom - top, dstW = p.dstW, dstH = p.dstH;
+            if (roiW == 0 || roiH == 0)
+            {
+                memset(dst, 0, _dstSize);
+                return;
+            }
+            if (p.keepAspect)
+            {
+                float k = Simd::Min(float(p.dstW) / roiW, float(p.dstH) / roiH);
+                dstW = Simd::RestrictRange<size_t>(Round(roiW*k), 1, p.dstW);
+                dstH = Simd::RestrictRange<size_t>(Round(roiH*k), 1, p.dstH);
+                if (dstW < p.dstW || dstH < p.dstH)
+                    memset(dst, 0, _dstSize);
+            }
+            size_t dstX = (p.dstW - dstW) / 2, dstY = (p.dstH - dstH) / 2, size = dstW*cn;
+            size_t dx = roiW > 1 ? cn : 0, dy = roiH > 1 ? 1 : 0;
+
+            int32_t * ix = _index.data + thread*_bufSize, * iy = ix + _rowSize, * jx = iy + p.dstH;
+            float * ax = _alpha.data + thread*_bufSize, * ay = ax + _rowSize, * bx = ay + p.dstH;
+            float * rows[2] = { _rows.data + thread*_rowSize * 2, _rows.data + thread*_rowSize * 2 + _rowSize };
+            ptrdiff_t cached[2] = { -1, -1 };
+            EstimateIndexAlpha(roiW, dstW, jx, bx);
+            for (size_t x = 0; x < dstW; ++x)
+            {
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    size_t i = p.dstF == SimdTensorFormatNhwc ? x*cn + c : c*dstW + x;
+                    ix[i] = int32_t(jx[x] * cn + c);
+                    ax[i] = bx[x];
+                }
+            }
+            EstimateIndexAlpha(roiH, dstH, iy, ay);
+
+            src += top*srcStride + left*cn;
+            for (size_t y = 0; y < dstH; ++y)
+            {
+                for (size_t k = 0; k < 2; ++k)
+                {
+                    ptrdiff_t sy = iy[y] + k*dy;
+                    if (cached[sy & 1] != sy)
+                    {
+                        _rowX(src + sy*srcStride, roiW*cn, ix, ax, dx, size, rows[sy & 1]);
+                        cached[sy & 1] = sy;
+                    }
+                }
+                const float * row0 = rows[iy[y] & 1], * row1 = rows[(iy[y] + dy) & 1];
+                if (p.dstT == SimdTensorData32f)
+                {
+                    float * dst32f = (float*)dst;
+                    if (p.dstF == SimdTensorFormatNhwc)
+                        _rowY(row0, row1, ay[y], _scale.data, _shift.data, size, dst32f + ((dstY + y)*p.dstW + dstX)*cn);
+                    else
+                    {
+                        for (size_t c = 0; c < cn; ++c)
+                            _rowY(row0 + c*dstW, row1 + c*dstW, ay[y], _scale.data + c*p.dstW, _shift.data + c*p.dstW, dstW, dst32f + (c*p.dstH + dstY + y)*p.dstW + dstX);
+                    }
+                }
+                else
+                {
+                    if (p.dstF == SimdTensorFormatNhwc)
+                        CropResizeRowY(row0, row1, ay[y], size, dst + ((dstY + y)*p.dstW + dstX)*cn);
+                    else
+                    {
+                        for (size_t c = 0; c < cn; ++c)
+                            CropResizeRowY(row0 + c*dstW, row1 + c*dstW, ay[y], dstW, dst + (c*p.dstH + dstY + y)*p.dstW + dstX);
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale)
+        {
+            CropResParam param(channels, dstWidth, dstHeight, dstFormat, dstType, keepAspect, mean, scale);
+            if (!param.Valid())
+                return NULL;
+            return new SynetCropResize(param, Base::SynetImageToTensorRowX, Base::SynetImageToTensorRowY);
+        }
+    }
+}
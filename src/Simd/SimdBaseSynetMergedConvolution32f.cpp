@@ -81,6 +81,7 @@ namespace Simd
             assert(p.group == p.srcC && p.group == p.dstC);
             size_t srcH = p.srcH, srcW = p.srcW, srcC = p.srcC, dstW = p.dstW;
             size_t kernelY = p.kernelY, kernelX = p.kernelX, strideY = p.strideY, strideX = p.strideX, padY = p.padY, padX = p.padX;
+            size_t dilationY = p.dilationY, dilationX = p.dilationX;
             for (size_t dy = yBeg; dy < yEnd; ++dy)
             {
                 for (size_t dx = 0; dx < dstW; ++dx)
@@ -90,12 +91,12 @@ namespace Simd
                         float sum = bias ? bias[c] : 0;
                         for (size_t ky = 0; ky < kernelY; ++ky)
                         {
-                            size_t sy = dy * strideY + ky - padY;
+                            size_t sy = dy * strideY + ky * dilationY - padY;
                             if (sy < srcH)
                             {
                                 for (size_t kx = 0; kx < kernelX; ++kx)
                                 {
-                                    size_t sx = dx * strideX + kx - padX;
+                                    size_t sx = dx * strideX + kx * dilationX - padX;
                                     if (sx < srcW)
                                     {
                                         const float * pw = weight + (ky * kernelX + kx) * srcC + c;
@@ -134,13 +135,13 @@ namespace Simd
         }
 
         SynetMergedConvolution32f::SynetMergedConvolution32f(const MergConvParam32f & p)
-            : _param(p), _base(true)
+            : _param(p), _base(true), _threadNumber(1)
         {
             _sizeS = p.conv[0].srcH*p.conv[0].srcW*p.conv[0].srcC;
             _sizeD = p.conv[2].dstH*p.conv[2].dstW*p.conv[2].dstC;
             _sizeB[0] = p.conv[1].srcH*p.conv[1].srcW*p.conv[1].srcC;
             _sizeB[1] = p.conv[1].dstH*p.conv[1].dstW*p.conv[1].dstC;
-            for (size_t i = 0; i < _param.count; ++i)
+            for (size_t i = 0; i < 3; ++i)
             {
                 switch (p.conv[i].activation)
                 {
@@ -160,7 +161,7 @@ namespace Simd
             const MergConvParam32f & p = _param;
             _miC = F;
             size_t size = 0;
-            for (size_t i = 0; i < 3; ++i)
+            for (size_t i = 3 - p.count; i < 3; ++i)
                 size += p.conv[i].kernelY*p.conv[i].kernelX *p.conv[i].srcC * p.conv[i].dstC / p.conv[i].group;
             size_t count = size * sizeof(float) / (L3/2) + 1;
             _maC = AlignHiAny(p.conv[0].dstC / count, 2 * _miC);
@@ -169,13 +170,13 @@ namespace Simd
                 _yStep[1] = Simd::Max<size_t>(1, yStep);
                 for (_bufH[1] = 1; _bufH[1] < _yStep[1]; _bufH[1] *= 2);
                 _yStep[0] = _yStep[1] * p.conv[1].strideY;
-                for (_bufH[0] = 1; _bufH[0] < (_yStep[1] - 1) * p.conv[1].strideY + p.conv[1].kernelY; _bufH[0] *= 2);
+                for (_bufH[0] = 1; _bufH[0] < (_yStep[1] - 1) * p.conv[1].strideY + p.KernelY(1); _bufH[0] *= 2);
                 _sizeB[0] = _bufH[0] * p.conv[0].dstW * _maC;
                 _sizeB[1] = _bufH[1] * p.conv[1].dstW * _maC;
                 if ((_sizeB[0] + _sizeB[1]) * sizeof(float) <= L2)
                     break;
             }
-            for (size_t i = 0; i < 3; ++i)
+            for (size_t i = 3 - p.count; i < 3; ++i)
             {
                 size_t dstC = AlignHiAny(p.conv[i].dstC, i == 1 ? _miC : 2 * _miC);
                 _rWeight[i].Resize(dstC*p.conv[i].kernelY*p.conv[i].kernelX*p.conv[i].srcC);
@@ -188,6 +189,7 @@ namespace Simd
             _dw[0] = p.conv[0].kernelY*p.conv[0].kernelX*p.conv[0].srcC;
             _dw[1] = p.conv[1].kernelY*p.conv[1].kernelX;
             _dw[2] = AlignHiAny(p.conv[2].dstC, 2 * _miC);
+            _threadNumber = Base::GetThreadNumber();
             _base = false;
         }
 
@@ -266,7 +268,7 @@ namespace Simd
 
         size_t SynetMergedConvolution32f::ExternalBufferSize() const
         {
-            return _sizeB[0] + _sizeB[1];
+            return (_sizeB[0] + _sizeB[1]) * _threadNumber;
         }
 
         size_t SynetMergedConvolution32f::InternalBufferSize() const
@@ -280,91 +282,116 @@ namespace Simd
         void SynetMergedConvolution32f::SetParams(const float * const * weight, SimdBool * internal, const float * const * bias, const float * const * params)
         {
             const MergConvParam32f & p = _param;
-            for (size_t i = 0; i < p.count; ++i)
+            _weight[0] = NULL, _bias[0] = NULL, _params[0] = NULL;
+            for (size_t j = 0; j < p.count; ++j)
             {
+                size_t i = 3 - p.count + j;
                 if (_rWeight[i].data)
                 {
                     switch (i)
                     {
-                    case 0: ReorderInputWeight(weight[i], _rWeight[i].data); break;
-                    case 1: ReorderDepthwiseWeight(weight[i], _rWeight[i].data); break;
-                    case 2: ReorderOutputWeight(weight[i], _rWeight[i].data); break;
+                    case 0: ReorderInputWeight(weight[j], _rWeight[i].data); break;
+                    case 1: ReorderDepthwiseWeight(weight[j], _rWeight[i].data); break;
+                    case 2: ReorderOutputWeight(weight[j], _rWeight[i].data); break;
                     default: assert(0);
                     }
                     _weight[i] = _rWeight[i].data;
                     if (internal)
-                        internal[i] = SimdTrue;
+                        internal[j] = SimdTrue;
                 }
                 else
                 {
-                    _weight[i] = weight[i];
+                    _weight[i] = weight[j];
                     if (internal)
-                        internal[i] = SimdFalse;
+                        internal[j] = SimdFalse;
                 }
                 if (_rBias[i].data)
                 {
-                    if (bias[i])
-                        memcpy(_rBias[i].data, bias[i], p.conv[i].dstC * sizeof(float));
+                    if (bias[j])
+                        memcpy(_rBias[i].data, bias[j], p.conv[i].dstC * sizeof(float));
                     _bias[i] = _rBias[i].data;
                 }
                 else
-                    _bias[i] = bias[i];
+                    _bias[i] = bias[j];
                 if (_rParams[i].size)
                 {
-                    memcpy(_rParams[i].data, params[i], p.conv[i].dstC * sizeof(float));
+                    memcpy(_rParams[i].data, params[j], p.conv[i].dstC * sizeof(float));
                     _params[i] = _rParams[i].data;
                 }
                 else
-                    _params[i] = params[i];
+                    _params[i] = params[j];
             }
         }
 
         void SynetMergedConvolution32f::Forward(const float * src, float * buf, float * dst)
         {
             const MergConvParam32f & p = _param;
-            float * buf0 = GetBuffer(buf);
-            float * buf1 = buf0 + _sizeB[0];
-            for (size_t b = 0; b < p.batch; ++b)
+            float * buffer = GetBuffer(buf);
+            if (_base)
             {
-                if (_base)
+                float * buf0 = buffer;
+                float * buf1 = buf0 + _sizeB[0];
+                for (size_t b = 0; b < p.batch; ++b)
                 {
-                    _convolution[0](src, p.conv[0], 0, 0, p.conv[0].dstH, _bufH, _weight[0], _bias[0], _params[0], buf0);
-                    _convolution[1](buf0, p.conv[1], 0, 0, p.conv[1].dstH, _bufH, _weight[1], _bias[1], _params[1], buf1);
+                    if (p.count == 3)
+                        _convolution[0](src, p.conv[0], 0, 0, p.conv[0].dstH, _bufH, _weight[0], _bias[0], _params[0], buf0);
+                    _convolution[1](p.count == 3 ? buf0 : src, p.conv[1], 0, 0, p.conv[1].dstH, _bufH, _weight[1], _bias[1], _params[1], buf1);
                     if (p.add)
                         memcpy(dst, src, sizeof(float)*_sizeS);
                     _convolution[2](buf1, p.conv[2], 0, 0, p.conv[2].dstH, _bufH, _weight[2], _bias[2], _params[2], dst);
+                    src += _sizeS;
+                    dst += _sizeD;
                 }
-                else
+            }
+            else
+            {
+                size_t threads = Simd::Min(_threadNumber, Base::GetThreadNumber()), dstH = p.conv[1].dstH;
+                size_t parts = p.batch >= threads ? 1 : Simd::Min((threads + p.batch - 1) / p.batch, Simd::Max<size_t>(dstH / _yStep[1], 1));
+                Simd::Parallel(0, p.batch * parts, [&](size_t thread, size_t begin, size_t end)
                 {
-                    for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
+                    float * buf0 = buffer + thread * (_sizeB[0] + _sizeB[1]);
+                    float * buf1 = buf0 + _sizeB[0];
+                    for (size_t i = begin; i < end; ++i)
                     {
-                        size_t maC = Simd::Min(C, c + _maC) - c;
-                        for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
-                        {
-                            size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
-                            size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1)*p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
-                            _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0);
-                            _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], buf1);
-                            if (p.add && c == 0)
-                            {
-                                size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1)*p.conv[2].dstW * p.conv[2].dstC;
-                                memcpy(dst + offset, src + offset, sizeof(float)*size);
-                            }
-                            if(maC == C)
-                                _convolution[2](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst);
-                            else if (c == 0)
-                                _convolution[3](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst);
-                            else if (c + maC < C)
-                                _convolution[4](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst);
-                            else
-                                _convolution[5](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst);
-                            yBeg1 = yEnd1;
-                            yBeg0 = yEnd0;
-                        }
+                        size_t b = i / parts, n = i % parts;
+                        Forward(src + b * _sizeS, buf0, buf1, dstH * n / parts, dstH * (n + 1) / parts, dst + b * _sizeD);
                     }
+                }, threads);
+            }
+        }
+
+        void SynetMergedConvolution32f::Forward(const float * src, float * buf0, float * buf1, size_t yBeg, size_t yEnd, float * dst)
+        {
+            const MergConvParam32f & p = _param;
+            const SimdConvolutionParameters & c1 = p.conv[1];
+            for (size_t c = 0, C = c1.dstC; c < C; c += _maC)
+            {
+                size_t maC = Simd::Min(C, c + _maC) - c;
+                for (size_t yBeg1 = yBeg, yBeg0 = yBeg * c1.strideY > c1.padY ? yBeg * c1.strideY - c1.padY : 0; yBeg1 < yEnd;)
+                {
+                    size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], yEnd);
+                    size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (yEnd1 - 1)*c1.strideY + p.KernelY(1) - c1.padY), p.conv[0].dstH);
+                    if (p.count == 3)
+                        _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0);
+                    else
+                        _convolution[0](src + c, p.conv[0], maC, yBeg0, yEnd0, _bufH, NULL, NULL, NULL, buf0);
+                    _convolution[1](buf0, c1, maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], buf1);
+                    if (p.add && c == 0)
+                    {
+                        size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1)*p.conv[2].dstW * p.conv[2].dstC;
+                        memcpy(dst + offset, src + offset, sizeof(float)*size);
+                    }
+                    if (maC == C)
+                        _convolution[2](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst);
+                    else if (c == 0)
+                        _convolution[3](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst);
+                    else if (c + maC < C)
+                        _convolution[4](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst);
+                    else
+                        _convolution[5](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst);
+                    yBeg1 = yEnd1;
+                    yBeg0 = yEnd0;
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -23,8 +23,7 @@
 */
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
-
-#include <thread>
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -40,6 +39,9 @@ namespace Simd
         void SetThreadNumber(size_t threadNumber)
         {
             g_threadNumber = Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency());
+            ThreadPool & pool = ThreadPool::Global();
+            if (pool.Size() > g_threadNumber - 1)
+                pool.Resize(g_threadNumber - 1);
         }
     }
 }
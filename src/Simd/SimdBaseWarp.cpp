@@ -0,0 +1,142 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarp.h"
+#include "Simd/SimdParallelRows.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void WarpRow(const WarpParam & p, const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, size_t beg, size_t end, uint8_t * dst)
+        {
+            if (p.type == SimdResizeChannelByte)
+            {
+                switch (p.channels)
+                {
+                case 1: WarpRow<uint8_t, 1>(p, src, srcStride, sx, sy, beg, end, dst); break;
+                case 2: WarpRow<uint8_t, 2>(p, src, srcStride, sx, sy, beg, end, dst); break;
+                case 3: WarpRow<uint8_t, 3>(p, src, srcStride, sx, sy, beg, end, dst); break;
+                case 4: WarpRow<uint8_t, 4>(p, src, srcStride, sx, sy, beg, end, dst); break;
+                default: assert(0);
+                }
+            }
+            else
+            {
+                switch (p.channels)
+                {
+                case 1: WarpRow<float, 1>(p, src, srcStride, sx, sy, beg, end, dst); break;
+                case 2: WarpRow<float, 2>(p, src, srcStride, sx, sy, beg, end, dst); break;
+                case 3: WarpRow<float, 3>(p, src, srcStride, sx, sy, beg, end, dst); break;
+                case 4: WarpRow<float, 4>(p, src, srcStride, sx, sy, beg, end, dst); break;
+                default: assert(0);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpBilinear::WarpBilinear(const WarpParam & param)
+            : Warp(param)
+        {
+            if (!_param.perspective)
+            {
+                _ax.Resize(_param.dstW);
+                _ay.Resize(_param.dstW);
+                for (size_t x = 0; x < _param.dstW; ++x)
+                {
+                    _ax[x] = WarpRound(_param.inv[0] * x);
+                    _ay[x] = WarpRound(_param.inv[3] * x);
+                }
+            }
+        }
+
+        void WarpBilinear::EstimateCoords(size_t y, int32_t * sx, int32_t * sy)
+        {
+            const double * m = _param.inv;
+            if (_param.perspective)
+            {
+                for (size_t x = 0; x < _param.dstW; ++x)
+                {
+                    double w = m[6] * x + m[7] * y + m[8];
+                    w = w != 0.0 ? 1.0 / w : 0.0;
+                    sx[x] = WarpRound((m[0] * x + m[1] * y + m[2]) * w);
+                    sy[x] = WarpRound((m[3] * x + m[4] * y + m[5]) * w);
+                }
+            }
+            else
+            {
+                int32_t x0 = WarpRound(m[1] * y + m[2]), y0 = WarpRound(m[4] * y + m[5]);
+                for (size_t x = 0; x < _param.dstW; ++x)
+                {
+                    sx[x] = x0 + _ax[x];
+                    sy[x] = y0 + _ay[x];
+                }
+            }
+        }
+
+        void WarpBilinear::RunRow(const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst)
+        {
+            WarpRow(_param, src, srcStride, sx, sy, 0, _param.dstW, dst);
+        }
+
+        void WarpBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd)
+        {
+            Array32i sx(_param.dstW, false, SIMD_ALIGN), sy(_param.dstW, false, SIMD_ALIGN);
+            for (size_t y = yBeg; y < yEnd; ++y)
+            {
+                EstimateCoords(y, sx.data, sy.data);
+                RunRow(src, srcStride, sx.data, sy.data, dst + y * dstStride);
+            }
+        }
+
+        void WarpBilinear::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            if (ParallelRows(_param.dstW, _param.dstH, PARALLEL_ROWS_MIN_FILTER, 1, [&](size_t yBeg, size_t yEnd)
+                {
+                    Run(src, srcStride, dst, dstStride, yBeg, yEnd);
+                }))
+                return;
+            Run(src, srcStride, dst, dstStride, 0, _param.dstH);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, false, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarpBilinear(param);
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, true, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarpBilinear(param);
+        }
+    }
+}
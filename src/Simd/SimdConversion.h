@@ -422,6 +422,14 @@ namespace Simd
                 BgrToV16(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
                 BgrToV16(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
         }
+
+        template <bool align> SIMD_INLINE void LoadUv(const uint8_t * uv, __m128i & u, __m128i & v)
+        {
+            __m128i uv0 = Load<align>((__m128i*)uv + 0);
+            __m128i uv1 = Load<align>((__m128i*)uv + 1);
+            u = _mm_packus_epi16(_mm_and_si128(uv0, K16_00FF), _mm_and_si128(uv1, K16_00FF));
+            v = _mm_packus_epi16(_mm_srli_epi16(uv0, 8), _mm_srli_epi16(uv1, 8));
+        }
     }
 #endif// SIMD_SSE2_ENABLE
 
@@ -711,6 +719,15 @@ namespace Simd
         {
             return _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permute4x64_epi64(bgr, 0xE9), K8_BGRA_TO_BGR_SHUFFLE), alpha);
         }
+
+        // Loads interleaved UV and returns U and V in the same order as LoadPermuted.
+        template <bool align> SIMD_INLINE void LoadPermutedUv(const uint8_t * uv, __m256i & u, __m256i & v)
+        {
+            __m256i uv0 = Load<align>((__m256i*)uv + 0);
+            __m256i uv1 = Load<align>((__m256i*)uv + 1);
+            u = _mm256_packus_epi16(_mm256_and_si256(uv0, K16_00FF), _mm256_and_si256(uv1, K16_00FF));
+            v = _mm256_packus_epi16(_mm256_srli_epi16(uv0, 8), _mm256_srli_epi16(uv1, 8));
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 
@@ -861,6 +878,15 @@ namespace Simd
                     _mm512_or_si512(_mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_COLOR_TO_BGR2, green), K8_SHUFFLE_GREEN_TO_BGR2),
                         _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_COLOR_TO_BGR2, red), K8_SHUFFLE_RED_TO_BGR2)));
         }
+
+        // Loads interleaved UV and returns U and V in the same order as permutation by K64_PERMUTE_FOR_UNPACK.
+        template <bool align, bool mask> SIMD_INLINE void LoadPermutedUv(const uint8_t * uv, __m512i & u, __m512i & v, const __mmask64 * tails)
+        {
+            __m512i uv0 = Load<align, mask>(uv + 0, tails[0]);
+            __m512i uv1 = Load<align, mask>(uv + A, tails[1]);
+            u = _mm512_packus_epi16(_mm512_and_si512(uv0, K16_00FF), _mm512_and_si512(uv1, K16_00FF));
+            v = _mm512_packus_epi16(_mm512_srli_epi16(uv0, 8), _mm512_srli_epi16(uv1, 8));
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE 
 
@@ -26,6 +26,8 @@
 
 #include "Simd/SimdDefs.h"
 
+#include <string>
+
 namespace Simd
 {
     namespace Base
@@ -37,6 +39,8 @@ namespace Simd
         size_t CpuThreadNumber();
 
         size_t CpuCacheSize(size_t level);
+
+        std::string CpuModel();
     }
 
 #ifdef SIMD_SSE_ENABLE
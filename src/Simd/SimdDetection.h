@@ -143,12 +143,13 @@ namespace Simd
 
         struct HidHaarNode
         {
-            int featureIdx;
             int left;
             int right;
             float threshold;
         };
 
+        // Features of HidHaarCascade and HidLbpCascade are stored in order of nodes (one feature per node, without index of feature in node),
+        // so evaluation of window is a sequential pass over nodes, leaves and features with pointers precomputed for given scale level.
         struct HidHaarCascade : public HidBase
         {
             typedef HidHaarNode Node;
@@ -208,7 +209,6 @@ namespace Simd
         {
             struct Node
             {
-                int featureIdx;
                 int left;
                 int right;
             };
@@ -322,7 +322,6 @@ namespace Simd
             size_t subsetSize = (hid.ncategories + 31) / 32;
             const int * subsets = hid.subsets.data();
             const typename Hid::Leave * leaves = hid.leaves.data();
-            const typename Hid::Node * nodes = hid.nodes.data();
             const typename Hid::Stage * stages = hid.stages.data();
             if (startStage >= (int)hid.stages.size())
                 return 1;
@@ -334,8 +333,7 @@ namespace Simd
                 TWeight sum = 0;
                 for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
                 {
-                    const typename Hid::Node & node = nodes[nodeOffset];
-                    int c = Calculate(hid.features[node.featureIdx], offset);
+                    int c = Calculate(hid.features[nodeOffset], offset);
                     const int * subset = subsets + nodeOffset*subsetSize;
                     sum += leaves[subset[c >> 5] & (1 << (c & 31)) ? leafOffset : leafOffset + 1];
                     nodeOffset++;
@@ -150,6 +150,7 @@ namespace Simd
         typedef std::vector<Size> Sizes; /*!< A vector of image sizes type definition. */
         typedef Simd::Rectangle<ptrdiff_t> Rect; /*!< A rectangle type definition. */
         typedef std::vector<Rect> Rects; /*!< A vector of rectangles type definition. */
+        typedef std::vector<View> Views; /*!< A vector of images type definition. */
         typedef int Tag; /*!< A tag type definition. */
 
         static const Tag UNDEFINED_OBJECT_TAG = -1; /*!< The undefined object tag. */
@@ -197,6 +198,9 @@ namespace Simd
             Creates a new empty Detection structure.
         */
         Detection()
+            : _threadNumber(1)
+            , _scaleFactor(1.1)
+            , _motionRestricted(false)
         {
         }
 
@@ -221,16 +225,21 @@ namespace Simd
         */
         bool Load(const std::string & path, Tag tag = UNDEFINED_OBJECT_TAG)
         {
-            Handle handle = ::SimdDetectionLoadA(path.c_str());
-            if (handle)
-            {
-                Data data;
-                data.handle = handle;
-                data.tag = tag;
-                ::SimdDetectionInfo(handle, (size_t*)&data.size.x, (size_t*)&data.size.y, &data.flags);
-                _data.push_back(data);
-            }
-            return handle != NULL;
+            return Add(::SimdDetectionLoadA(path.c_str()), tag);
+        }
+
+        /*!
+            Loads from file classifier cascade in binary format (see ::SimdDetectionSaveBinary).
+            It is much faster than loading of the same cascade in OpenCV XML format.
+            You can call this function more than once if you want to use several object detectors at the same time.
+
+            \param [in] path - a path to binary cascade.
+            \param [in] tag - an user defined tag. This tag will be inserted in output Object structure.
+            \return a result of this operation.
+        */
+        bool LoadBinary(const std::string & path, Tag tag = UNDEFINED_OBJECT_TAG)
+        {
+            return Add(::SimdDetectionLoadBinary(path.c_str()), tag);
         }
 
         /*!
@@ -251,10 +260,28 @@ namespace Simd
         {
             if (_data.empty())
                 return false;
-            _imageSize = imageSize;
             ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
             _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
-            return InitLevels(scaleFactor, sizeMin, sizeMax, roi);
+            _scaleFactor = scaleFactor;
+            _sizeMin = sizeMin;
+            _sizeMax = sizeMax;
+            _batch.clear();
+            _pyramid.size = imageSize;
+            return InitLevels(_pyramid, roi) && !_pyramid.levels.empty();
+        }
+
+        /*!
+            Enables or disables restricted preparation of scale levels at detection with motion mask (see Detection::Detect).
+            In this mode resizing and integral images are estimated only for union of motion regions expanded by size of detection window
+            at every scale level. So the cost of detection follows the amount of motion instead of the image size.
+            A region of scale level is resized independently of the rest of level, so detected objects can slightly differ from the default mode.
+            By default this mode is disabled.
+
+            \param [in] enable - a flag to enable this mode.
+        */
+        void SetMotionRestricted(bool enable)
+        {
+            _motionRestricted = enable;
         }
 
         /*!
@@ -268,46 +295,97 @@ namespace Simd
             \param [in] motionRegions - a set of rectangles (motion regions) to restrict detection region to addition to ROI.
                                         The regions affect to the center of detected object.
             \return a result of this operation.
+
+            \note Scale levels are scanned concurrently in the global thread pool (see Simd::ThreadPool): a worker resizes and integrates
+                  the next level while other workers scan previous ones, small levels are packed into groups to balance the load.
+                  The result does not depend on the number of threads.
         */
         bool Detect(const View & src, Objects & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2,
             bool motionMask = false, const Rects & motionRegions = Rects())
         {
             SIMD_CHECK_PERFORMANCE();
 
-            if (_levels.empty() || src.Size() != _imageSize)
+            if (_pyramid.levels.empty() || src.Size() != _pyramid.size)
                 return false;
 
-            FillLevels(src);
+            FillBaseLevel(_pyramid, src);
 
-            typedef std::map<Tag, Objects> Candidates;
-            Candidates candidates;
+            Run(_pyramid.groups.size() - 1, [&](size_t group)
+            {
+                DetectGroup(_pyramid, group, motionMask, motionRegions);
+            });
+
+            GroupObjects(_pyramid, objects, groupSizeMin, sizeDifferenceMax);
 
-            for (size_t i = 0; i < _levels.size(); ++i)
+            return true;
+        }
+
+        /*!
+            Detects objects at a batch of images (for example, at current frames of many video streams).
+            All images share loaded classifier cascades and parameters given in Detection::Init (ROI is not used).
+            Images can have different sizes. Scale levels are prepared for every position of the batch and are reused
+            while the size of the image at this position does not change, so memory consumption is bounded by the batch size.
+            Pairs (image, group of scale levels) are scanned concurrently in the global thread pool (see Simd::ThreadPool),
+            large levels are additionally split into stripes.
+
+            \note Detection::Init must be called before.
+
+            \param [in] srcs - input images.
+            \param [out] objects - detected objects for every input image.
+            \param [in] groupSizeMin - a minimal weight (number of elementary detections) of detected image.
+            \param [in] sizeDifferenceMax - a parameter to group elementary detections.
+            \return a result of this operation.
+        */
+        bool Detect(const Views & srcs, std::vector<Objects> & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2)
+        {
+            SIMD_CHECK_PERFORMANCE();
+
+            if (_pyramid.levels.empty())
+                return false;
+
+            if (_batch.size() < srcs.size())
+                _batch.resize(srcs.size());
+            for (size_t i = 0; i < srcs.size(); ++i)
             {
-                Level & level = *_levels[i];
-                View mask = level.roi;
-                Rect rect = level.rect;
-                if (motionMask)
-                {
-                    FillMotionMask(motionRegions, level, rect);
-                    mask = level.mask;
-                }
-                if (rect.Empty())
+                PyramidPtr & pyramid = _batch[i];
+                if (pyramid && pyramid->size == srcs[i].Size())
                     continue;
-                for (size_t j = 0; j < level.hids.size(); ++j)
+                pyramid.reset(new Pyramid());
+                pyramid->size = srcs[i].Size();
+                if (!InitLevels(*pyramid, View()))
                 {
-                    Hid & hid = level.hids[j];
+                    pyramid.reset();
+                    return false;
+                }
+            }
 
-                    hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
+            Run(srcs.size(), [&](size_t i)
+            {
+                if (_batch[i]->levels.size())
+                    FillBaseLevel(*_batch[i], srcs[i]);
+            });
 
-                    AddObjects(candidates[hid.data->tag], level.dst, rect, hid.data->size, level.scale,
-                        level.throughColumn ? 2 : 1, hid.data->tag);
+            typedef std::pair<size_t, size_t> Item;
+            std::vector<Item> items;
+            for (size_t group = 0, done = 0; done < srcs.size(); ++group)
+            {
+                done = 0;
+                for (size_t i = 0; i < srcs.size(); ++i)
+                {
+                    if (group + 1 < _batch[i]->groups.size())
+                        items.push_back(Item(i, group));
+                    else
+                        done++;
                 }
             }
+            Run(items.size(), [&](size_t i)
+            {
+                DetectGroup(*_batch[items[i].first], items[i].second, false, Rects());
+            });
 
-            objects.clear();
-            for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
-                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
+            objects.resize(srcs.size());
+            for (size_t i = 0; i < srcs.size(); ++i)
+                GroupObjects(*_batch[i], objects[i], groupSizeMin, sizeDifferenceMax);
 
             return true;
         }
@@ -340,6 +418,12 @@ namespace Simd
             Handle handle;
             Data * data;
             DetectPtr detect;
+            Objects objects;
+
+            size_t ParallelArea() const
+            {
+                return data->Haar() ? 10000 : 30000;
+            }
 
             void Detect(const View & mask, const Rect & rect, View & dst, size_t threadNumber, bool throughColumn)
             {
@@ -348,13 +432,13 @@ namespace Simd
                 Size s = dst.Size() - data->size;
                 View m = mask.Region(s, View::MiddleCenter);
                 Rect r = rect.Shifted(-data->size / 2).Intersection(Rect(s));
-                Simd::Fill(dst, 0);
-                ::SimdDetectionPrepare(handle);
+                Simd::Fill(dst.Region(r).Ref(), 0);
+                ::SimdDetectionPrepareRegion(handle, r.left, r.top, r.right + data->size.x + 1, r.bottom + data->size.y + 1);
 
                 Parallel(r.top, r.bottom, [&](size_t thread, size_t begin, size_t end)
                 {
                     detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
-                }, rect.Area() >= (data->Haar() ? 10000 : 30000) ? threadNumber : 1, throughColumn ? 2 : 1);
+                }, rect.Area() >= ParallelArea() ? threadNumber : 1, throughColumn ? 2 : 1);
             }
         };
         typedef std::vector<Hid> Hids;
@@ -389,17 +473,42 @@ namespace Simd
         typedef std::unique_ptr<Level> LevelPtr;
         typedef std::vector<LevelPtr> LevelPtrs;
 
+        struct Pyramid
+        {
+            Size size;
+            LevelPtrs levels;
+            std::vector<size_t> groups;
+            bool needNormalization;
+        };
+        typedef std::unique_ptr<Pyramid> PyramidPtr;
+        typedef std::vector<PyramidPtr> PyramidPtrs;
+
         std::vector<Data> _data;
-        Size _imageSize;
-        bool _needNormalization;
         ptrdiff_t _threadNumber;
-        LevelPtrs _levels;
+        double _scaleFactor;
+        Size _sizeMin, _sizeMax;
+        Pyramid _pyramid;
+        PyramidPtrs _batch;
+        bool _motionRestricted;
+
+        bool Add(Handle handle, Tag tag)
+        {
+            if (handle)
+            {
+                Data data;
+                data.handle = handle;
+                data.tag = tag;
+                ::SimdDetectionInfo(handle, (size_t*)&data.size.x, (size_t*)&data.size.y, &data.flags);
+                _data.push_back(data);
+            }
+            return handle != NULL;
+        }
 
-        bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
+        bool InitLevels(Pyramid & pyramid, const View & roi)
         {
-            _needNormalization = false;
-            _levels.clear();
-            _levels.reserve(100);
+            pyramid.needNormalization = false;
+            pyramid.levels.clear();
+            pyramid.levels.reserve(100);
             double scale = 1.0;
             do
             {
@@ -408,10 +517,10 @@ namespace Simd
                 for (size_t i = 0; i < _data.size(); ++i)
                 {
                     Size windowSize = _data[i].size * scale;
-                    if (windowSize.x <= sizeMax.x && windowSize.y <= sizeMax.y &&
-                        windowSize.x <= _imageSize.x && windowSize.y <= _imageSize.y)
+                    if (windowSize.x <= _sizeMax.x && windowSize.y <= _sizeMax.y &&
+                        windowSize.x <= pyramid.size.x && windowSize.y <= pyramid.size.y)
                     {
-                        if (windowSize.x >= sizeMin.x && windowSize.y >= sizeMin.y)
+                        if (windowSize.x >= _sizeMin.x && windowSize.y >= _sizeMin.y)
                             insert = inserts[i] = true;
                         exit = false;
                     }
@@ -421,12 +530,12 @@ namespace Simd
 
                 if (insert)
                 {
-                    _levels.push_back(LevelPtr(new Level()));
-                    Level & level = *_levels.back();
+                    pyramid.levels.push_back(LevelPtr(new Level()));
+                    Level & level = *pyramid.levels.back();
 
                     level.scale = scale;
                     level.throughColumn = scale <= 2.0;
-                    Size scaledSize(_imageSize / scale);
+                    Size scaledSize(pyramid.size / scale);
 
                     level.src.Recreate(scaledSize, View::Gray8);
                     level.roi.Recreate(scaledSize, View::Gray8);
@@ -465,7 +574,7 @@ namespace Simd
                             return false;
                         level.needSqsum = level.needSqsum | _data[i].Haar();
                         level.needTilted = level.needTilted | _data[i].Tilted();
-                        _needNormalization = _needNormalization | _data[i].Haar();
+                        pyramid.needNormalization = pyramid.needNormalization | _data[i].Haar();
                     }
 
                     level.rect = Rect(level.roi.Size());
@@ -478,12 +587,37 @@ namespace Simd
                         Simd::SegmentationShrinkRegion(level.roi, 255, level.rect);
                     }
                 }
-                scale *= scaleFactor;
+                scale *= _scaleFactor;
             } while (true);
-            return !_levels.empty();
+            InitGroups(pyramid);
+            return true;
         }
 
-        void FillLevels(View src)
+        void InitGroups(Pyramid & pyramid)
+        {
+            std::vector<size_t> & groups = pyramid.groups;
+            const LevelPtrs & levels = pyramid.levels;
+            groups.assign(1, 0);
+            size_t area = 0, areaMin = 0;
+            for (size_t i = 0; i < levels.size(); ++i)
+            {
+                const Level & level = *levels[i];
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    area += level.rect.Area();
+                    areaMin = std::max(areaMin, level.hids[j].ParallelArea());
+                }
+                if (area >= areaMin)
+                {
+                    groups.push_back(i + 1);
+                    area = 0, areaMin = 0;
+                }
+            }
+            if (groups.back() != levels.size())
+                groups.push_back(levels.size());
+        }
+
+        void FillBaseLevel(Pyramid & pyramid, View src)
         {
             View gray;
             if (src.format != View::Gray8)
@@ -493,42 +627,106 @@ namespace Simd
                 src = gray;
             }
 
-            Simd::ResizeBilinear(src, _levels[0]->src);
-            if (_needNormalization)
-                Simd::NormalizeHistogram(_levels[0]->src, _levels[0]->src);
-            EstimateIntegral(*_levels[0]);
-            for (size_t i = 1; i < _levels.size(); ++i)
+            View & base = pyramid.levels[0]->src;
+            Simd::ResizeBilinear(src, base);
+            if (pyramid.needNormalization)
+                Simd::NormalizeHistogram(base, base);
+        }
+
+        template<class Function> void Run(size_t count, Function function)
+        {
+            Simd::ParallelDynamic(0, count, function, _threadNumber);
+        }
+
+        void DetectGroup(Pyramid & pyramid, size_t group, bool motionMask, const Rects & motionRegions)
+        {
+            for (size_t i = pyramid.groups[group]; i < pyramid.groups[group + 1]; ++i)
+                DetectLevel(*pyramid.levels[i], pyramid.levels[0]->src, i > 0, motionMask, motionRegions);
+        }
+
+        void DetectLevel(Level & level, const View & base, bool resize, bool motionMask, const Rects & motionRegions)
+        {
+            View mask = level.roi;
+            Rect rect = level.rect;
+            if (motionMask)
             {
-                Simd::ResizeBilinear(_levels[0]->src, _levels[i]->src);
-                EstimateIntegral(*_levels[i]);
+                FillMotionMask(motionRegions, level, rect);
+                mask = level.mask;
             }
+            for (size_t j = 0; j < level.hids.size(); ++j)
+                level.hids[j].objects.clear();
+            if (rect.Empty())
+                return;
+            Rect region(level.src.Size());
+            if (motionMask && _motionRestricted)
+                region = PreparedRegion(level, rect);
+            if (resize)
+                ResizeLevel(level, base, region);
+            EstimateIntegral(level, region);
+            for (size_t j = 0; j < level.hids.size(); ++j)
+            {
+                Hid & hid = level.hids[j];
+
+                hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
+
+                AddObjects(hid.objects, level.dst, rect, hid.data->size, level.scale,
+                    level.throughColumn ? 2 : 1, hid.data->tag);
+            }
+        }
+
+        Rect PreparedRegion(const Level & level, const Rect & rect) const
+        {
+            Size size;
+            for (size_t j = 0; j < level.hids.size(); ++j)
+            {
+                size.x = std::max(size.x, level.hids[j].data->size.x);
+                size.y = std::max(size.y, level.hids[j].data->size.y);
+            }
+            Rect region(rect.left - size.x, rect.top - size.y, rect.right + size.x, rect.bottom + size.y);
+            return region.Intersection(Rect(level.src.Size()));
+        }
+
+        void ResizeLevel(Level & level, const View & base, const Rect & region)
+        {
+            double kx = double(base.width) / level.src.width, ky = double(base.height) / level.src.height;
+            Rect src(ptrdiff_t(::floor(region.left * kx)), ptrdiff_t(::floor(region.top * ky)),
+                ptrdiff_t(::ceil(region.right * kx)), ptrdiff_t(::ceil(region.bottom * ky)));
+            Simd::ResizeBilinear(base.Region(src.Intersection(Rect(base.Size()))), level.src.Region(region).Ref());
         }
 
-        void EstimateIntegral(Level & level)
+        void EstimateIntegral(Level & level, const Rect & region)
         {
+            // Differences of integral values at corners of a window do not depend on the origin of integration,
+            // so integral images of the region are valid for all windows which lie inside it.
+            Rect integral(region.left, region.top, region.right + 1, region.bottom + 1);
+            View src = level.src.Region(region);
+            View sum = level.sum.Region(integral);
+            View sqsum = level.sqsum.Region(integral);
+            View tilted = level.tilted.Region(integral);
             if (level.needSqsum)
             {
                 if (level.needTilted)
-                    Simd::Integral(level.src, level.sum, level.sqsum, level.tilted);
+                    Simd::Integral(src, sum, sqsum, tilted);
                 else
-                    Simd::Integral(level.src, level.sum, level.sqsum);
+                    Simd::Integral(src, sum, sqsum);
             }
             else
-                Simd::Integral(level.src, level.sum);
+                Simd::Integral(src, sum);
         }
 
         void FillMotionMask(const Rects & rects, Level & level, Rect & rect) const
         {
-            Simd::Fill(level.mask, 0);
             rect = Rect();
             for (size_t i = 0; i < rects.size(); i++)
-            {
-                Rect r = rects[i] / level.scale;
-                rect |= r;
-                Simd::Fill(level.mask.Region(r).Ref(), 0xFF);
-            }
+                rect |= rects[i] / level.scale;
             rect &= level.rect;
-            Simd::OperationBinary8u(level.mask, level.roi, level.mask, SimdOperationBinary8uAnd);
+            if (rect.Empty())
+                return;
+            View mask = level.mask.Region(rect);
+            Simd::Fill(mask, 0);
+            for (size_t i = 0; i < rects.size(); i++)
+                Simd::Fill(level.mask.Region((rects[i] / level.scale).Intersection(rect)).Ref(), 0xFF);
+            Simd::OperationBinary8u(mask, level.roi.Region(rect), mask, SimdOperationBinary8uAnd);
         }
 
         void AddObjects(Objects & objects, const View & dst, const Rect & rect, const Size & size, double scale, size_t step, Tag tag)
@@ -546,6 +744,29 @@ namespace Simd
             }
         }
 
+        void GroupObjects(const Pyramid & pyramid, Objects & objects, int groupSizeMin, double sizeDifferenceMax)
+        {
+            typedef std::map<Tag, Objects> Candidates;
+            Candidates candidates;
+
+            for (size_t i = 0; i < pyramid.levels.size(); ++i)
+            {
+                const Level & level = *pyramid.levels[i];
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    const Hid & hid = level.hids[j];
+                    if (hid.objects.empty())
+                        continue;
+                    Objects & dst = candidates[hid.data->tag];
+                    dst.insert(dst.end(), hid.objects.begin(), hid.objects.end());
+                }
+            }
+
+            objects.clear();
+            for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
+                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
+        }
+
         struct Similar
         {
             Similar(double sizeDifferenceMax)
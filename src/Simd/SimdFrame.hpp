@@ -330,7 +330,7 @@ namespace Simd
 
     /*! @ingroup cpp_frame_functions
 
-        \fn template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
+        \fn template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst, SimdYuvType yuvType = SimdYuvBt601);
 
         \short Converts one frame to another frame.
 
@@ -338,8 +338,45 @@ namespace Simd
 
         \param [in] src - an input frame.
         \param [out] dst - an output frame.
+        \param [in] yuvType - a type of YUV format (see ::SimdYuvType) which is used for conversion between YUV and BGR(A) frames. By default it is equal to ::SimdYuvBt601.
     */
-    template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
+    template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst, SimdYuvType yuvType = SimdYuvBt601);
+
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> void Build(const Frame<A> & src, Pyramid<A> & dst, ::SimdReduceType reduceType, bool compensation = true);
+
+        \short Builds the gray pyramid directly from the frame.
+
+        The frame is converted to gray by horizontal stripes and every stripe is immediately propagated to upper levels of the pyramid (see Simd::BuildRows).
+        So there is no separate pass of gray conversion. For NV12 and YUV420P frames the Y plane is used as gray image.
+
+        \param [in] src - an input frame. It must not be flipped. Its size must be equal to the size of the lowest level of the pyramid.
+        \param [out] dst - a built pyramid.
+        \param [in] reduceType - a type of function used for image reducing.
+        \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5. It is equal to 'true' by default.
+    */
+    template <template<class> class A> void Build(const Frame<A> & src, Pyramid<A> & dst, ::SimdReduceType reduceType, bool compensation = true);
+
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> void SynetImageToTensor(const Frame<A> & src, size_t width, size_t height, size_t channels, const float * mean, const float * scale, float * dst, SimdTensorFormatType format);
+
+        \short Converts a frame to 32-bit float input tensor (color conversion, bilinear resizing and normalization in one pass).
+
+        \note This function is a C++ wrapper for functions ::SimdSynetImageToTensorInit and ::SimdSynetImageToTensorRun.
+              It uses converter of current thread (see function ImageToTensor::Thread), so its context is created only when parameters are changed.
+
+        \param [in] src - an input frame. It must not be flipped.
+        \param [in] width - a width of the output tensor.
+        \param [in] height - a height of the output tensor.
+        \param [in] channels - a number of channels of the output tensor (1 or 3).
+        \param [in] mean - a pointer to the array with mean values for every channel. Can be NULL.
+        \param [in] scale - a pointer to the array with scale values for every channel. Can be NULL.
+        \param [out] dst - a pointer to the output tensor. Its size is equal to channels*height*width.
+        \param [in] format - a format of the output tensor (::SimdTensorFormatNchw or ::SimdTensorFormatNhwc).
+    */
+    template <template<class> class A> void SynetImageToTensor(const Frame<A> & src, size_t width, size_t height, size_t channels, const float * mean, const float * scale, float * dst, SimdTensorFormatType format);
 
     //-------------------------------------------------------------------------
 
@@ -669,7 +706,7 @@ namespace Simd
         }
     }
 
-    template <template<class> class A> SIMD_INLINE void Convert(const Frame<A> & src, Frame<A> & dst)
+    template <template<class> class A> SIMD_INLINE void Convert(const Frame<A> & src, Frame<A> & dst, SimdYuvType yuvType)
     {
         assert(EqualSize(src, dst) && src.format && dst.format && src.flipped == dst.flipped);
 
@@ -689,19 +726,11 @@ namespace Simd
                 DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
                 break;
             case Frame<A>::Bgra32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgra(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgraV2(src.planes[0], src.planes[1], dst.planes[0], 0xFF, yuvType);
                 break;
-            }
             case Frame<A>::Bgr24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgr(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgrV2(src.planes[0], src.planes[1], dst.planes[0], yuvType);
                 break;
-            }
             case Frame<A>::Gray8:
                 Copy(src.planes[0], dst.planes[0]);
                 break;
@@ -718,10 +747,10 @@ namespace Simd
                 InterleaveUv(src.planes[1], src.planes[2], dst.planes[1]);
                 break;
             case Frame<A>::Bgra32:
-                Yuv420pToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0]);
+                Yuv420pToBgraV2(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], 0xFF, yuvType);
                 break;
             case Frame<A>::Bgr24:
-                Yuv420pToBgr(src.planes[0], src.planes[1], src.planes[2], dst.planes[0]);
+                Yuv420pToBgrV2(src.planes[0], src.planes[1], src.planes[2], dst.planes[0], yuvType);
                 break;
             case Frame<A>::Gray8:
                 Copy(src.planes[0], dst.planes[0]);
@@ -737,12 +766,12 @@ namespace Simd
             case Frame<A>::Nv12:
             {
                 View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgraToYuv420p(src.planes[0], dst.planes[0], u, v);
+                BgraToYuv420pV2(src.planes[0], dst.planes[0], u, v, yuvType);
                 InterleaveUv(u, v, dst.planes[1]);
                 break;
             }
             case Frame<A>::Yuv420p:
-                BgraToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
+                BgraToYuv420pV2(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2], yuvType);
                 break;
             case Frame<A>::Bgr24:
                 BgraToBgr(src.planes[0], dst.planes[0]);
@@ -761,12 +790,12 @@ namespace Simd
             case Frame<A>::Nv12:
             {
                 View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgrToYuv420p(src.planes[0], dst.planes[0], u, v);
+                BgrToYuv420pV2(src.planes[0], dst.planes[0], u, v, yuvType);
                 InterleaveUv(u, v, dst.planes[1]);
                 break;
             }
             case Frame<A>::Yuv420p:
-                BgrToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
+                BgrToYuv420pV2(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2], yuvType);
                 break;
             case Frame<A>::Bgra32:
                 BgrToBgra(src.planes[0], dst.planes[0]);
@@ -806,6 +835,155 @@ namespace Simd
             assert(0);
         }
     }
+
+    template <template<class> class A> SIMD_INLINE void Build(const Frame<A> & src, Pyramid<A> & dst, ::SimdReduceType reduceType, bool compensation)
+    {
+        assert(src.format && !src.flipped && dst.Size() && src.Size() == dst[0].Size());
+
+        View<A> & base = dst[0];
+        const size_t stripe = std::max<size_t>(0x10000 / std::max<size_t>(base.width, 1), 8) & ~size_t(1); // about 64 kB of the lowest level
+        for (size_t row = 0; row < base.height; row += stripe)
+        {
+            size_t end = std::min(row + stripe, base.height);
+            Frame<A> gray(base.Region(0, row, base.width, end));
+            Convert(Frame<A>(src.planes[0].Region(0, row, src.width, end)), gray);
+            BuildRows(dst, row, end, reduceType, compensation);
+        }
+    }
+
+    /*! @ingroup cpp_frame_functions
+
+        \short Reusable converter of frames to 32-bit float input tensor.
+
+        Creation of converter context (see function ::SimdSynetImageToTensorInit) includes estimation of index and alpha tables and allocation of buffers.
+        The converter keeps created context and re-creates it only when parameters of conversion are changed.
+        Converter context is not reentrant, so every thread has its own converter (see function ImageToTensor::Thread). It is used in function Simd::SynetImageToTensor.
+    */
+    class ImageToTensor
+    {
+    public:
+        /*!
+            Creates a new converter without context.
+        */
+        ImageToTensor()
+            : _context(NULL)
+        {
+        }
+
+        /*!
+            Releases converter context.
+        */
+        ~ImageToTensor()
+        {
+            Clear();
+        }
+
+        /*!
+            Converts a frame to 32-bit float input tensor. Converter context is created if it is absent or has other parameters.
+
+            \param [in] src - an input frame. It must not be flipped.
+            \param [in] width - a width of the output tensor.
+            \param [in] height - a height of the output tensor.
+            \param [in] channels - a number of channels of the output tensor (1 or 3).
+            \param [in] mean - a pointer to the array with mean values for every channel. Can be NULL.
+            \param [in] scale - a pointer to the array with scale values for every channel. Can be NULL.
+            \param [out] dst - a pointer to the output tensor. Its size is equal to channels*height*width.
+            \param [in] format - a format of the output tensor (::SimdTensorFormatNchw or ::SimdTensorFormatNhwc).
+            \return a result of conversion. It returns false if converter context can't be created.
+        */
+        template <template<class> class A> bool Run(const Frame<A> & src, size_t width, size_t height, size_t channels, const float * mean, const float * scale, float * dst, SimdTensorFormatType format)
+        {
+            assert(src.format && !src.flipped);
+
+            Param param(src.width, src.height, (SimdFrameFormatType)src.format, width, height, channels, mean, scale, format);
+            if (_context == NULL || !(param == _param))
+            {
+                Clear();
+                _context = SimdSynetImageToTensorInit(src.width, src.height, (SimdFrameFormatType)src.format, width, height, channels, mean, scale, format);
+                _param = param;
+            }
+            if (_context == NULL)
+                return false;
+
+            const uint8_t * planes[Frame<A>::PLANE_COUNT_MAX];
+            size_t strides[Frame<A>::PLANE_COUNT_MAX];
+            for (size_t i = 0; i < Frame<A>::PLANE_COUNT_MAX; ++i)
+            {
+                planes[i] = src.planes[i].data;
+                strides[i] = src.planes[i].stride;
+            }
+            SimdSynetImageToTensorRun(_context, planes, strides, dst);
+            return true;
+        }
+
+        /*!
+            Releases converter context.
+        */
+        void Clear()
+        {
+            if (_context)
+            {
+                SimdRelease(_context);
+                _context = NULL;
+            }
+        }
+
+        /*!
+            Gets converter of current thread.
+
+            \return a reference to converter of current thread.
+        */
+        static ImageToTensor & Thread()
+        {
+            static thread_local ImageToTensor converter;
+            return converter;
+        }
+
+    private:
+        struct Param
+        {
+            size_t srcW, srcH, dstW, dstH, channels;
+            SimdFrameFormatType srcF;
+            SimdTensorFormatType dstF;
+            float mean[3], scale[3];
+
+            Param()
+            {
+            }
+
+            Param(size_t srcW, size_t srcH, SimdFrameFormatType srcF, size_t dstW, size_t dstH, size_t channels, const float * mean, const float * scale, SimdTensorFormatType dstF)
+                : srcW(srcW), srcH(srcH), dstW(dstW), dstH(dstH), channels(channels), srcF(srcF), dstF(dstF)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    this->mean[c] = mean && c < channels ? mean[c] : 0.0f;
+                    this->scale[c] = scale && c < channels ? scale[c] : 1.0f;
+                }
+            }
+
+            bool operator == (const Param & p) const
+            {
+                if (srcW != p.srcW || srcH != p.srcH || dstW != p.dstW || dstH != p.dstH || channels != p.channels || srcF != p.srcF || dstF != p.dstF)
+                    return false;
+                for (size_t c = 0; c < 3; ++c)
+                    if (mean[c] != p.mean[c] || scale[c] != p.scale[c])
+                        return false;
+                return true;
+            }
+        };
+        Param _param;
+        void * _context;
+
+        ImageToTensor(const ImageToTensor &);
+        ImageToTensor & operator = (const ImageToTensor &);
+    };
+
+    template <template<class> class A> SIMD_INLINE void SynetImageToTensor(const Frame<A> & src, size_t width, size_t height, size_t channels, const float * mean, const float * scale, float * dst, SimdTensorFormatType format)
+    {
+        bool result = ImageToTensor::Thread().Run(src, width, height, channels, mean, scale, dst, format);
+        assert(result);
+        (void)result;
+    }
 }
 
 #endif//__SimdFrame_hpp__
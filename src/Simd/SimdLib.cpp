@@ -60,11 +60,15 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdParallelRows.h"
 
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
+#include "Simd/SimdSynetImageToTensor.h"
 #include "Simd/SimdSynetMergedConvolution32f.h"
+#include "Simd/SimdWarp.h"
 
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse1.h"
@@ -221,6 +225,31 @@ SIMD_API void SimdSetFastMode(SimdBool value)
 #endif
 }
 
+SIMD_API SimdBool SimdRuntimeCacheLoad(const char * path)
+{
+    return RuntimeCache::Global().Load(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdRuntimeCacheSave(const char * path)
+{
+    return RuntimeCache::Global().Save(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void SimdRuntimeCacheClear()
+{
+    RuntimeCache::Global().Clear();
+}
+
+SIMD_API SimdBool SimdGetTuningMode()
+{
+    return Base::GetTuningMode();
+}
+
+SIMD_API void SimdSetTuningMode(SimdBool value)
+{
+    Base::SetTuningMode(value);
+}
+
 SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
 {
 #ifdef SIMD_SSE42_ENABLE
@@ -369,6 +398,12 @@ SIMD_API void SimdAbsDifferenceSums3x3Masked(const uint8_t *current, size_t curr
 SIMD_API void SimdAbsGradientSaturatedSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                           uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width, [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdAbsGradientSaturatedSum(src + yBeg * srcStride, srcStride, width, bandH, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Simd::Avx512bw::AbsGradientSaturatedSum(src, srcStride, width, height, dst, dstStride);
@@ -835,6 +870,12 @@ SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height,
 
 SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgraToBgr(bgra + yBeg * bgraStride, width, yEnd - yBeg, bgraStride, bgr + yBeg * bgrStride, bgrStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
@@ -860,6 +901,12 @@ SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, s
 
 SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgraToGray(bgra + yBeg * bgraStride, width, yEnd - yBeg, bgraStride, gray + yBeg * grayStride, grayStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
@@ -890,6 +937,12 @@ SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, s
 
 SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgraToYuv420p(bgra + yBeg * bgraStride, width, yEnd - yBeg, bgraStride, y + yBeg * yStride, yStride, u + yBeg / 2 * uStride, uStride, v + yBeg / 2 * vStride, vStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
@@ -923,8 +976,50 @@ SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t heigh
         Base::BgraToYuv420p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgraToYuv420pV2(bgra + yBeg * bgraStride, width, yEnd - yBeg, bgraStride, y + yBeg * yStride, yStride, u + yBeg / 2 * uStride, uStride, v + yBeg / 2 * vStride, vStride, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgraToYuv422p(bgra + yBeg * bgraStride, width, yEnd - yBeg, bgraStride, y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
@@ -958,8 +1053,50 @@ SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t heigh
         Base::BgraToYuv422p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgraToYuv422pV2(bgra + yBeg * bgraStride, width, yEnd - yBeg, bgraStride, y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgraToYuv422pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgraToYuv444p(bgra + yBeg * bgraStride, width, yEnd - yBeg, bgraStride, y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
@@ -988,6 +1125,37 @@ SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t heigh
         Base::BgraToYuv444p(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgraToYuv444pV2(bgra + yBeg * bgraStride, width, yEnd - yBeg, bgraStride, y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgraToYuv444pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
     uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride)
 {
@@ -1046,6 +1214,12 @@ SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, s
 
 SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgrToBgra(bgr + yBeg * bgrStride, width, yEnd - yBeg, bgrStride, bgra + yBeg * bgraStride, bgraStride, alpha);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
@@ -1107,6 +1281,12 @@ SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t
 
 SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgrToGray(bgr + yBeg * bgrStride, width, yEnd - yBeg, bgrStride, gray + yBeg * grayStride, grayStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
@@ -1152,6 +1332,12 @@ SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, siz
 
 SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgrToRgb(bgr + yBeg * bgrStride, bgrStride, width, yEnd - yBeg, rgb + yBeg * rgbStride, rgbStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToRgb(bgr, bgrStride, width, height, rgb, rgbStride);
@@ -1177,6 +1363,12 @@ SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t bgrStride, size_t width, s
 
 SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgrToYuv420p(bgr + yBeg * bgrStride, width, yEnd - yBeg, bgrStride, y + yBeg * yStride, yStride, u + yBeg / 2 * uStride, uStride, v + yBeg / 2 * vStride, vStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
@@ -1205,8 +1397,45 @@ SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height,
         Base::BgrToYuv420p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgrToYuv420pV2(bgr + yBeg * bgrStride, width, yEnd - yBeg, bgrStride, y + yBeg * yStride, yStride, u + yBeg / 2 * uStride, uStride, v + yBeg / 2 * vStride, vStride, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgrToYuv422p(bgr + yBeg * bgrStride, width, yEnd - yBeg, bgrStride, y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
@@ -1235,8 +1464,45 @@ SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height,
         Base::BgrToYuv422p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgrToYuv422pV2(bgr + yBeg * bgrStride, width, yEnd - yBeg, bgrStride, y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgrToYuv422pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgrToYuv444p(bgr + yBeg * bgrStride, width, yEnd - yBeg, bgrStride, y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
@@ -1265,6 +1531,37 @@ SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height,
         Base::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdBgrToYuv444pV2(bgr + yBeg * bgrStride, width, yEnd - yBeg, bgrStride, y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgrToYuv444pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
 SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                   uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
@@ -1527,6 +1824,12 @@ SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width,
 SIMD_API void SimdDeinterleaveUv(const uint8_t * uv, size_t uvStride, size_t width, size_t height,
                     uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdDeinterleaveUv(uv + yBeg * uvStride, uvStride, width, yEnd - yBeg, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::DeinterleaveUv(uv, uvStride, width, height, u, uStride, v, vStride);
@@ -1612,6 +1915,16 @@ SIMD_API void * SimdDetectionLoadA(const char * path)
     return Base::DetectionLoadA(path);
 }
 
+SIMD_API SimdBool SimdDetectionSaveBinary(const void * data, const char * path)
+{
+    return Base::DetectionSaveBinary(data, path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void * SimdDetectionLoadBinary(const char * path)
+{
+    return Base::DetectionLoadBinary(path);
+}
+
 SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
 {
     Base::DetectionInfo(data, width, height, flags);
@@ -1628,6 +1941,11 @@ SIMD_API void SimdDetectionPrepare(void * hid)
     Base::DetectionPrepare(hid);
 }
 
+SIMD_API void SimdDetectionPrepareRegion(void * hid, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom)
+{
+    Base::DetectionPrepareRegion(hid, left, top, right, bottom);
+}
+
 SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, 
     ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride)
 {
@@ -2247,6 +2565,12 @@ SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t siz
 SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                      size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * channelCount, [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdGaussianBlur3x3(src + yBeg * srcStride, srcStride, width, bandH, channelCount, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
         Avx512bw::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -2298,6 +2622,12 @@ SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, c
 
 SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdGrayToBgr(gray + yBeg * grayStride, width, yEnd - yBeg, grayStride, bgr + yBeg * bgrStride, bgrStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::GrayToBgr(gray, width, height, grayStride, bgr, bgrStride);
@@ -2328,6 +2658,12 @@ SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, s
 
 SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdGrayToBgra(gray + yBeg * grayStride, width, yEnd - yBeg, grayStride, bgra + yBeg * bgraStride, bgraStride, alpha);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
@@ -2915,6 +3251,12 @@ SIMD_API void SimdInterferenceDecrementMasked(uint8_t * statistic, size_t statis
 
 SIMD_API void SimdInterleaveUv(const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * uv, size_t uvStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdInterleaveUv(u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, width, yEnd - yBeg, uv + yBeg * uvStride, uvStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::InterleaveUv(u, uStride, v, vStride, width, height, uv, uvStride);
@@ -2997,6 +3339,12 @@ SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_
 
 SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * sizeof(int16_t), [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdLaplace(src + yBeg * srcStride, srcStride, width, bandH, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::Laplace(src, srcStride, width, height, dst, dstStride);
@@ -3032,6 +3380,12 @@ SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, s
 
 SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * sizeof(int16_t), [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdLaplaceAbs(src + yBeg * srcStride, srcStride, width, bandH, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
@@ -3122,6 +3476,12 @@ SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t widt
 
 SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * channelCount, [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdMeanFilter3x3(src + yBeg * srcStride, srcStride, width, bandH, channelCount, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
         Avx512bw::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -3157,6 +3517,12 @@ SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t wi
 
 SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * channelCount, [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdMedianFilterRhomb3x3(src + yBeg * srcStride, srcStride, width, bandH, channelCount, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
         Avx512bw::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -3187,6 +3553,12 @@ SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, si
 
 SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 2, dst, dstStride, width * channelCount, [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdMedianFilterRhomb5x5(src + yBeg * srcStride, srcStride, width, bandH, channelCount, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
         Avx512bw::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -3217,6 +3589,12 @@ SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, si
 
 SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * channelCount, [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdMedianFilterSquare3x3(src + yBeg * srcStride, srcStride, width, bandH, channelCount, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
         Avx512bw::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -3247,6 +3625,12 @@ SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, s
 
 SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 2, dst, dstStride, width * channelCount, [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdMedianFilterSquare5x5(src + yBeg * srcStride, srcStride, width, bandH, channelCount, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
         Avx512bw::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -3812,123 +4196,251 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
-SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
-               size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
+SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdNv12ToBgr(y + yBeg * yStride, yStride, uv + yBeg / 2 * uvStride, uvStride, width, yEnd - yBeg, bgr + yBeg * bgrStride, bgrStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+        Avx512bw::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width*channelCount >= Avx2::A)
-        Avx2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width*channelCount >= Sse2::A)
-        Sse2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width*channelCount >= Vmx::A)
-        Vmx::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width*channelCount >= Neon::A)
-        Neon::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_MSA_ENABLE
-    if (Msa::Enable && width*channelCount >= Msa::A)
-        Msa::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
     else
 #endif
-        Base::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+        Base::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride);
 }
 
-SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
-                                    size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type)
+SIMD_API void SimdNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdNv12ToBgrV2(y + yBeg * yStride, yStride, uv + yBeg / 2 * uvStride, uvStride, width, yEnd - yBeg, bgr + yBeg * bgrStride, bgrStride, yuvType);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+        Avx512bw::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::HA)
-        Sse2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_MSA_ENABLE
-    if (Msa::Enable && width >= Msa::HA)
-        Msa::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
-        Base::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+        Base::Nv12ToBgrV2(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
 }
 
-SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
+SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdNv12ToBgra(y + yBeg * yStride, yStride, uv + yBeg / 2 * uvStride, uvStride, width, yEnd - yBeg, bgra + yBeg * bgraStride, bgraStride, alpha);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::VectorProduct(vertical, horizontal, dst, stride, width, height);
+        Avx512bw::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::VectorProduct(vertical, horizontal, dst, stride, width, height);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
     else
 #endif
-        Base::VectorProduct(vertical, horizontal, dst, stride, width, height);
+        Base::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha);
 }
 
-SIMD_API void SimdReduceColor2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
-    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+SIMD_API void SimdNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdNv12ToBgraV2(y + yBeg * yStride, yStride, uv + yBeg / 2 * uvStride, uvStride, width, yEnd - yBeg, bgra + yBeg * bgraStride, bgraStride, alpha, yuvType);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+        Avx512bw::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && srcWidth >= Avx2::DA)
-        Avx2::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-#ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && srcWidth >= Ssse3::DA)
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable && width >= Sse2::DA)
+        Sse2::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv12ToBgraV2(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+               size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width*channelCount >= Avx2::A)
+        Avx2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width*channelCount >= Sse2::A)
+        Sse2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width*channelCount >= Vmx::A)
+        Vmx::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width*channelCount >= Neon::A)
+        Neon::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_MSA_ENABLE
+    if (Msa::Enable && width*channelCount >= Msa::A)
+        Msa::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+        Base::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+}
+
+SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+                                    size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::HA)
+        Avx2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::HA)
+        Sse2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::HA)
+        Vmx::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_MSA_ENABLE
+    if (Msa::Enable && width >= Msa::HA)
+        Msa::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+        Base::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+}
+
+SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    else
+#endif
+        Base::VectorProduct(vertical, horizontal, dst, stride, width, height);
+}
+
+SIMD_API void SimdReduceColor2x2(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && srcWidth >= Avx2::DA)
+        Avx2::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && srcWidth >= Ssse3::DA)
         Ssse3::ReduceColor2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
     else
 #endif
@@ -4275,6 +4787,51 @@ SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t s
     ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
 }
 
+SIMD_API void * SimdResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return Avx512bw::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+#ifdef SIMD_AVX512F_ENABLE
+    if (Avx512f::Enable)
+        return Avx512f::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+#ifdef SIMD_AVX_ENABLE
+    if (Avx::Enable)
+        return Avx::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+#ifdef SIMD_SSE_ENABLE
+    if (Sse::Enable)
+        return Sse::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        return Neon::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+    else
+#endif
+        return Base::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+}
+
+SIMD_API size_t SimdResizerStreamRun(void * resizer, const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride)
+{
+    return ((Resizer*)resizer)->Stream(src, srcStride, srcRows, dst, dstStride);
+}
+
 SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -4444,6 +5001,12 @@ SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t wi
 
 SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * sizeof(int16_t), [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdSobelDx(src + yBeg * srcStride, srcStride, width, bandH, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::SobelDx(src, srcStride, width, height, dst, dstStride);
@@ -4479,6 +5042,12 @@ SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, s
 
 SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * sizeof(int16_t), [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdSobelDxAbs(src + yBeg * srcStride, srcStride, width, bandH, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
@@ -4539,6 +5108,12 @@ SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width
 
 SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * sizeof(int16_t), [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdSobelDy(src + yBeg * srcStride, srcStride, width, bandH, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::SobelDy(src, srcStride, width, height, dst, dstStride);
@@ -4574,6 +5149,12 @@ SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, s
 
 SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * sizeof(int16_t), [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdSobelDyAbs(src + yBeg * srcStride, srcStride, width, bandH, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
@@ -4634,6 +5215,12 @@ SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width
 
 SIMD_API void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_FILTER, 1, dst, dstStride, width * sizeof(uint16_t), [&](size_t yBeg, size_t bandH, uint8_t * bandDst, size_t bandStride)
+        {
+            SimdContourMetrics(src + yBeg * srcStride, srcStride, width, bandH, bandDst, bandStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width > Avx512bw::A)
         Avx512bw::ContourMetrics(src, srcStride, width, height, dst, dstStride);
@@ -5203,7 +5790,8 @@ SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionP
 
 SIMD_API size_t SimdSynetConvolution32fExternalBufferSize(const void * context)
 {
-    return ((SynetConvolution32f*)context)->ExternalBufferSize();
+    const SynetConvolution32f * c = (const SynetConvolution32f*)context;
+    return c->ExternalBufferSize() + c->EpilogueBufferSize();
 }
 
 SIMD_API size_t SimdSynetConvolution32fInternalBufferSize(const void * context)
@@ -5216,11 +5804,46 @@ SIMD_API void SimdSynetConvolution32fSetParams(void * context, const float * wei
     ((SynetConvolution32f*)context)->SetParams(weight, internal, bias, params);
 }
 
+SIMD_API void SimdSynetConvolution32fSetEpilogue(void * context, const float * scale, const float * shift, SimdBool pool, SimdBool add)
+{
+    ((SynetConvolution32f*)context)->SetEpilogue(scale, shift, pool, add);
+}
+
 SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst)
 {
     SynetConvolution32f * c = (SynetConvolution32f*)context;
     SIMD_PERF_EXT(c);
-    c->Forward(src, buf, dst);
+    c->ForwardEpilogue(src, buf, dst);
+}
+
+SIMD_API void * SimdSynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return Avx512bw::SynetCropResizeInit(channels, dstWidth, dstHeight, dstFormat, dstType, keepAspect, mean, scale);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::SynetCropResizeInit(channels, dstWidth, dstHeight, dstFormat, dstType, keepAspect, mean, scale);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::SynetCropResizeInit(channels, dstWidth, dstHeight, dstFormat, dstType, keepAspect, mean, scale);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        return Neon::SynetCropResizeInit(channels, dstWidth, dstHeight, dstFormat, dstType, keepAspect, mean, scale);
+    else
+#endif
+        return Base::SynetCropResizeInit(channels, dstWidth, dstHeight, dstFormat, dstType, keepAspect, mean, scale);
+}
+
+SIMD_API void SimdSynetCropResizeRun(const void * context, const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const ptrdiff_t * rois, size_t count, uint8_t * dst)
+{
+    ((SynetCropResize*)context)->Run(src, srcStride, srcWidth, srcHeight, rois, count, dst);
 }
 
 typedef void* (*SimdSynetDeconvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm);
@@ -5253,31 +5876,34 @@ SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src
     d->Forward(src, buf, dst);
 }
 
+typedef void* (*SimdSynetConvolution8iInitPtr) (size_t batch, const SimdConvolutionParameters * conv);
+SimdSynetConvolution8iInitPtr simdSynetConvolution8iInit = SIMD_FUNC3(SynetConvolution8iInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_NEON_FUNC);
+
 SIMD_API void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv)
 {
-    return NULL;
+    return simdSynetConvolution8iInit(batch, conv);
 }
 
 SIMD_API size_t SimdSynetConvolution8iExternalBufferSize(const void * context)
 {
-    assert(0);
-    return 0;
+    return ((SynetConvolution8i*)context)->ExternalBufferSize();
 }
 
 SIMD_API size_t SimdSynetConvolution8iInternalBufferSize(const void * context)
 {
-    assert(0);
-    return 0;
+    return ((SynetConvolution8i*)context)->InternalBufferSize();
 }
 
-SIMD_API void SimdSynetConvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const stats)
+SIMD_API void SimdSynetConvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const * stats)
 {
-    assert(0);
+    ((SynetConvolution8i*)context)->SetParams(weight, bias, params, stats);
 }
 
 SIMD_API void SimdSynetConvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst)
 {
-    assert(0);
+    SynetConvolution8i * c = (SynetConvolution8i*)context;
+    SIMD_PERF_EXT(c);
+    c->Forward(src, buf, dst);
 }
 
 typedef void(*SimdSynetEltwiseLayerForwardPtr) (float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
@@ -5352,6 +5978,41 @@ SIMD_API void SimdSynetFusedLayerForward9(const float * src0, const float * src1
     simdSynetFusedLayerForward9(src0, src1, scale, bias, channels0, channels1, spatial, dst0, dst1, format);
 }
 
+SIMD_API void * SimdSynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return Avx512bw::SynetImageToTensorInit(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::SynetImageToTensorInit(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable)
+        return Ssse3::SynetImageToTensorInit(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::SynetImageToTensorInit(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        return Neon::SynetImageToTensorInit(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+    else
+#endif
+        return Base::SynetImageToTensorInit(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+}
+
+SIMD_API void SimdSynetImageToTensorRun(const void * context, const uint8_t * const * src, const size_t * srcStride, float * dst)
+{
+    ((SynetImageToTensor*)context)->Run(src, srcStride, dst);
+}
+
 typedef void(*SimdSynetInnerProductLayerForwardPtr) (const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
 volatile SimdSynetInnerProductLayerForwardPtr simdSynetInnerProductLayerForward = SIMD_FUNC5(SynetInnerProductLayerForward, SIMD_AVX512F_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
@@ -5597,6 +6258,61 @@ SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t w
         Base::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
 }
 
+SIMD_API void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return Avx512bw::WarpAffineInit(srcW, srcH, dstW, dstH, channels, type, mat, border, value);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::WarpAffineInit(srcW, srcH, dstW, dstH, channels, type, mat, border, value);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        return Sse41::WarpAffineInit(srcW, srcH, dstW, dstH, channels, type, mat, border, value);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        return Neon::WarpAffineInit(srcW, srcH, dstW, dstH, channels, type, mat, border, value);
+    else
+#endif
+        return Base::WarpAffineInit(srcW, srcH, dstW, dstH, channels, type, mat, border, value);
+}
+
+SIMD_API void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return Avx512bw::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, type, mat, border, value);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, type, mat, border, value);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        return Sse41::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, type, mat, border, value);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable)
+        return Neon::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, type, mat, border, value);
+    else
+#endif
+        return Base::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, type, mat, border, value);
+}
+
+SIMD_API void SimdWarpRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    ((Warp*)context)->Run(src, srcStride, dst, dstStride);
+}
+
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
 typedef void(*SimdWinogradSetInputPtr) (const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, float * dst, size_t dstStride, SimdBool pad, SimdBool trans);
 typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
@@ -5693,6 +6409,12 @@ SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_
 SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv420pToBgr(y + yBeg * yStride, yStride, u + yBeg / 2 * uStride, uStride, v + yBeg / 2 * vStride, vStride, width, yEnd - yBeg, bgr + yBeg * bgrStride, bgrStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -5721,9 +6443,47 @@ SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
+SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv420pToBgrV2(y + yBeg * yStride, yStride, u + yBeg / 2 * uStride, uStride, v + yBeg / 2 * vStride, vStride, width, yEnd - yBeg, bgr + yBeg * bgrStride, bgrStride, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
 SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv422pToBgr(y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, width, yEnd - yBeg, bgr + yBeg * bgrStride, bgrStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -5752,9 +6512,47 @@ SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
+SIMD_API void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                 size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv422pToBgrV2(y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, width, yEnd - yBeg, bgr + yBeg * bgrStride, bgrStride, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv422pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
 SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv444pToBgr(y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, width, yEnd - yBeg, bgr + yBeg * bgrStride, bgrStride);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -5783,9 +6581,47 @@ SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
 }
 
+SIMD_API void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                               size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv444pToBgrV2(y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, width, yEnd - yBeg, bgr + yBeg * bgrStride, bgrStride, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if(Ssse3::Enable && width >= Ssse3::A)
+        Ssse3::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv444pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
 SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv420pToBgra(y + yBeg * yStride, yStride, u + yBeg / 2 * uStride, uStride, v + yBeg / 2 * vStride, vStride, width, yEnd - yBeg, bgra + yBeg * bgraStride, bgraStride, alpha);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -5814,9 +6650,47 @@ SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 2, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv420pToBgraV2(y + yBeg * yStride, yStride, u + yBeg / 2 * uStride, uStride, v + yBeg / 2 * vStride, vStride, width, yEnd - yBeg, bgra + yBeg * bgraStride, bgraStride, alpha, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
 SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv422pToBgra(y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, width, yEnd - yBeg, bgra + yBeg * bgraStride, bgraStride, alpha);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -5845,9 +6719,47 @@ SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv422pToBgraV2(y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, width, yEnd - yBeg, bgra + yBeg * bgraStride, bgraStride, alpha, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::DA)
+        Sse2::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::DA)
+        Neon::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv422pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
 SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv444pToBgra(y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, width, yEnd - yBeg, bgra + yBeg * bgraStride, bgraStride, alpha);
+        }))
+        return;
+
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -5876,6 +6788,38 @@ SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t
         Base::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                  size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    if (ParallelRows(width, height, PARALLEL_ROWS_MIN_CONVERT, 1, [&](size_t yBeg, size_t yEnd)
+        {
+            SimdYuv444pToBgraV2(y + yBeg * yStride, yStride, u + yBeg * uStride, uStride, v + yBeg * vStride, vStride, width, yEnd - yBeg, bgra + yBeg * bgraStride, bgraStride, alpha, yuvType);
+        }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
 SIMD_API void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsl, size_t hslStride)
 {
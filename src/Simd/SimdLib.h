@@ -268,6 +268,27 @@ typedef enum
     SimdPixelFormatRgb24,
 } SimdPixelFormatType;
 
+/*! @ingroup c_types
+    Describes pixel format types of a frame (multiplanar image).
+    In particular this type is used in function ::SimdSynetImageToTensorInit.
+    \note This type is corresponds to C++ type Simd::Frame::Format.
+*/
+typedef enum
+{
+    /*! An undefined pixel format. */
+    SimdFrameFormatNone = 0,
+    /*! Two planes (8-bit full size Y plane, 16-bit interlived half size UV plane) NV12 pixel format. */
+    SimdFrameFormatNv12,
+    /*! Three planes (8-bit full size Y plane, 8-bit half size U plane, 8-bit half size V plane) YUV420P pixel format. */
+    SimdFrameFormatYuv420p,
+    /*! One plane 32-bit (4 8-bit channels) BGRA (Blue, Green, Red, Alpha) pixel format. */
+    SimdFrameFormatBgra32,
+    /*! One plane 24-bit (3 8-bit channels) BGR (Blue, Green, Red) pixel format. */
+    SimdFrameFormatBgr24,
+    /*! One plane 8-bit gray pixel format. */
+    SimdFrameFormatGray8,
+} SimdFrameFormatType;
+
 /*! @ingroup c_types
     Describes type of algorithm used for image reducing (downscale in 2 times) (see function Simd::ReduceGray).
 */
@@ -288,6 +309,8 @@ typedef enum
     SimdResizeChannelByte,
     /*! 32-bit float channel type.  */
     SimdResizeChannelFloat,
+    /*! 16-bit unsigned integer channel type.  */
+    SimdResizeChannelShort,
 } SimdResizeChannelType;
 
 /*! @ingroup resizing
@@ -299,8 +322,16 @@ typedef enum
     SimdResizeMethodBilinear,
     /*! caffe::interp compatible method. */
     SimdResizeMethodCaffeInterp,
-    /*! Area method. */
+    /*! Area method. For 32-bit float images at integer scale factors it is equal to adaptive average pooling. */
     SimdResizeMethodArea,
+    /*! Nearest neighbour method (source pixel is chosen by position of center of output pixel). */
+    SimdResizeMethodNearest,
+    /*! Bicubic method (cubic convolution with A = -0.75, OpenCV INTER_CUBIC compatible coefficients). */
+    SimdResizeMethodBicubic,
+    /*! Lanczos method with 6x6 kernel (a = 3). */
+    SimdResizeMethodLanczos3,
+    /*! Bilinear method with anti-aliasing: at downscaling the triangle filter is stretched by scale factor. At upscaling it is equal to bilinear method. It is supported only for ::SimdResizeChannelFloat. */
+    SimdResizeMethodBilinearAntiAlias,
 } SimdResizeMethodType;
 
 /*! @ingroup synet
@@ -361,6 +392,28 @@ typedef enum
     SimdTransformTransposeRotate270, /*!< Image transposed and rotated 270 degrees counterclockwise. It is equal to vertical mirroring of image. The output image has the same size as input image.*/
 } SimdTransformType;
 
+/*! @ingroup transform
+    Describes border mode used in warping functions ::SimdWarpAffineInit and ::SimdWarpPerspectiveInit.
+*/
+typedef enum
+{
+    SimdWarpBorderConstant, /*!< Pixels outside of input image are equal to given constant value. */
+    SimdWarpBorderTransparent, /*!< Output pixels which need any pixel outside of input image are not changed. */
+    SimdWarpBorderReplicate, /*!< Pixels outside of input image are equal to the nearest pixel of input image. */
+} SimdWarpBorderType;
+
+/*! @ingroup yuv_conversion
+    Describes YUV format type (color matrix and range of values). It is used in YUV to BGR conversion functions with V2 suffix.
+*/
+typedef enum
+{
+    SimdYuvUnknown = -1, /*!< Unknown YUV standard. */
+    SimdYuvBt601, /*!< Corresponds to BT.601 standard. Uses Kr=0.299, Kb=0.114. Restricts Y to range [16..235], U and V to [16..240]. */
+    SimdYuvBt709, /*!< Corresponds to BT.709 standard. Uses Kr=0.2126, Kb=0.0722. Restricts Y to range [16..235], U and V to [16..240]. */
+    SimdYuvBt2020, /*!< Corresponds to BT.2020 standard. Uses Kr=0.2627, Kb=0.0593. Restricts Y to range [16..235], U and V to [16..240]. */
+    SimdYuvTrect871, /*!< Corresponds to T-REC-T.871 (JPEG) standard. Uses Kr=0.299, Kb=0.114. Y, U and V use full range [0..255]. */
+} SimdYuvType;
+
 /*! @ingroup synet
     \brief Callback function type "SimdGemm32fNNPtr";
 
@@ -616,7 +669,7 @@ extern "C"
 
         \short Releases context created with using of Simd Library API.
 
-        \note This function releases a context created by functions ::SimdDetectionLoadA and ::SimdDetectionInit.
+        \note This function releases a context created by functions ::SimdDetectionLoadA, ::SimdDetectionLoadBinary and ::SimdDetectionInit.
 
         \param [in] context - a context to be released.
     */    
@@ -638,6 +691,9 @@ extern "C"
 
         \short Sets number of threads used by Simd Library to parallelize some algorithms.
 
+        \note This function also stops extra worker threads of the global thread pool (see Simd::ThreadPool), so it has no more than (threadNumber - 1) workers.
+            New workers are started only when an algorithm needs them. It must not be called concurrently with algorithms which use this pool.
+
         \param [in] threadNumber - a number of threads.
     */
     SIMD_API void SimdSetThreadNumber(size_t threadNumber);
@@ -662,6 +718,64 @@ extern "C"
     */
     SIMD_API void SimdSetFastMode(SimdBool value);
 
+    /*! @ingroup runtime_cache
+
+        \fn SimdBool SimdRuntimeCacheLoad(const char * path);
+
+        \short Loads (preloads) cache of algorithms selected at runtime from file.
+
+        Some algorithms (for example ::SimdSynetConvolution32fForward) time several implementations on their first calls and then use the fastest one.
+        The cache stores these choices. A key of cache entry includes library version, CPU model, thread number and sizes of the task,
+        so a file can be shared by different processes and machines. Loaded entries are added to current content of the cache.
+
+        \param [in] path - a path to cache file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdRuntimeCacheLoad(const char * path);
+
+    /*! @ingroup runtime_cache
+
+        \fn SimdBool SimdRuntimeCacheSave(const char * path);
+
+        \short Saves (exports) cache of algorithms selected at runtime to file. The file can be loaded with using of function ::SimdRuntimeCacheLoad.
+
+        \param [in] path - a path to cache file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdRuntimeCacheSave(const char * path);
+
+    /*! @ingroup runtime_cache
+
+        \fn void SimdRuntimeCacheClear();
+
+        \short Clears (invalidates) cache of algorithms selected at runtime. It does not affect algorithms which have already made their choice.
+    */
+    SIMD_API void SimdRuntimeCacheClear();
+
+    /*! @ingroup runtime_cache
+
+        \fn SimdBool SimdGetTuningMode();
+
+        \short Gets current tuning mode (See function ::SimdSetTuningMode).
+
+        \return current tuning mode.
+    */
+    SIMD_API SimdBool SimdGetTuningMode();
+
+    /*! @ingroup runtime_cache
+
+        \fn void SimdSetTuningMode(SimdBool value);
+
+        \short Sets tuning mode. It is disabled by default.
+
+        In tuning mode some algorithms (for example ::SimdSynetConvolution32fInit) do not choose an implementation with using of fixed heuristics. 
+        Instead of this they measure performance of all suitable implementations during initialization and use the fastest one. 
+        This choice is saved in the runtime cache (See function ::SimdRuntimeCacheSave), so it is made only once for every task size. 
+
+        \param [in] value - a value of tuning mode.
+    */
+    SIMD_API void SimdSetTuningMode(SimdBool value);
+
     /*! @ingroup hash
 
         \fn uint32_t SimdCrc32c(const void * src, size_t size);
@@ -1326,6 +1440,31 @@ extern "C"
     */
     SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to YUV420P with using of given YUV format type.
+
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrapper Simd::BgraToYuv420pV2(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1350,6 +1489,31 @@ extern "C"
     */
     SIMD_API void SimdBgraToYuv422p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to YUV422P with using of given YUV format type.
+
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrapper Simd::BgraToYuv422pV2(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1373,6 +1537,30 @@ extern "C"
     */
     SIMD_API void SimdBgraToYuv444p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to YUV444P with using of given YUV format type.
+
+        The input BGRA and output Y, U and V images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::BgraToYuv444pV2(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the BGRA image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
@@ -1565,6 +1753,31 @@ extern "C"
     */
     SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV420P with using of given YUV format type.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrapper Simd::BgrToYuv420pV2(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1589,6 +1802,31 @@ extern "C"
     */
     SIMD_API void SimdBgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV422P with using of given YUV format type.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrapper Simd::BgrToYuv422pV2(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -1612,6 +1850,30 @@ extern "C"
     */
     SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV444P with using of given YUV format type.
+
+        The input BGR and output Y, U and V images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::BgrToYuv444pV2(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the BGR image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
     /*! @ingroup binarization
 
         \fn void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
@@ -1999,6 +2261,36 @@ extern "C"
     */
     SIMD_API void * SimdDetectionLoadA(const char * path);
 
+    /*! @ingroup object_detection
+
+        \fn SimdBool SimdDetectionSaveBinary(const void * data, const char * path);
+
+        \short Saves a loaded classifier cascade to file in binary format.
+
+        The binary format is versioned and contains arrays of cascade aligned to 64 bytes.
+        It depends on the platform (byte order and structure layout), so it must be created by the same build of Simd Library which loads it.
+        Loading of binary cascade (see ::SimdDetectionLoadBinary) does not need XML parsing and is much faster than ::SimdDetectionLoadA.
+
+        \param [in] data - a pointer to cascade which was received with using of function ::SimdDetectionLoadA or ::SimdDetectionLoadBinary.
+        \param [in] path - a path to output file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdDetectionSaveBinary(const void * data, const char * path);
+
+    /*! @ingroup object_detection
+
+        \fn void * SimdDetectionLoadBinary(const char * path);
+
+        \short Loads a classifier cascade from file in binary format (see ::SimdDetectionSaveBinary).
+
+        \note This function is used for implementation of Simd::Detection.
+
+        \param [in] path - a path to binary cascade.
+        \return a pointer to loaded cascade. On error (including version mismatch) it returns NULL.
+                This pointer is used in functions ::SimdDetectionInfo and ::SimdDetectionInit, and must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdDetectionLoadBinary(const char * path);
+
     /*! @ingroup object_detection
 
         \fn void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags);
@@ -2059,13 +2351,33 @@ extern "C"
     */
     SIMD_API void SimdDetectionPrepare(void * hid);
 
+    /*! @ingroup object_detection
+
+        \fn void SimdDetectionPrepareRegion(void * hid, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom);
+
+        \short Prepares hidden classifier cascade structure to work with given region of input 8-bit gray image.
+
+        It is an analogue of function ::SimdDetectionPrepare which processes only given region of integral images.
+        To detect objects in rectangle [left, right) x [top, bottom) of window positions the region must be 
+        [left, right + width + 1) x [top, bottom + height + 1), where width and height are size of cascade window (see ::SimdDetectionInfo).
+
+        \note This function is used for implementation of Simd::Detection.
+
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] left - a left side of the region of integral images.
+        \param [in] top - a top side of the region of integral images.
+        \param [in] right - a right side of the region of integral images. It is restricted by width of integral images.
+        \param [in] bottom - a bottom side of the region of integral images. It is restricted by height of integral images.
+    */
+    SIMD_API void SimdDetectionPrepareRegion(void * hid, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom);
+
     /*! @ingroup object_detection
 
         \fn void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask, size_t maskStride, ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
         \short Performs object detection with using of HAAR cascade classifier (uses 32-bit float numbers, processes all points).
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
+        You must call function ::SimdDetectionPrepare (or ::SimdDetectionPrepareRegion) before calling of this functions.
         All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
         \note This function is used for implementation of Simd::Detection.
@@ -2089,7 +2401,7 @@ extern "C"
 
         \short Performs object detection with using of HAAR cascade classifier (uses 32-bit float numbers, processes only even points).
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
+        You must call function ::SimdDetectionPrepare (or ::SimdDetectionPrepareRegion) before calling of this functions.
         All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
         \note This function is used for implementation of Simd::Detection.
@@ -2113,7 +2425,7 @@ extern "C"
 
         \short Performs object detection with using of LBP cascade classifier (uses 32-bit float numbers, processes all points).
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
+        You must call function ::SimdDetectionPrepare (or ::SimdDetectionPrepareRegion) before calling of this functions.
         All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
         \note This function is used for implementation of Simd::Detection.
@@ -2137,7 +2449,7 @@ extern "C"
 
         \short Performs object detection with using of LBP cascade classifier (uses 32-bit float numbers, processes only even points).
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
+        You must call function ::SimdDetectionPrepare (or ::SimdDetectionPrepareRegion) before calling of this functions.
         All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
         \note This function is used for implementation of Simd::Detection.
@@ -2161,7 +2473,7 @@ extern "C"
 
         \short Performs object detection with using of LBP cascade classifier (uses 16-bit integer numbers, processes all points).
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
+        You must call function ::SimdDetectionPrepare (or ::SimdDetectionPrepareRegion) before calling of this functions.
         All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
         \note This function is used for implementation of Simd::Detection.
@@ -2185,7 +2497,7 @@ extern "C"
 
         \short Performs object detection with using of LBP cascade classifier (uses 16-bit integer numbers, processes only even points).
 
-        You must call function ::SimdDetectionPrepare before calling of this functions.
+        You must call function ::SimdDetectionPrepare (or ::SimdDetectionPrepareRegion) before calling of this functions.
         All restriction (input mask and bounding box) affects to left-top corner of scanning window.
 
         \note This function is used for implementation of Simd::Detection.
@@ -4368,6 +4680,106 @@ extern "C"
     */
     SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input interleaved UV plane must have half height and the same row length in bytes as Y plane (it contains width/2 UV pairs).
+        The UV plane is read directly without separation into temporary U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit BGR image with using of given YUV format type.
+
+        The input Y and output BGR images must have the same width and height.
+        The input interleaved UV plane must have half height and the same row length in bytes as Y plane (it contains width/2 UV pairs).
+        The UV plane is read directly without separation into temporary U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgrV2(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input interleaved UV plane must have half height and the same row length in bytes as Y plane (it contains width/2 UV pairs).
+        The UV plane is read directly without separation into temporary U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+    */
+    SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit BGRA image with using of given YUV format type.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input interleaved UV plane must have half height and the same row length in bytes as Y plane (it contains width/2 UV pairs).
+        The UV plane is read directly without separation into temporary U and V planes.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgraV2(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color plane.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup operation
 
         \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
@@ -4684,6 +5096,8 @@ extern "C"
 
         \short Creates resize context.
 
+        \note Tensors in NCHW format can be resized with using of context with 1 channel: function ::SimdResizerRun has to be called for every channel plane.
+
         \param [in] srcX - a width of the input image.
         \param [in] srcY - a height of the input image.
         \param [in] dstX - a width of the output image.
@@ -4711,6 +5125,49 @@ extern "C"
     */
     SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        \short Creates resize context for streaming (stripe by stripe) image resizing.
+
+        Input image rows are passed to function ::SimdResizerStreamRun by stripes of arbitrary height.
+        The context stores only horizontally resized rows which are needed for vertical filtering of current output rows.
+        The output is equal to output of function ::SimdResizerRun except for 8-bit bilinear resizing: it uses more precise
+        filter weights here, so the difference can reach several units.
+
+        \param [in] srcX - a width of the input image.
+        \param [in] srcY - a height of the input image.
+        \param [in] dstX - a width of the output image.
+        \param [in] dstY - a height of the output image.
+        \param [in] channels - a channel number of input and output image.
+        \param [in] type - a type of input and output image channel. It can be ::SimdResizeChannelByte or ::SimdResizeChannelFloat.
+        \param [in] method - a method used in order to resize image. It can be ::SimdResizeMethodBilinear, ::SimdResizeMethodBicubic or ::SimdResizeMethodLanczos3.
+        \return a pointer to resize context. On error or for unsupported type or method it returns NULL. 
+                This pointer is used in function ::SimdResizerStreamRun. 
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn size_t SimdResizerStreamRun(void * resizer, const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride);
+
+        \short Passes next rows of input image to streaming resize context and writes all output rows which can be finished.
+
+        Input rows must be passed in order from the top of image. Output rows are written in order starting from (dst). 
+        After the last row of input image the context is ready to process the next image.
+
+        \param [in, out] resizer - a resize context. It must be created by function ::SimdResizerStreamInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the next rows of input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] srcRows - a number of passed input rows.
+        \param [out] dst - a pointer to the first output row which was not written yet.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+        \return a number of written output rows.
+    */
+    SIMD_API size_t SimdResizerStreamRun(void * resizer, const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup segmentation
 
         \fn void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
@@ -5508,6 +5965,9 @@ extern "C"
 
         \short Initilizes FP32 convolution algorithm.
 
+        \note In tuning mode (See function ::SimdSetTuningMode) the fastest implementation is chosen in function ::SimdSynetConvolution32fSetParams. 
+            So the size of external buffer (See function ::SimdSynetConvolution32fExternalBufferSize) can be decreased after this call.
+
         \param [in] batch - a batch size.
         \param [in] conv - a pointer to convolution parameters.
         \param [in] gemm - a pointer to external function of matrix multiplication. Can be NULL.
@@ -5522,6 +5982,8 @@ extern "C"
 
         \short Gets size of external temporary buffer required for FP32 convolution algorithm.
 
+        \note The size includes memory which is required by epilogue (see function ::SimdSynetConvolution32fSetEpilogue), so it has to be requested after the epilogue is set.
+
         \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
         \return size of external temporary buffer required for FP32 convolution algorithm.
     */
@@ -5552,6 +6014,32 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fSetParams(void * context, const float * weight, SimdBool * internal, const float * bias, const float * params);
 
+    /*! @ingroup synet_convolution
+
+        \fn void SimdSynetConvolution32fSetEpilogue(void * context, const float * scale, const float * shift, SimdBool pool, SimdBool add);
+
+        \short Sets an epilogue which is fused into FP32 convolution algorithm.
+
+        The epilogue is applied to output of convolution (after bias and activation function) in function ::SimdSynetConvolution32fForward:
+        \verbatim
+        y = conv(x)*scale[c] + shift[c];
+        if(pool)
+            y = MaxPool(y, kernel = 2x2, stride = 2x2, pad = 0); // output size is ((dstH + 1)/2)x((dstW + 1)/2).
+        dst = add ? dst + y : y;
+        \endverbatim
+
+        \note Direct NHWC implementations apply the epilogue to cache-sized blocks of output rows, so intermediate result of convolution is not stored in memory.
+            Other implementations are not fused: they store full result of convolution and then apply the epilogue in a separate pass.
+            In both cases temporary memory is taken from external buffer, its size is returned by function ::SimdSynetConvolution32fExternalBufferSize.
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] scale - a pointer to per-channel scale (size is dstC). Can be NULL.
+        \param [in] shift - a pointer to per-channel shift (size is dstC). Can be NULL.
+        \param [in] pool - a flag of 2x2 max pooling with stride 2.
+        \param [in] add - a flag of addition of result to existing content of output tensor (residual connection).
+    */
+    SIMD_API void SimdSynetConvolution32fSetEpilogue(void * context, const float * scale, const float * shift, SimdBool pool, SimdBool add);
+
     /*! @ingroup synet_convolution
 
         \fn void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
@@ -5572,7 +6060,8 @@ extern "C"
         \short Initilizes INT8 convolution algorithm.
 
         \param [in] batch - a batch size.
-        \param [in] conv - a pointer to convolution parameters.
+        \param [in] conv - a pointer to convolution parameters. Only ::SimdTensorFormatNhwc format is supported.
+            Input and output tensors can be 8-bit unsigned integer (::SimdTensorData8u) or 32-bit float point (::SimdTensorData32f).
         \return a pointer to INT8 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
             This pointer is used in functions ::SimdSynetConvolution8iExternalBufferSize, ::SimdSynetConvolution8iInternalBufferSize, ::SimdSynetConvolution8iSetParams and ::SimdSynetConvolution8iForward.
     */
@@ -5602,7 +6091,7 @@ extern "C"
 
     /*! @ingroup synet_convolution
 
-        \fn void SimdSynetConvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const stats);
+        \fn void SimdSynetConvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const * stats);
 
         \short Sets weights, beases, parameters of activation function, input/output tensor statistics required for INT8 convolution algorithm.
 
@@ -5611,8 +6100,10 @@ extern "C"
         \param [in] bias - a pointer to original (32-bit float point) bias. Can be NULL.
         \param [in] params - a pointer to original (32-bit float point) parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
         \param [in] stats - a pointer to pointers with statistics of input(min - stats[0], max - stats[1]) and output(min - stats[2], max - stats[3]) tensors.
+            Input statistics have size srcC, output statistics have size dstC. They set per-channel 8-bit quantization of input and output tensors.
+            Can be NULL (then 8-bit tensors are treated as values in range [0..255]).
     */
-    SIMD_API void SimdSynetConvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const stats);
+    SIMD_API void SimdSynetConvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const * stats);
 
     /*! @ingroup synet_convolution
 
@@ -5627,6 +6118,55 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
 
+    /*! @ingroup synet
+
+        \fn void * SimdSynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale);
+
+        \short Creates a context of batched cropping and resizing of regions of interest (ROI) of input image to output tensor.
+
+        Every ROI is cropped from the input image, resized with using of bilinear method (see ::SimdResizeMethodBilinear) and stored 
+        as a separate item of the output batch. For 32-bit float output tensor the values are normalized:
+        \verbatim
+        dst[i, c, y, x] = (Resize(Crop(src, rois[i]))[c, y, x] - mean[c])*scale[c];
+        \endverbatim
+        8-bit unsigned integer output tensor contains rounded resized values without normalization.
+        If keepAspect is ::SimdTrue then every ROI is resized with preserving of its aspect ratio, centered and the rest of the output item is filled by zeros.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>. The context must be released with using of function ::SimdRelease.
+
+        \param [in] channels - a number of channels of the input image and of the output tensor. It can be 1, 2, 3 or 4.
+        \param [in] dstWidth - a width of the output tensor.
+        \param [in] dstHeight - a height of the output tensor.
+        \param [in] dstFormat - a format of the output tensor. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+        \param [in] dstType - a type of the output tensor. It can be ::SimdTensorData32f or ::SimdTensorData8u.
+        \param [in] keepAspect - a flag of preserving of aspect ratio of the ROIs.
+        \param [in] mean - a pointer to the array with mean values for every channel. Its size is equal to channels. Can be NULL (zero mean).
+        \param [in] scale - a pointer to the array with scale values for every channel. Its size is equal to channels. Can be NULL (unit scale).
+        \return a pointer to the context. On error it returns NULL.
+    */
+    SIMD_API void * SimdSynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetCropResizeRun(const void * context, const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const ptrdiff_t * rois, size_t count, uint8_t * dst);
+
+        \short Performs batched cropping and resizing of regions of interest (ROI) of input image to output tensor.
+
+        The ROIs are distributed between threads (see ::SimdSetThreadNumber). ROIs are clipped by the input image bounds, an empty ROI gives zero output item.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>. The context must be created by function ::SimdSynetCropResizeInit.
+
+        \param [in] context - a pointer to the context created by function ::SimdSynetCropResizeInit.
+        \param [in] src - a pointer to pixels data of the input image (with interleaved channels).
+        \param [in] srcStride - a row size of the input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] rois - a pointer to the array with ROIs. Every ROI is described by 4 values (left, top, right, bottom). Its size is equal to 4*count.
+        \param [in] count - a number of ROIs.
+        \param [out] dst - a pointer to the output tensor. Its size is equal to count*channels*dstHeight*dstWidth elements of dstType.
+    */
+    SIMD_API void SimdSynetCropResizeRun(const void * context, const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const ptrdiff_t * rois, size_t count, uint8_t * dst);
+
     /*! @ingroup synet
 
         \fn void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
@@ -5980,6 +6520,49 @@ extern "C"
     */
     SIMD_API void SimdSynetFusedLayerForward9(const float * src0, const float * src1, const float * scale, const float * bias, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format);
 
+    /*! @ingroup synet
+
+        \fn void * SimdSynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat);
+
+        \short Creates a context of fused conversion of input image (frame) to 32-bit float input tensor.
+
+        The conversion includes color conversion, bilinear resizing (see ::SimdResizeMethodBilinear) and normalization of pixel values:
+        \verbatim
+        dst[c, y, x] = (Resize(Convert(src))[c, y, x] - mean[c])*scale[c];
+        \endverbatim
+        The source image is processed row by row, so intermediate images are not stored in memory.
+        Color images are converted to BGR channel order, gray images are replicated (if dstChannels is 3), color images are converted to gray (if dstChannels is 1).
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>. The context must be released with using of function ::SimdRelease.
+
+        \param [in] srcWidth - a width of the input image. It must be even for NV12 and YUV420P formats.
+        \param [in] srcHeight - a height of the input image. It must be even for NV12 and YUV420P formats.
+        \param [in] srcFormat - a pixel format of the input image.
+        \param [in] dstWidth - a width of the output tensor.
+        \param [in] dstHeight - a height of the output tensor.
+        \param [in] dstChannels - a number of channels of the output tensor. It can be 1 or 3.
+        \param [in] mean - a pointer to the array with mean values for every channel. Its size is equal to dstChannels. Can be NULL (zero mean).
+        \param [in] scale - a pointer to the array with scale values for every channel. Its size is equal to dstChannels. Can be NULL (unit scale).
+        \param [in] dstFormat - a format of the output tensor. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+        \return a pointer to the context. On error it returns NULL.
+    */
+    SIMD_API void * SimdSynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat);
+
+    /*! @ingroup synet
+
+        \fn void SimdSynetImageToTensorRun(const void * context, const uint8_t * const * src, const size_t * srcStride, float * dst);
+
+        \short Performs fused conversion of input image (frame) to 32-bit float input tensor.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>. The context must be created by function ::SimdSynetImageToTensorInit.
+
+        \param [in] context - a pointer to the context created by function ::SimdSynetImageToTensorInit.
+        \param [in] src - a pointer to the array with pointers to image planes (1 plane for BGRA32, BGR24, Gray8, 2 planes for NV12, 3 planes for YUV420P).
+        \param [in] srcStride - a pointer to the array with row sizes of image planes.
+        \param [out] dst - a pointer to the output 32-bit float tensor. Its size is equal to dstChannels*dstHeight*dstWidth.
+    */
+    SIMD_API void SimdSynetImageToTensorRun(const void * context, const uint8_t * const * src, const size_t * srcStride, float * dst);
+
     /*! @ingroup synet
 
         \fn void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
@@ -6045,9 +6628,12 @@ extern "C"
 
         \short Initilizes FP32 merged convolution algorithm.
 
+        \note Supported merged convolutions: input convolution (kernel 1x1 or 3x3), depthwise convolution (kernel 3x3 or 5x5, optional dilation) and output convolution (kernel 1x1) 
+            or depthwise and output convolutions only (count = 2). All tensors must have NHWC format. 
+
         \param [in] batch - a batch size.
         \param [in] convs - an array with convolutions parameters.
-        \param [in] count - a number of merged convolutions.
+        \param [in] count - a number of merged convolutions (2 or 3).
         \param [in] add - a flag that signilizes if we need to add output to source value.
         \return a pointer to FP32 merged convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
             This pointer is used in functions ::SimdSynetMergedConvolution32fExternalBufferSize, ::SimdSynetMergedConvolution32fInternalBufferSize, ::SimdSynetMergedConvolution32fSetParams and ::SimdSynetMergedConvolution32fForward.
@@ -6379,6 +6965,81 @@ extern "C"
     */
     SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup transform
+
+        \fn void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+
+        \short Creates warp context for affine transformation of image with using of bilinear interpolation.
+
+        Affine matrix (mat) maps coordinates of input image to coordinates of output image:
+        \verbatim
+        dstX = mat[0]*srcX + mat[1]*srcY + mat[2];
+        dstY = mat[3]*srcX + mat[4]*srcY + mat[5];
+        \endverbatim
+        Coordinates of pixel centers are integer. Source coordinates are estimated with precision 1/1024 of pixel.
+
+        \note This function has a C++ wrappers: Simd::WarpAffine(const View<A> & src, const float * mat, View<A> & dst, ::SimdWarpBorderType border, const uint8_t * value).
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] channels - a channel number of input and output image. It can be 1, 2, 3 or 4.
+        \param [in] type - a type of input and output image channel. It can be ::SimdResizeChannelByte or ::SimdResizeChannelFloat.
+        \param [in] mat - a pointer to 2x3 matrix of affine transformation.
+        \param [in] border - a type of border mode.
+        \param [in] value - a pointer to pixel value which is used for ::SimdWarpBorderConstant border mode. Its size must be equal to channels*sizeof(channel type). Can be NULL (zero value is used).
+        \return a pointer to warp context. On error it returns NULL (for example if the matrix is degenerate).
+                This pointer is used in function ::SimdWarpRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+
+    /*! @ingroup transform
+
+        \fn void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+
+        \short Creates warp context for perspective transformation of image with using of bilinear interpolation.
+
+        Perspective matrix (mat) maps coordinates of input image to coordinates of output image:
+        \verbatim
+        w = mat[6]*srcX + mat[7]*srcY + mat[8];
+        dstX = (mat[0]*srcX + mat[1]*srcY + mat[2])/w;
+        dstY = (mat[3]*srcX + mat[4]*srcY + mat[5])/w;
+        \endverbatim
+        Coordinates of pixel centers are integer. Source coordinates are estimated with precision 1/1024 of pixel.
+
+        \note This function has a C++ wrappers: Simd::WarpPerspective(const View<A> & src, const float * mat, View<A> & dst, ::SimdWarpBorderType border, const uint8_t * value).
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] channels - a channel number of input and output image. It can be 1, 2, 3 or 4.
+        \param [in] type - a type of input and output image channel. It can be ::SimdResizeChannelByte or ::SimdResizeChannelFloat.
+        \param [in] mat - a pointer to 3x3 matrix of perspective transformation.
+        \param [in] border - a type of border mode.
+        \param [in] value - a pointer to pixel value which is used for ::SimdWarpBorderConstant border mode. Its size must be equal to channels*sizeof(channel type). Can be NULL (zero value is used).
+        \return a pointer to warp context. On error it returns NULL (for example if the matrix is degenerate).
+                This pointer is used in function ::SimdWarpRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+
+    /*! @ingroup transform
+
+        \fn void SimdWarpRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs warping of image.
+
+        \param [in] context - a warp context. It must be created by function ::SimdWarpAffineInit or ::SimdWarpPerspectiveInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdWarpRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup synet
 
         \fn void SimdWinograd2x3SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
@@ -6612,6 +7273,32 @@ extern "C"
     SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV422P image to 24-bit BGR image with using of given YUV format type.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv422pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
@@ -6636,6 +7323,57 @@ extern "C"
     SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 24-bit BGR image with using of given YUV format type.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv420pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 24-bit BGR image with using of given YUV format type.
+
+        The input Y, U, V and output BGR images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -6688,6 +7426,33 @@ extern "C"
     SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV422P image to 32-bit BGRA image with using of given YUV format type.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv422pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv422pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -6713,6 +7478,59 @@ extern "C"
     SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
         size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 32-bit BGRA image with using of given YUV format type.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function has a C++ wrappers: Simd::Yuv420pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV444P image to 32-bit BGRA image with using of given YUV format type.
+
+        The input Y, U, V and output BGRA images must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::Yuv444pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * hsl, size_t hslStride);
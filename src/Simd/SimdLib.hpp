@@ -714,6 +714,33 @@ namespace Simd
         SimdBgraToYuv420p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
     }
 
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToYuv420pV2(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 32-bit BGRA image to YUV420P with using of given YUV format type.
+
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv420pV2.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToYuv420pV2(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToYuv420pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToYuv422p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
@@ -740,6 +767,33 @@ namespace Simd
         SimdBgraToYuv422p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
     }
 
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToYuv422pV2(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 32-bit BGRA image to YUV422P with using of given YUV format type.
+
+        The input BGRA and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv422pV2.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToYuv422pV2(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToYuv422pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToYuv444p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
@@ -763,6 +817,30 @@ namespace Simd
         SimdBgraToYuv444p(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
     }
 
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToYuv444pV2(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 32-bit BGRA image to YUV444P with using of given YUV format type.
+
+        The input BGRA and output Y, U and V images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgraToYuv444pV2.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToYuv444pV2(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(bgra, y) && Compatible(y, u, v));
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToYuv444pV2(bgra.data, bgra.width, bgra.height, bgra.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToYuva420p(const View<A> & bgra, View<A> & y, View<A> & u, View<A> & v, View<A> & a)
@@ -961,6 +1039,33 @@ namespace Simd
         SimdBgrToYuv420p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
     }
 
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToYuv420pV2(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 24-bit BGR image to YUV420P with using of given YUV format type.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv420pV2.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToYuv420pV2(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToYuv420pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
     /*! @ingroup bgr_conversion
 
         \fn void BgrToYuv422p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
@@ -987,6 +1092,33 @@ namespace Simd
         SimdBgrToYuv422p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
     }
 
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToYuv422pV2(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 24-bit BGR image to YUV422P with using of given YUV format type.
+
+        The input BGR and output Y images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv422pV2.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToYuv422pV2(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToYuv422pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
     /*! @ingroup bgr_conversion
 
         \fn void BgrToYuv444p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
@@ -1010,6 +1142,30 @@ namespace Simd
         SimdBgrToYuv444p(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
     }
 
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToYuv444pV2(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 24-bit BGR image to YUV444P with using of given YUV format type.
+
+        The input BGR and output Y, U and V images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToYuv444pV2.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] u - an output 8-bit image with U color plane.
+        \param [out] v - an output 8-bit image with V color plane.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToYuv444pV2(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(bgr, y) && Compatible(y, u, v));
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToYuv444pV2(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+    }
+
     /*! @ingroup binarization
 
         \fn void Binarization(const View<A>& src, uint8_t value, uint8_t positive, uint8_t negative, View<A>& dst, SimdCompareType compareType)
@@ -2471,6 +2627,106 @@ namespace Simd
         SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgrV2(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit BGR image with using of given YUV format type.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgrV2(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgrV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgraV2(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 32-bit BGRA image with using of given YUV format type.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half size relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgraV2(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && uv.format == View<A>::Uv16);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgraV2(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
     /*! @ingroup operation
 
         \fn void OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type)
@@ -2706,6 +2962,112 @@ namespace Simd
         SimdReduceColor2x2(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, src.ChannelCount());
     }
 
+    /*! @ingroup resizing
+
+        \short Cache of resizer contexts.
+
+        Creation of resizer context (see function ::SimdResizerInit) includes estimation of index and alpha tables and allocation of buffers.
+        The cache keeps created contexts (with least recently used replacement) and reuses them in next calls with the same parameters.
+        Resizer context is not reentrant, so every thread has its own cache (see function ResizerCache::Thread). It is used in function Simd::Resize.
+
+        \note The cache of a thread keeps up to 16 resizer contexts (with their buffers) until the thread exits.
+              Call ResizerCache::Thread().Clear() to release them earlier.
+    */
+    class ResizerCache
+    {
+    public:
+        /*!
+            Creates a new cache.
+
+            \param [in] capacity - a maximal number of stored resizer contexts. By default it is equal to 16.
+        */
+        ResizerCache(size_t capacity = 16)
+            : _capacity(capacity)
+        {
+        }
+
+        /*!
+            Releases all stored resizer contexts.
+        */
+        ~ResizerCache()
+        {
+            Clear();
+        }
+
+        /*!
+            Gets resizer context with given parameters (see function ::SimdResizerInit). It is created if the cache does not contain it.
+
+            \param [in] srcX - a width of the input image.
+            \param [in] srcY - a height of the input image.
+            \param [in] dstX - a width of the output image.
+            \param [in] dstY - a height of the output image.
+            \param [in] channels - a channel number of input and output image.
+            \param [in] type - a type of input and output image channel.
+            \param [in] method - a method used in order to resize image.
+            \return a pointer to resizer context. On error it returns NULL. The context is owned by the cache and must not be released.
+        */
+        void * Get(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            for (size_t i = 0; i < _items.size(); ++i)
+            {
+                const Item & item = _items[i];
+                if (item.srcX == srcX && item.srcY == srcY && item.dstX == dstX && item.dstY == dstY && 
+                    item.channels == channels && item.type == type && item.method == method)
+                {
+                    std::rotate(_items.begin(), _items.begin() + i, _items.begin() + i + 1);
+                    return _items[0].context;
+                }
+            }
+            void * context = SimdResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+            if (context)
+            {
+                if (_items.size() >= _capacity)
+                {
+                    SimdRelease(_items.back().context);
+                    _items.pop_back();
+                }
+                Item item = { srcX, srcY, dstX, dstY, channels, type, method, context };
+                _items.insert(_items.begin(), item);
+            }
+            return context;
+        }
+
+        /*!
+            Releases all stored resizer contexts.
+        */
+        void Clear()
+        {
+            for (size_t i = 0; i < _items.size(); ++i)
+                SimdRelease(_items[i].context);
+            _items.clear();
+        }
+
+        /*!
+            Gets cache of current thread.
+
+            \return a reference to cache of current thread.
+        */
+        static ResizerCache & Thread()
+        {
+            static thread_local ResizerCache cache;
+            return cache;
+        }
+
+    private:
+        struct Item
+        {
+            size_t srcX, srcY, dstX, dstY, channels;
+            SimdResizeChannelType type;
+            SimdResizeMethodType method;
+            void * context;
+        };
+        std::vector<Item> _items;
+        size_t _capacity;
+
+        ResizerCache(const ResizerCache &);
+        ResizerCache & operator = (const ResizerCache &);
+    };
+
     /*! @ingroup resizing
 
         \fn void ResizeBilinear(const View<A>& src, View<A>& dst)
@@ -2819,7 +3181,9 @@ namespace Simd
 
         \short Performs resizing of image.
 
-        All images must have the same format.
+        All images must have the same format. Images in View::Int16 format are processed as 16-bit unsigned integer images (see ::SimdResizeChannelShort).
+
+        \note This function reuses resizer context from the cache of current thread (see Simd::ResizerCache).
 
         \param [in] src - an original input image.
         \param [out] dst - a resized output image.
@@ -2827,7 +3191,7 @@ namespace Simd
     */
     template<template<class> class A> SIMD_INLINE void Resize(const View<A> & src, View<A> & dst, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear)
     {
-        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1));
+        assert(src.format == dst.format && (src.format == View<A>::Float || src.format == View<A>::Int16 || src.ChannelSize() == 1));
 
         if (EqualSize(src, dst))
         {
@@ -2835,13 +3199,14 @@ namespace Simd
         }
         else
         {
-            SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : SimdResizeChannelByte;
-            void * resizer = SimdResizerInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, method);
+            SimdResizeChannelType type = SimdResizeChannelByte;
+            if (src.format == View<A>::Float)
+                type = SimdResizeChannelFloat;
+            else if (src.format == View<A>::Int16)
+                type = SimdResizeChannelShort;
+            void * resizer = ResizerCache::Thread().Get(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, method);
             if (resizer)
-            {
                 SimdResizerRun(resizer, src.data, src.stride, dst.data, dst.stride);
-                SimdRelease(resizer);
-            }
             else
                 assert(0);
         }
@@ -3530,6 +3895,45 @@ namespace Simd
         SimdStretchGray2x2(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride);
     }
 
+    /*! @ingroup synet
+
+        \fn void SynetCropResize(const View<A> & src, const std::vector<Rectangle<ptrdiff_t>> & rois, size_t width, size_t height, const float * mean, const float * scale, float * dst, SimdTensorFormatType format = SimdTensorFormatNchw, bool keepAspect = false)
+
+        \short Performs batched cropping and resizing of regions of interest (ROI) of input image to 32-bit float output tensor.
+
+        \note This function is a C++ wrapper for functions ::SimdSynetCropResizeInit and ::SimdSynetCropResizeRun.
+
+        \param [in] src - an input image (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        \param [in] rois - a list of ROIs.
+        \param [in] width - a width of the output tensor.
+        \param [in] height - a height of the output tensor.
+        \param [in] mean - a pointer to the array with mean values for every channel. Can be NULL (zero mean).
+        \param [in] scale - a pointer to the array with scale values for every channel. Can be NULL (unit scale).
+        \param [out] dst - a pointer to the output 32-bit float tensor. Its size is equal to rois.size()*channels*height*width.
+        \param [in] format - a format of the output tensor. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc. By default it is equal to ::SimdTensorFormatNchw.
+        \param [in] keepAspect - a flag of preserving of aspect ratio of the ROIs. By default it is equal to false.
+    */
+    template<template<class> class A> SIMD_INLINE void SynetCropResize(const View<A> & src, const std::vector<Rectangle<ptrdiff_t>> & rois, size_t width, size_t height,
+        const float * mean, const float * scale, float * dst, SimdTensorFormatType format = SimdTensorFormatNchw, bool keepAspect = false)
+    {
+        assert(src.format == View<A>::Gray8 || src.format == View<A>::Uv16 || src.format == View<A>::Bgr24 || src.format == View<A>::Bgra32);
+
+        std::vector<ptrdiff_t> coords(rois.size() * 4);
+        for (size_t i = 0; i < rois.size(); ++i)
+        {
+            coords[i * 4 + 0] = rois[i].left;
+            coords[i * 4 + 1] = rois[i].top;
+            coords[i * 4 + 2] = rois[i].right;
+            coords[i * 4 + 3] = rois[i].bottom;
+        }
+        void * context = SimdSynetCropResizeInit(src.ChannelCount(), width, height, format, SimdTensorData32f, keepAspect ? SimdTrue : SimdFalse, mean, scale);
+        if (context)
+        {
+            SimdSynetCropResizeRun(context, src.data, src.stride, src.width, src.height, coords.data(), rois.size(), (uint8_t*)dst);
+            SimdRelease(context);
+        }
+    }
+
     /*! @ingroup texture_estimation
 
         \fn void TextureBoostedSaturatedGradient(const View<A>& src, uint8_t saturation, uint8_t boost, View<A>& dx, View<A>& dy)
@@ -3694,6 +4098,68 @@ namespace Simd
         SimdTransformImage(src.data, src.stride, src.width, src.height, src.PixelSize(), transform, dst.data, dst.stride);
     }
 
+    /*! @ingroup transform
+
+        \fn void WarpAffine(const View<A> & src, const float * mat, View<A> & dst, ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL);
+
+        \short Performs affine transformation of input image with using of bilinear interpolation.
+
+        Input and output images must have the same format: 8-bit per channel (1-4 channels) or 32-bit float.
+
+        \note This function is a C++ wrapper for functions ::SimdWarpAffineInit and ::SimdWarpRun.
+
+        \param [in] src - an input image.
+        \param [in] mat - a pointer to 2x3 matrix of affine transformation which maps input image coordinates to output image coordinates.
+        \param [out] dst - an output image.
+        \param [in] border - a type of border mode. By default it is equal to ::SimdWarpBorderConstant.
+        \param [in] value - a pointer to border pixel value for ::SimdWarpBorderConstant mode. By default it is NULL (zero value).
+    */
+    template<template<class> class A> SIMD_INLINE void WarpAffine(const View<A> & src, const float * mat, View<A> & dst, ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL)
+    {
+        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1));
+
+        SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : SimdResizeChannelByte;
+        void * context = SimdWarpAffineInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, mat, border, value);
+        if (context)
+        {
+            SimdWarpRun(context, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(context);
+        }
+        else
+            assert(0);
+    }
+
+    /*! @ingroup transform
+
+        \fn void WarpPerspective(const View<A> & src, const float * mat, View<A> & dst, ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL);
+
+        \short Performs perspective transformation of input image with using of bilinear interpolation.
+
+        Input and output images must have the same format: 8-bit per channel (1-4 channels) or 32-bit float.
+
+        \note This function is a C++ wrapper for functions ::SimdWarpPerspectiveInit and ::SimdWarpRun.
+
+        \param [in] src - an input image.
+        \param [in] mat - a pointer to 3x3 matrix of perspective transformation which maps input image coordinates to output image coordinates.
+        \param [out] dst - an output image.
+        \param [in] border - a type of border mode. By default it is equal to ::SimdWarpBorderConstant.
+        \param [in] value - a pointer to border pixel value for ::SimdWarpBorderConstant mode. By default it is NULL (zero value).
+    */
+    template<template<class> class A> SIMD_INLINE void WarpPerspective(const View<A> & src, const float * mat, View<A> & dst, ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL)
+    {
+        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1));
+
+        SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : SimdResizeChannelByte;
+        void * context = SimdWarpPerspectiveInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, mat, border, value);
+        if (context)
+        {
+            SimdWarpRun(context, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(context);
+        }
+        else
+            assert(0);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuva420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, const View<A>& a, View<A>& bgra)
@@ -3773,6 +4239,33 @@ namespace Simd
         SimdYuv422pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv422pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV422P image to 24-bit BGR image with using of given YUV format type.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv422pToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv422pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
@@ -3795,6 +4288,56 @@ namespace Simd
         SimdYuv444pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV420P image to 24-bit BGR image with using of given YUV format type.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420pToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgr.width && y.height == bgr.height);
+        assert(y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv420pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV444P image to 24-bit BGR image with using of given YUV format type.
+
+        The input Y, U, V and output BGR images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToBgrV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgrV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, bgr) && y.format == View<A>::Gray8 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv444pToBgrV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
@@ -3849,6 +4392,34 @@ namespace Simd
         SimdYuv422pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv422pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV422P image to 32-bit BGRA image with using of given YUV format type.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (their width is equal to half width of Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv422pToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv422pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv422pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF)
@@ -3872,6 +4443,58 @@ namespace Simd
         SimdYuv444pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV420P image to 32-bit BGRA image with using of given YUV format type.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420pToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.width == bgra.width && y.height == bgra.height);
+        assert(y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv420pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV444P image to 32-bit BGRA image with using of given YUV format type.
+
+        The input Y, U, V and output BGRA images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444pToBgraV2.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane.
+        \param [in] v - an input 8-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType). By default it is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444pToBgraV2(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(Compatible(y, u, v) && EqualSize(y, bgra) && y.format == View<A>::Gray8 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv444pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv444pToHsl(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& hsl)
@@ -4068,20 +4691,77 @@ namespace Simd
             Simd::Copy(src.At(level), dst.At(level));
     }
 
+    /*! @ingroup cpp_pyramid_functions
+
+        \fn void BuildRows(Pyramid<A> & pyramid, size_t begin, size_t end, ::SimdReduceType reduceType, bool compensation = true)
+
+        \short Updates upper levels of the pyramid after filling of next horizontal stripe of the lowest level.
+
+        Rows of upper levels are reduced as soon as all rows of previous level they depend on are ready. 
+        So the pyramid can be built in one streaming pass over the lowest level (for example, during conversion of a frame to gray).
+        Stripes have to be passed in order: the first stripe begins from 0, every next stripe begins from the end of previous one.
+        After passing of the last stripe the result is the same as after level-by-level reducing.
+
+        \param [in, out] pyramid - a pyramid.
+        \param [in] begin - a first row of the stripe of the lowest level.
+        \param [in] end - a row after the last row of the stripe of the lowest level.
+        \param [in] reduceType - a type of function used for image reducing.
+        \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5. It is equal to 'true' by default.
+    */
+    template<template<class> class A> SIMD_INLINE void BuildRows(Pyramid<A> & pyramid, size_t begin, size_t end, ::SimdReduceType reduceType, bool compensation = true)
+    {
+        assert(begin <= end && end <= pyramid[0].height);
+
+        // Number of rows below the center of reducing window (it limits which rows of upper level are ready):
+        const size_t tail = (reduceType == ::SimdReduce4x4 || reduceType == ::SimdReduce5x5) ? 1 : 0;
+        for (size_t level = 1; level < pyramid.Size() && begin < end; ++level)
+        {
+            const View<A> & src = pyramid[level - 1];
+            View<A> & dst = pyramid[level];
+            size_t dstBegin = begin == src.height ? dst.height : (begin > tail ? (begin - tail) / 2 : 0);
+            size_t dstEnd = end == src.height ? dst.height : (end > tail ? (end - tail) / 2 : 0);
+            if (dstBegin < dstEnd)
+            {
+                // The stripe starts from one row above to have full window for the first needed row.
+                // This auxiliary row is reduced with clamped border, so its correct value is saved and restored.
+                size_t srcBegin = dstBegin ? 2 * dstBegin - 2 : 0, srcEnd = std::min(2 * dstEnd + 2, end);
+                View<A> previous;
+                if (dstBegin)
+                {
+                    previous.Recreate(dst.width, 1, View<A>::Gray8);
+                    Simd::Copy(dst.Region(0, dstBegin - 1, dst.width, dstBegin), previous);
+                }
+                Simd::ReduceGray(src.Region(0, srcBegin, src.width, srcEnd), 
+                    dst.Region(0, srcBegin / 2, dst.width, srcBegin / 2 + (srcEnd - srcBegin + 1) / 2).Ref(), reduceType, compensation);
+                if (dstBegin)
+                    Simd::Copy(previous, dst.Region(0, dstBegin - 1, dst.width, dstBegin).Ref());
+            }
+            begin = dstBegin;
+            end = dstEnd;
+        }
+    }
+
     /*! @ingroup cpp_pyramid_functions
 
         \fn void Build(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation = true)
 
         \short Builds the pyramid (fills upper levels on the base of the lowest level).
 
+        All levels are built in one pass over the lowest level: it is processed by horizontal stripes 
+        and every stripe is propagated to all upper levels with using of Simd::BuildRows while it is still in cache.
+
         \param [out] pyramid - a built pyramid.
         \param [in] reduceType - a type of function used for image reducing.
         \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5. It is equal to 'true' by default.
     */
     template<template<class> class A> SIMD_INLINE void Build(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation = true)
     {
-        for (size_t level = 1; level < pyramid.Size(); ++level)
-            Simd::ReduceGray(pyramid.At(level - 1), pyramid.At(level), reduceType, compensation);
+        if (pyramid.Size() < 2)
+            return;
+        const View<A> & base = pyramid[0];
+        const size_t stripe = std::max<size_t>(0x10000 / std::max<size_t>(base.width, 1), 8) & ~size_t(1); // about 64 kB of the lowest level
+        for (size_t row = 0; row < base.height; row += stripe)
+            Simd::BuildRows(pyramid, row, std::min(row + stripe, base.height), reduceType, compensation);
     }
 }
 
@@ -901,8 +901,7 @@ namespace Simd
 
                 _scene.input = input;
                 _scene.output = output;
-                Simd::Convert(input, Frame(_scene.scaled[0]).Ref());
-                Simd::Build(_scene.scaled, SimdReduce2x2);
+                Simd::Build(input, _scene.scaled, SimdReduce2x2);
             }
 
             bool Calibrate(const Size & frameSize)
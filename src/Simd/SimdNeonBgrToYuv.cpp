@@ -23,7 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
-#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
 
 #include "Simd/SimdLog.h"
 
@@ -213,6 +213,216 @@ namespace Simd
             else
                 BgrToYuv444p<false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
         }
+
+        template <class T, bool align> SIMD_INLINE void BgrToYuv420pV2(const uint8_t * bgr0, size_t bgrStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            const uint8_t * bgr1 = bgr0 + bgrStride;
+            uint8_t * y1 = y0 + yStride;
+
+            uint8x16x3_t bgr00 = Load3<align>(bgr0);
+            Store<align>(y0 + 0, BgrToY<T>(bgr00.val[0], bgr00.val[1], bgr00.val[2]));
+
+            uint8x16x3_t bgr01 = Load3<align>(bgr0 + A3);
+            Store<align>(y0 + A, BgrToY<T>(bgr01.val[0], bgr01.val[1], bgr01.val[2]));
+
+            uint8x16x3_t bgr10 = Load3<align>(bgr1);
+            Store<align>(y1 + 0, BgrToY<T>(bgr10.val[0], bgr10.val[1], bgr10.val[2]));
+
+            uint8x16x3_t bgr11 = Load3<align>(bgr1 + A3);
+            Store<align>(y1 + A, BgrToY<T>(bgr11.val[0], bgr11.val[1], bgr11.val[2]));
+
+            uint16x8_t b0 = Average(bgr00.val[0], bgr10.val[0]);
+            uint16x8_t g0 = Average(bgr00.val[1], bgr10.val[1]);
+            uint16x8_t r0 = Average(bgr00.val[2], bgr10.val[2]);
+
+            uint16x8_t b1 = Average(bgr01.val[0], bgr11.val[0]);
+            uint16x8_t g1 = Average(bgr01.val[1], bgr11.val[1]);
+            uint16x8_t r1 = Average(bgr01.val[2], bgr11.val[2]);
+
+            Store<align>(u, PackSaturatedI16(BgrToU<T>(b0, g0, r0), BgrToU<T>(b1, g1, r1)));
+            Store<align>(v, PackSaturatedI16(BgrToV<T>(b0, g0, r0), BgrToV<T>(b1, g1, r1)));
+        }
+
+        template <class T, bool align> void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, DA);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colUV = 0, colY = 0, colBgr = 0; colY < alignedWidth; colY += DA, colUV += A, colBgr += A6)
+                    BgrToYuv420pV2<T, align>(bgr + colBgr, bgrStride, y + colY, yStride, u + colUV, v + colUV);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - DA;
+                    BgrToYuv420pV2<T, false>(bgr + offset * 3, bgrStride, y + offset, yStride, u + offset / 2, v + offset / 2);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <class T> void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToYuv420pV2<T, true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgrToYuv420pV2<T, false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv420pV2<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv420pV2<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv420pV2<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgrToYuv420pV2<Base::Trect871>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align> SIMD_INLINE void BgrToYuv422pV2(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        {
+            uint8x16x3_t bgr0 = Load3<align>(bgr);
+            Store<align>(y + 0, BgrToY<T>(bgr0.val[0], bgr0.val[1], bgr0.val[2]));
+
+            uint16x8_t b0 = Average(bgr0.val[0]);
+            uint16x8_t g0 = Average(bgr0.val[1]);
+            uint16x8_t r0 = Average(bgr0.val[2]);
+
+            uint8x16x3_t bgr1 = Load3<align>(bgr + A3);
+            Store<align>(y + A, BgrToY<T>(bgr1.val[0], bgr1.val[1], bgr1.val[2]));
+
+            uint16x8_t b1 = Average(bgr1.val[0]);
+            uint16x8_t g1 = Average(bgr1.val[1]);
+            uint16x8_t r1 = Average(bgr1.val[2]);
+
+            Store<align>(u, PackSaturatedI16(BgrToU<T>(b0, g0, r0), BgrToU<T>(b1, g1, r1)));
+            Store<align>(v, PackSaturatedI16(BgrToV<T>(b0, g0, r0), BgrToV<T>(b1, g1, r1)));
+        }
+
+        template <class T, bool align> void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (width >= DA));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, DA);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t colUV = 0, colY = 0, colBgr = 0; colY < alignedWidth; colY += DA, colUV += A, colBgr += A6)
+                    BgrToYuv422pV2<T, align>(bgr + colBgr, y + colY, u + colUV, v + colUV);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - DA;
+                    BgrToYuv422pV2<T, false>(bgr + offset * 3, y + offset, u + offset / 2, v + offset / 2);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgr += bgrStride;
+            }
+        }
+
+        template <class T> void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToYuv422pV2<T, true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgrToYuv422pV2<T, false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv422pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv422pV2<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv422pV2<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv422pV2<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgrToYuv422pV2<Base::Trect871>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align> SIMD_INLINE void BgrToYuv444pV2(const uint8_t * bgr, uint8_t * y, uint8_t * u, uint8_t * v)
+        {
+            uint8x16x3_t _bgr = Load3<align>(bgr);
+            Store<align>(y, BgrToY<T>(_bgr.val[0], _bgr.val[1], _bgr.val[2]));
+            Store<align>(u, BgrToU<T>(_bgr.val[0], _bgr.val[1], _bgr.val[2]));
+            Store<align>(v, BgrToV<T>(_bgr.val[0], _bgr.val[1], _bgr.val[2]));
+        }
+
+        template <class T, bool align> void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert(width >= A);
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, colBgr = 0; col < alignedWidth; col += A, colBgr += A3)
+                    BgrToYuv444pV2<T, align>(bgr + colBgr, y + col, u + col, v + col);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - A;
+                    BgrToYuv444pV2<T, false>(bgr + offset * 3, y + offset, u + offset, v + offset);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgr += bgrStride;
+            }
+        }
+
+        template <class T> void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToYuv444pV2<T, true>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgrToYuv444pV2<T, false>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgrToYuv444pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToYuv444pV2<Base::Bt601>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgrToYuv444pV2<Base::Bt709>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgrToYuv444pV2<Base::Bt2020>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgrToYuv444pV2<Base::Trect871>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -23,7 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
-#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
 
 #include "Simd/SimdLog.h"
 
@@ -284,6 +284,218 @@ namespace Simd
             else
                 BgraToYuva420p<false>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
         }
+
+        template <class T, bool align> SIMD_INLINE void BgraToYuv420pV2(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            const uint8_t * bgra1 = bgra0 + bgraStride;
+            uint8_t * y1 = y0 + yStride;
+
+            uint8x16x4_t bgra00 = Load4<align>(bgra0);
+            Store<align>(y0 + 0, BgrToY<T>(bgra00.val[0], bgra00.val[1], bgra00.val[2]));
+
+            uint8x16x4_t bgra01 = Load4<align>(bgra0 + QA);
+            Store<align>(y0 + A, BgrToY<T>(bgra01.val[0], bgra01.val[1], bgra01.val[2]));
+
+            uint8x16x4_t bgra10 = Load4<align>(bgra1);
+            Store<align>(y1 + 0, BgrToY<T>(bgra10.val[0], bgra10.val[1], bgra10.val[2]));
+
+            uint8x16x4_t bgra11 = Load4<align>(bgra1 + QA);
+            Store<align>(y1 + A, BgrToY<T>(bgra11.val[0], bgra11.val[1], bgra11.val[2]));
+
+            uint16x8_t b0 = Average(bgra00.val[0], bgra10.val[0]);
+            uint16x8_t g0 = Average(bgra00.val[1], bgra10.val[1]);
+            uint16x8_t r0 = Average(bgra00.val[2], bgra10.val[2]);
+
+            uint16x8_t b1 = Average(bgra01.val[0], bgra11.val[0]);
+            uint16x8_t g1 = Average(bgra01.val[1], bgra11.val[1]);
+            uint16x8_t r1 = Average(bgra01.val[2], bgra11.val[2]);
+
+            Store<align>(u, PackSaturatedI16(BgrToU<T>(b0, g0, r0), BgrToU<T>(b1, g1, r1)));
+            Store<align>(v, PackSaturatedI16(BgrToV<T>(b0, g0, r0), BgrToV<T>(b1, g1, r1)));
+        }
+
+        template <class T, bool align> void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, DA);
+            const size_t A8 = A * 8;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colUV = 0, colY = 0, colBgra = 0; colY < alignedWidth; colY += DA, colUV += A, colBgra += A8)
+                    BgraToYuv420pV2<T, align>(bgra + colBgra, bgraStride, y + colY, yStride, u + colUV, v + colUV);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - DA;
+                    BgraToYuv420pV2<T, false>(bgra + offset * 4, bgraStride, y + offset, yStride, u + offset / 2, v + offset / 2);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <class T> void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
+                BgraToYuv420pV2<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgraToYuv420pV2<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv420pV2<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv420pV2<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv420pV2<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgraToYuv420pV2<Base::Trect871>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align> SIMD_INLINE void BgraToYuv422pV2(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
+        {
+            uint8x16x4_t bgra0 = Load4<align>(bgra);
+            Store<align>(y + 0, BgrToY<T>(bgra0.val[0], bgra0.val[1], bgra0.val[2]));
+
+            uint16x8_t b0 = Average(bgra0.val[0]);
+            uint16x8_t g0 = Average(bgra0.val[1]);
+            uint16x8_t r0 = Average(bgra0.val[2]);
+
+            uint8x16x4_t bgra1 = Load4<align>(bgra + QA);
+            Store<align>(y + A, BgrToY<T>(bgra1.val[0], bgra1.val[1], bgra1.val[2]));
+
+            uint16x8_t b1 = Average(bgra1.val[0]);
+            uint16x8_t g1 = Average(bgra1.val[1]);
+            uint16x8_t r1 = Average(bgra1.val[2]);
+
+            Store<align>(u, PackSaturatedI16(BgrToU<T>(b0, g0, r0), BgrToU<T>(b1, g1, r1)));
+            Store<align>(v, PackSaturatedI16(BgrToV<T>(b0, g0, r0), BgrToV<T>(b1, g1, r1)));
+        }
+
+        template <class T, bool align> void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (width >= DA));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, DA);
+            const size_t A8 = A * 8;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t colUV = 0, colY = 0, colBgra = 0; colY < alignedWidth; colY += DA, colUV += A, colBgra += A8)
+                    BgraToYuv422pV2<T, align>(bgra + colBgra, y + colY, u + colUV, v + colUV);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - DA;
+                    BgraToYuv422pV2<T, false>(bgra + offset * 4, y + offset, u + offset / 2, v + offset / 2);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgra += bgraStride;
+            }
+        }
+
+        template <class T> void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
+                BgraToYuv422pV2<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgraToYuv422pV2<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv422pV2<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv422pV2<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv422pV2<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgraToYuv422pV2<Base::Trect871>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align> SIMD_INLINE void BgraToYuv444pV2(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
+        {
+            uint8x16x4_t _bgra = Load4<align>(bgra);
+            Store<align>(y, BgrToY<T>(_bgra.val[0], _bgra.val[1], _bgra.val[2]));
+            Store<align>(u, BgrToU<T>(_bgra.val[0], _bgra.val[1], _bgra.val[2]));
+            Store<align>(v, BgrToV<T>(_bgra.val[0], _bgra.val[1], _bgra.val[2]));
+        }
+
+        template <class T, bool align> void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert(width >= A);
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, colBgra = 0; col < alignedWidth; col += A, colBgra += QA)
+                    BgraToYuv444pV2<T, align>(bgra + colBgra, y + col, u + col, v + col);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - A;
+                    BgraToYuv444pV2<T, false>(bgra + offset * 4, y + offset, u + offset, v + offset);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgra += bgraStride;
+            }
+        }
+
+        template <class T> void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
+                BgraToYuv444pV2<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgraToYuv444pV2<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv444pV2<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv444pV2<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv444pV2<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgraToYuv444pV2<Base::Trect871>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -171,6 +171,7 @@ namespace Simd
             typedef HidHaarCascade Hid;
             const float * leaves = hid.leaves.data();
             const Hid::Node * node = hid.nodes.data();
+            const Hid::Feature * feature = hid.features.data();
             const Hid::Stage * stages = hid.stages.data();
             for (int i = 0, n = (int)hid.stages.size(); i < n; ++i)
             {
@@ -181,21 +182,19 @@ namespace Simd
                 float32x4_t stageSum = vdupq_n_f32(0.0f);
                 if (stage.hasThree)
                 {
-                    for (; node < end; ++node, leaves += 2)
+                    for (; node < end; ++node, ++feature, leaves += 2)
                     {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        float32x4_t sum = vaddq_f32(WeightedSum32f(feature.rect[0], offset), WeightedSum32f(feature.rect[1], offset));
-                        if (feature.rect[2].p0)
-                            sum = vaddq_f32(sum, WeightedSum32f(feature.rect[2], offset));
+                        float32x4_t sum = vaddq_f32(WeightedSum32f(feature->rect[0], offset), WeightedSum32f(feature->rect[1], offset));
+                        if (feature->rect[2].p0)
+                            sum = vaddq_f32(sum, WeightedSum32f(feature->rect[2], offset));
                         StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                     }
                 }
                 else
                 {
-                    for (; node < end; ++node, leaves += 2)
+                    for (; node < end; ++node, ++feature, leaves += 2)
                     {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        float32x4_t sum = vaddq_f32(WeightedSum32f(feature.rect[0], offset), WeightedSum32f(feature.rect[1], offset));
+                        float32x4_t sum = vaddq_f32(WeightedSum32f(feature->rect[0], offset), WeightedSum32f(feature->rect[1], offset));
                         StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                     }
                 }
@@ -419,7 +418,6 @@ namespace Simd
             size_t subsetSize = (hid.ncategories + 31) / 32;
             const int * subsets = hid.subsets.data();
             const Hid::Leave * leaves = hid.leaves.data();
-            const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
             int nodeOffset = 0, leafOffset = 0;
             for (int i_stage = 0, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
@@ -428,7 +426,7 @@ namespace Simd
                 float32x4_t sum = vdupq_n_f32(0.0f);
                 for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
                 {
-                    const Hid::Feature & feature = hid.features[nodes[nodeOffset].featureIdx];
+                    const Hid::Feature & feature = hid.features[nodeOffset];
                     const int * subset = subsets + nodeOffset*subsetSize;
                     uint32x4_t mask = LeafMask(feature, offset, subset);
                     sum = vaddq_f32(sum, vbslq_f32(mask, vdupq_n_f32(leaves[leafOffset + 0]), vdupq_n_f32(leaves[leafOffset + 1])));
@@ -631,7 +629,6 @@ namespace Simd
             size_t subsetSize = (hid.ncategories + 31) / 32;
             const int * subsets = hid.subsets.data();
             const Hid::Leave * leaves = hid.leaves.data();
-            const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
             int nodeOffset = 0, leafOffset = 0;
             for (int i_stage = 0, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
@@ -640,7 +637,7 @@ namespace Simd
                 int16x8_t sum = vdupq_n_s16(0);
                 for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
                 {
-                    const Hid::Feature & feature = hid.features[nodes[nodeOffset].featureIdx];
+                    const Hid::Feature & feature = hid.features[nodeOffset];
                     const int * subset = subsets + nodeOffset*subsetSize;
                     uint16x8_t mask = LeafMask(feature, offset, subset);
                     sum = vaddq_s16(sum, vbslq_s16(mask, vdupq_n_s16(leaves[leafOffset + 0]), vdupq_n_s16(leaves[leafOffset + 1])));
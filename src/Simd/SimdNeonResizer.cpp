@@ -575,6 +575,219 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Base::ResizerByteFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowY(const int16_t * const * src, const int16_t * alpha, size_t size, size_t offset, uint8_t * dst)
+        {
+            int32x4_t lo = vdupq_n_s32(Base::FILTER_ROUND_Y), hi = lo;
+            for (size_t k = 0; k < size; ++k)
+            {
+                int16x8_t s = vld1q_s16(src[k] + offset);
+                int16x4_t a = vld1_dup_s16(alpha + k);
+                lo = vmlal_s16(lo, vget_low_s16(s), a);
+                hi = vmlal_s16(hi, vget_high_s16(s), a);
+            }
+            int16x8_t res = vcombine_s16(vqmovn_s32(vshrq_n_s32(lo, Base::FILTER_SHIFT_Y)), vqmovn_s32(vshrq_n_s32(hi, Base::FILTER_SHIFT_Y)));
+            vst1_u8(dst + offset, vqmovun_s16(res));
+        }
+
+        void ResizerByteFilter::RunY(const int16_t * const * src, const int16_t * alpha, size_t size, uint8_t * dst)
+        {
+            if (size < HA)
+            {
+                Base::ResizerByteFilter::RunY(src, alpha, size, dst);
+                return;
+            }
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                ResizerByteFilterRowY(src, alpha, _sizeY, i, dst);
+            if (sizeHA < size)
+                ResizerByteFilterRowY(src, alpha, _sizeY, size - HA, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Base::ResizerFloatFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerFloatFilterRowY(const float * const * src, const float * alpha, size_t size, size_t offset, float * dst)
+        {
+            float32x4_t sum = vmulq_f32(vld1q_f32(src[0] + offset), vld1q_dup_f32(alpha + 0));
+            for (size_t k = 1; k < size; ++k)
+                sum = vmlaq_f32(sum, vld1q_f32(src[k] + offset), vld1q_dup_f32(alpha + k));
+            vst1q_f32(dst + offset, sum);
+        }
+
+        void ResizerFloatFilter::RunY(const float * const * src, const float * alpha, size_t size, float * dst)
+        {
+            if (size < F)
+            {
+                Base::ResizerFloatFilter::RunY(src, alpha, size, dst);
+                return;
+            }
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                ResizerFloatFilterRowY(src, alpha, _sizeY, i, dst);
+            if (sizeF < size)
+                ResizerFloatFilterRowY(src, alpha, _sizeY, size - F, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatArea::ResizerFloatArea(const ResParam & param)
+            : Base::ResizerFloatArea(param)
+        {
+        }
+
+        template<UpdateType update> SIMD_INLINE void ResizerFloatAreaRowUpdate(const float * src, size_t size, float a, float * dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            float32x4_t alpha = vdupq_n_f32(a);
+            for (; i < sizeF; i += F)
+                Update<update, false>(dst + i, vmulq_f32(vld1q_f32(src + i), alpha));
+            for (; i < size; ++i)
+                Base::Update<update>(dst + i, src[i] * a);
+        }
+
+        void ResizerFloatArea::RowSum(const float * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst)
+        {
+            ResizerFloatAreaRowUpdate<UpdateSet>(src, size, count ? curr : curr - next, dst);
+            for (size_t i = 1; i <= count; ++i)
+                src += stride, ResizerFloatAreaRowUpdate<UpdateAdd>(src, size, i < count ? zero : zero - next, dst);
+        }
+
+        SIMD_INLINE void ResizerFloatAreaColSum(const float * src, size_t stride, size_t count, float32x4_t curr, float32x4_t zero, float32x4_t next, float * dst)
+        {
+            float32x4_t sum = vmulq_f32(vld1q_f32(src), curr);
+            for (size_t i = 0; i < count; ++i)
+                src += stride, sum = vmlaq_f32(sum, vld1q_f32(src), zero);
+            vst1q_f32(dst, vmlsq_f32(sum, vld1q_f32(src), next));
+        }
+
+        void ResizerFloatArea::ColSum(const float * src, float * dst)
+        {
+            size_t cn = _param.channels;
+            if (cn < F)
+            {
+                Base::ResizerFloatArea::ColSum(src, dst);
+                return;
+            }
+            size_t cnF = AlignLo(cn, F);
+            const int32_t * ix = _ix.data;
+            const float * ax = _ax.data;
+            float32x4_t zero = vdupq_n_f32(ax[0]);
+            for (size_t dx = 0; dx < _param.dstW; dx++, dst += cn)
+            {
+                size_t count = ix[dx + 1] - ix[dx];
+                float32x4_t curr = vdupq_n_f32(ax[dx]), next = vdupq_n_f32(ax[dx + 1]);
+                for (size_t c = 0; c < cnF; c += F)
+                    ResizerFloatAreaColSum(src + c, cn, count, curr, zero, next, dst + c);
+                if (cnF < cn)
+                    ResizerFloatAreaColSum(src + cn - F, cn, count, curr, zero, next, dst + cn - F);
+                src += count * cn;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : Base::ResizerShortBilinear(param)
+        {
+        }
+
+        SIMD_INLINE uint32x4_t ResizerShortLoad(const uint16_t * src, const int32_t * ix, size_t offset)
+        {
+            uint32x4_t s = vdupq_n_u32(0);
+            s = vld1q_lane_u32((uint32_t*)(src + ix[0] + offset), s, 0);
+            s = vld1q_lane_u32((uint32_t*)(src + ix[1] + offset), s, 1);
+            s = vld1q_lane_u32((uint32_t*)(src + ix[2] + offset), s, 2);
+            s = vld1q_lane_u32((uint32_t*)(src + ix[3] + offset), s, 3);
+            return s;
+        }
+
+        void ResizerShortBilinear::RunX(const uint16_t * src, float * dst)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn, rsF = AlignLo(rs, F);
+            const int32_t * ix = _ix.data;
+            const float * ax = _ax.data;
+            float32x4_t _1 = vdupq_n_f32(1.0f);
+            uint32x4_t lo = vdupq_n_u32(0xFFFF);
+            size_t dx = 0;
+            for (; dx < rsF; dx += F)
+            {
+                uint32x4_t s0 = ResizerShortLoad(src, ix + dx, 0);
+                uint32x4_t s1 = cn == 1 ? s0 : ResizerShortLoad(src, ix + dx, cn - 1);
+                float32x4_t fx1 = Load<false>(ax + dx);
+                float32x4_t fx0 = vsubq_f32(_1, fx1);
+                float32x4_t m0 = vmulq_f32(vcvtq_f32_u32(vandq_u32(s0, lo)), fx0);
+                float32x4_t m1 = vmulq_f32(vcvtq_f32_u32(vshrq_n_u32(s1, 16)), fx1);
+                Store<false>(dst + dx, vaddq_f32(m0, m1));
+            }
+            for (; dx < rs; dx++)
+            {
+                int32_t sx = ix[dx];
+                float fx = ax[dx];
+                dst[dx] = src[sx] * (1.0f - fx) + src[sx + cn] * fx;
+            }
+        }
+
+        SIMD_INLINE uint16x4_t ResizerShortRunY(const float * src0, const float * src1, float32x4_t fy0, float32x4_t fy1)
+        {
+            float32x4_t m0 = vmulq_f32(Load<false>(src0), fy0);
+            float32x4_t m1 = vmulq_f32(Load<false>(src1), fy1);
+            return vqmovn_u32(vcvtq_u32_f32(vaddq_f32(vaddq_f32(m0, m1), vdupq_n_f32(0.5f))));
+        }
+
+        void ResizerShortBilinear::RunY(const float * src0, const float * src1, float fy, uint16_t * dst)
+        {
+            size_t rs = _param.dstW * _param.channels, rsDF = AlignLo(rs, DF);
+            float32x4_t _fy0 = vdupq_n_f32(1.0f - fy), _fy1 = vdupq_n_f32(fy);
+            size_t dx = 0;
+            for (; dx < rsDF; dx += DF)
+            {
+                uint16x4_t d0 = ResizerShortRunY(src0 + dx + 0, src1 + dx + 0, _fy0, _fy1);
+                uint16x4_t d1 = ResizerShortRunY(src0 + dx + F, src1 + dx + F, _fy0, _fy1);
+                vst1q_u16(dst + dx, vcombine_u16(d0, d1));
+            }
+            for (; dx < rs; dx++)
+                dst[dx] = Base::ResizerShortRound(src0[dx] * (1.0f - fy) + src1[dx] * fy);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : Base::ResizerShortArea(param)
+        {
+        }
+
+        template<UpdateType update> SIMD_INLINE void ResizerShortAreaRowUpdate(const uint16_t * src, size_t size, float a, float * dst)
+        {
+            size_t sizeHA = AlignLo(size, HA), i = 0;
+            float32x4_t alpha = vdupq_n_f32(a);
+            for (; i < sizeHA; i += HA)
+            {
+                uint16x8_t s = vld1q_u16(src + i);
+                Update<update, false>(dst + i + 0, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(s))), alpha));
+                Update<update, false>(dst + i + F, vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(s))), alpha));
+            }
+            for (; i < size; ++i)
+                Base::Update<update>(dst + i, src[i] * a);
+        }
+
+        void ResizerShortArea::RowSum(const uint16_t * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst)
+        {
+            ResizerShortAreaRowUpdate<UpdateSet>(src, size, count ? curr : curr - next, dst);
+            for (size_t i = 1; i <= count; ++i)
+                src += stride, ResizerShortAreaRowUpdate<UpdateAdd>(src, size, i < count ? zero : zero - next, dst);
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(float32x4_t));
@@ -584,9 +797,30 @@ namespace Simd
                 return new ResizerByteArea(param);
             else if (type == SimdResizeChannelFloat && (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp))
                 return new ResizerFloatBilinear(param);
+            else if (type == SimdResizeChannelShort && (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp))
+                return new ResizerShortBilinear(param);
+            else if (type == SimdResizeChannelShort && method == SimdResizeMethodArea)
+                return new ResizerShortArea(param);
+            else if (type == SimdResizeChannelByte && param.IsFilter())
+                return new ResizerByteFilter(param);
+            else if (type == SimdResizeChannelFloat && method == SimdResizeMethodArea)
+                return new ResizerFloatArea(param);
+            else if (type == SimdResizeChannelFloat && (param.IsFilter() || method == SimdResizeMethodBilinearAntiAlias))
+                return new ResizerFloatFilter(param);
             else
                 return Base::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(float32x4_t));
+            if (type == SimdResizeChannelByte && (method == SimdResizeMethodBilinear || param.IsFilter()))
+                return new ResizerByteFilter(param);
+            else if (type == SimdResizeChannelFloat && (method == SimdResizeMethodBilinear || method == SimdResizeMethodBilinearAntiAlias || param.IsFilter()))
+                return new ResizerFloatFilter(param);
+            else
+                return Base::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -0,0 +1,196 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdNeon.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        SIMD_INLINE int32x4_t Reduce4(const int32x4_t * a)
+        {
+            int32x2_t s0 = vpadd_s32(vget_low_s32(a[0]), vget_high_s32(a[0]));
+            int32x2_t s1 = vpadd_s32(vget_low_s32(a[1]), vget_high_s32(a[1]));
+            int32x2_t s2 = vpadd_s32(vget_low_s32(a[2]), vget_high_s32(a[2]));
+            int32x2_t s3 = vpadd_s32(vget_low_s32(a[3]), vget_high_s32(a[3]));
+            return vcombine_s32(vpadd_s32(s0, s1), vpadd_s32(s2, s3));
+        }
+
+        SIMD_INLINE void Gemm8iNN_1x8(size_t K, const uint8_t * A, const int8_t * B, size_t ldb, int32_t * C)
+        {
+            int32x4_t c[8];
+            for (size_t n = 0; n < 8; ++n)
+                c[n] = vdupq_n_s32(0);
+            for (size_t k = 0; k < K; k += 4)
+            {
+                uint8x8_t a8 = vreinterpret_u8_u32(vdup_n_u32(*(uint32_t*)(A + k)));
+                int16x4_t a = vget_low_s16(vreinterpretq_s16_u16(vmovl_u8(a8)));
+                int8x16_t b0 = vld1q_s8(B + 0);
+                int8x16_t b1 = vld1q_s8(B + 16);
+                int16x8_t b00 = vmovl_s8(vget_low_s8(b0)), b01 = vmovl_s8(vget_high_s8(b0));
+                int16x8_t b10 = vmovl_s8(vget_low_s8(b1)), b11 = vmovl_s8(vget_high_s8(b1));
+                c[0] = vmlal_s16(c[0], a, vget_low_s16(b00));
+                c[1] = vmlal_s16(c[1], a, vget_high_s16(b00));
+                c[2] = vmlal_s16(c[2], a, vget_low_s16(b01));
+                c[3] = vmlal_s16(c[3], a, vget_high_s16(b01));
+                c[4] = vmlal_s16(c[4], a, vget_low_s16(b10));
+                c[5] = vmlal_s16(c[5], a, vget_high_s16(b10));
+                c[6] = vmlal_s16(c[6], a, vget_low_s16(b11));
+                c[7] = vmlal_s16(c[7], a, vget_high_s16(b11));
+                B += ldb * 4;
+            }
+            vst1q_s32(C + 0, Reduce4(c + 0));
+            vst1q_s32(C + 4, Reduce4(c + 4));
+        }
+
+        void Gemm8iNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc)
+        {
+            assert(N % 8 == 0 && K % 4 == 0);
+            for (size_t j = 0; j < N; j += 8)
+                for (size_t i = 0; i < M; ++i)
+                    Gemm8iNN_1x8(K, A + i * lda, B + j * 4, ldb, C + i * ldc + j);
+        }
+
+        template<::SimdConvolutionActivationType type> SIMD_INLINE float32x4_t Convert(const int32_t * src, const float * norm, const float * bias, const float * params, float32x4_t * _params)
+        {
+            if (type == ::SimdConvolutionActivationPrelu)
+                _params[0] = vld1q_f32(params);
+            float32x4_t value = vcvtq_f32_s32(vld1q_s32(src));
+            return Activate<type>(vmlaq_f32(vld1q_f32(bias), value, vld1q_f32(norm)), _params, 0);
+        }
+
+        template<::SimdConvolutionActivationType type> SIMD_INLINE int32x4_t Convert(const int32_t * src, const float * norm, const float * bias,
+            const float * params, float32x4_t * _params, const float * scale, const float * shift)
+        {
+            float32x4_t value = Convert<type>(src, norm, bias, params, _params);
+            return vcvtq_s32_f32(vaddq_f32(vmlaq_f32(vld1q_f32(shift), value, vld1q_f32(scale)), vdupq_n_f32(0.5f)));
+        }
+
+        template<::SimdConvolutionActivationType type> void Convert8u(const int32_t * src, size_t M, size_t N, size_t ldS,
+            const float * norm, const float * bias, const float * params, const float * scale, const float * shift, uint8_t * dst, size_t ldD)
+        {
+            size_t N8 = AlignLo(N, 8);
+            float32x4_t _params[2];
+            _params[0] = vdupq_n_f32(params[0]);
+            _params[1] = vdupq_n_f32(params[1]);
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; j += 8)
+                {
+                    int32x4_t i0 = Convert<type>(src + j + 0, norm + j + 0, bias + j + 0, params + j + 0, _params, scale + j + 0, shift + j + 0);
+                    int32x4_t i1 = Convert<type>(src + j + 4, norm + j + 4, bias + j + 4, params + j + 4, _params, scale + j + 4, shift + j + 4);
+                    uint8x8_t u8 = vqmovun_s16(vcombine_s16(vqmovn_s32(i0), vqmovn_s32(i1)));
+                    if (j < N8)
+                        vst1_u8(dst + j, u8);
+                    else
+                    {
+                        uint8_t tmp[8];
+                        vst1_u8(tmp, u8);
+                        for (size_t k = j; k < N; ++k)
+                            dst[k] = tmp[k - j];
+                    }
+                }
+                src += ldS;
+                dst += ldD;
+            }
+        }
+
+        template<::SimdConvolutionActivationType type> void Convert32f(const int32_t * src, size_t M, size_t N, size_t ldS,
+            const float * norm, const float * bias, const float * params, const float * scale, const float * shift, uint8_t * dst, size_t ldD)
+        {
+            size_t NF = AlignLo(N, F);
+            float32x4_t _params[2];
+            _params[0] = vdupq_n_f32(params[0]);
+            _params[1] = vdupq_n_f32(params[1]);
+            float * pDst = (float*)dst;
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; j += F)
+                {
+                    float32x4_t value = Convert<type>(src + j, norm + j, bias + j, params + j, _params);
+                    if (j < NF)
+                        vst1q_f32(pDst + j, value);
+                    else
+                    {
+                        float tmp[F];
+                        vst1q_f32(tmp, value);
+                        for (size_t k = j; k < N; ++k)
+                            pDst[k] = tmp[k - j];
+                    }
+                }
+                src += ldS;
+                pDst += ldD;
+            }
+        }
+
+        template<::SimdConvolutionActivationType type> Base::SynetConvolution8iGemmNN::ConvertPtr GetConvert(::SimdTensorDataType dstT)
+        {
+            return dstT == SimdTensorData8u ? Convert8u<type> : Convert32f<type>;
+        }
+
+        Base::SynetConvolution8iGemmNN::ConvertPtr GetConvert(::SimdConvolutionActivationType activation, ::SimdTensorDataType dstT)
+        {
+            switch (activation)
+            {
+            case ::SimdConvolutionActivationIdentity: return GetConvert<::SimdConvolutionActivationIdentity>(dstT);
+            case ::SimdConvolutionActivationRelu: return GetConvert<::SimdConvolutionActivationRelu>(dstT);
+            case ::SimdConvolutionActivationLeakyRelu: return GetConvert<::SimdConvolutionActivationLeakyRelu>(dstT);
+            case ::SimdConvolutionActivationRestrictRange: return GetConvert<::SimdConvolutionActivationRestrictRange>(dstT);
+            case ::SimdConvolutionActivationPrelu: return GetConvert<::SimdConvolutionActivationPrelu>(dstT);
+            case ::SimdConvolutionActivationElu: return GetConvert<::SimdConvolutionActivationElu>(dstT);
+            default: assert(0); return NULL;
+            }
+        }
+
+        SynetConvolution8iGemmNN::SynetConvolution8iGemmNN(const ConvParam8i & p)
+            : Base::SynetConvolution8iGemmNN(p)
+        {
+            _gemm = Neon::Gemm8iNN;
+            _convert = Neon::GetConvert(p.activation, p.dstT);
+        }
+
+        SynetConvolution8iDepthwise::SynetConvolution8iDepthwise(const ConvParam8i & p)
+            : Base::SynetConvolution8iDepthwise(p)
+        {
+            _convert = Neon::GetConvert(p.activation, p.dstT);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv)
+        {
+            ConvParam8i param(batch, conv);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsDepthwise())
+                return new SynetConvolution8iDepthwise(param);
+            return new SynetConvolution8iGemmNN(param);
+        }
+    }
+#endif//SIMD_NEON_ENABLE
+}
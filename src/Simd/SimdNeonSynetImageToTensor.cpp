@@ -0,0 +1,124 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetImageToTensor.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdNeon.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        SynetImageToTensor::SynetImageToTensor(const ImgToTenParam & param)
+            : Base::SynetImageToTensor(param)
+        {
+            ConvertPtr bgraToBgr = Base::BgraToBgr;
+            if (param.srcW >= A)
+                bgraToBgr = Neon::BgraToBgr;
+            SetConverters(bgraToBgr,
+                param.srcW >= A ? Neon::GrayToBgr : Base::GrayToBgr,
+                param.srcW >= A ? Neon::BgrToGray : Base::BgrToGray,
+                param.srcW >= HA ? Neon::BgraToGray : Base::BgraToGray,
+                param.srcW / 2 >= A ? Neon::DeinterleaveUv : Base::DeinterleaveUv,
+                param.srcW >= DA ? Neon::Yuv420pToBgr : Base::Yuv420pToBgr);
+        }
+
+        SIMD_INLINE void SynetImageToTensorRowX(const uint8_t * src, const int32_t * ix, const float * ax, size_t dx, size_t i, float * dst)
+        {
+            const int32_t * o = ix + i;
+            int32_t b0[4] = { src[o[0]], src[o[1]], src[o[2]], src[o[3]] };
+            int32_t b1[4] = { src[o[0] + dx], src[o[1] + dx], src[o[2] + dx], src[o[3] + dx] };
+            float32x4_t s0 = vcvtq_f32_s32(vld1q_s32(b0));
+            float32x4_t s1 = vcvtq_f32_s32(vld1q_s32(b1));
+            Store<false>(dst + i, vmlaq_f32(s0, vsubq_f32(s1, s0), Load<false>(ax + i)));
+        }
+
+        void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst)
+        {
+            if (size < F)
+            {
+                Base::SynetImageToTensorRowX(src, srcSize, ix, ax, dx, size, dst);
+                return;
+            }
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                SynetImageToTensorRowX(src, ix, ax, dx, i, dst);
+            if (sizeF < size)
+                SynetImageToTensorRowX(src, ix, ax, dx, size - F, dst);
+        }
+
+        void SynetImageToTensor::RunX(const uint8_t * src, float * dst)
+        {
+            SynetImageToTensorRowX(src, _rowSize, _ix.data, _ax.data, _dx, _size, dst);
+        }
+
+        SIMD_INLINE void SynetImageToTensorRowY(const float * src0, const float * src1, float32x4_t alpha, const float * scale, const float * shift, size_t i, float * dst)
+        {
+            float32x4_t s0 = Load<false>(src0 + i);
+            float32x4_t s = vmlaq_f32(s0, vsubq_f32(Load<false>(src1 + i), s0), alpha);
+            Store<false>(dst + i, vmlaq_f32(Load<false>(shift + i), s, Load<false>(scale + i)));
+        }
+
+        void SynetImageToTensorRowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            if (size < F)
+            {
+                Base::SynetImageToTensorRowY(src0, src1, alpha, scale, shift, size, dst);
+                return;
+            }
+            float32x4_t _alpha = vdupq_n_f32(alpha);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                SynetImageToTensorRowY(src0, src1, _alpha, scale, shift, i, dst);
+            if (sizeF < size)
+                SynetImageToTensorRowY(src0, src1, _alpha, scale, shift, size - F, dst);
+        }
+
+        void SynetImageToTensor::RowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            SynetImageToTensorRowY(src0, src1, alpha, scale, shift, size, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat)
+        {
+            ImgToTenParam param(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+            if (!param.Valid())
+                return NULL;
+            return new SynetImageToTensor(param);
+        }
+
+        void * SynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale)
+        {
+            CropResParam param(channels, dstWidth, dstHeight, dstFormat, dstType, keepAspect, mean, scale);
+            if (!param.Valid())
+                return NULL;
+            return new Base::SynetCropResize(param, Neon::SynetImageToTensorRowX, Neon::SynetImageToTensorRowY);
+        }
+    }
+#endif//SIMD_NEON_ENABLE
+}
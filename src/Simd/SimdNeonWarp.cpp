@@ -0,0 +1,273 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdWarp.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE bool WarpInside(int32x4_t ix, int32x4_t iy, int32x4_t w, int32x4_t h)
+        {
+            int32x4_t zero = vdupq_n_s32(0);
+            uint32x4_t inside = vandq_u32(vcgeq_s32(ix, zero), vcltq_s32(ix, w));
+            inside = vandq_u32(inside, vandq_u32(vcgeq_s32(iy, zero), vcltq_s32(iy, h)));
+            uint32x2_t half = vand_u32(vget_low_u32(inside), vget_high_u32(inside));
+            return (vget_lane_u32(half, 0) & vget_lane_u32(half, 1)) == 0xFFFFFFFF;
+        }
+
+        SIMD_INLINE uint32x4_t WarpLoad8(const uint8_t * src, const int32_t * o)
+        {
+            uint32x4_t value = vdupq_n_u32(src[o[0]]);
+            value = vsetq_lane_u32(src[o[1]], value, 1);
+            value = vsetq_lane_u32(src[o[2]], value, 2);
+            value = vsetq_lane_u32(src[o[3]], value, 3);
+            return value;
+        }
+
+        SIMD_INLINE uint32x4_t WarpLoad32(const uint8_t * src, const int32_t * o)
+        {
+            uint32x4_t value = vdupq_n_u32(*(uint32_t*)(src + o[0]));
+            value = vsetq_lane_u32(*(uint32_t*)(src + o[1]), value, 1);
+            value = vsetq_lane_u32(*(uint32_t*)(src + o[2]), value, 2);
+            value = vsetq_lane_u32(*(uint32_t*)(src + o[3]), value, 3);
+            return value;
+        }
+
+        SIMD_INLINE uint32x4_t WarpChannel(uint32x4_t pixel, size_t channel)
+        {
+            return vandq_u32(vshlq_u32(pixel, vdupq_n_s32(-8 * int(channel))), K32_000000FF);
+        }
+
+        SIMD_INLINE uint32x4_t WarpInterpolate(uint32x4_t p00, uint32x4_t p01, uint32x4_t p10, uint32x4_t p11, uint32x4_t kx0, uint32x4_t kx1, uint32x4_t ky0, uint32x4_t ky1)
+        {
+            uint32x4_t t0 = vmlaq_u32(vmulq_u32(p00, kx0), p01, kx1);
+            uint32x4_t t1 = vmlaq_u32(vmulq_u32(p10, kx0), p11, kx1);
+            uint32x4_t sum = vmlaq_u32(vmulq_u32(t0, ky0), t1, ky1);
+            return vshrq_n_u32(vaddq_u32(sum, vdupq_n_u32(WARP_ROUND)), 2 * WARP_SHIFT);
+        }
+
+        template<size_t N> SIMD_INLINE void WarpStore(uint32x4_t value, uint8_t * dst);
+
+        template<> SIMD_INLINE void WarpStore<1>(uint32x4_t value, uint8_t * dst)
+        {
+            uint16x4_t value16 = vmovn_u32(value);
+            uint8x8_t value8 = vmovn_u16(vcombine_u16(value16, value16));
+            vst1_lane_u32((uint32_t*)dst, vreinterpret_u32_u8(value8), 0);
+        }
+
+        template<> SIMD_INLINE void WarpStore<2>(uint32x4_t value, uint8_t * dst)
+        {
+            vst1_u16((uint16_t*)dst, vmovn_u32(value));
+        }
+
+        template<> SIMD_INLINE void WarpStore<3>(uint32x4_t value, uint8_t * dst)
+        {
+            SIMD_ALIGNED(16) uint8_t buf[16];
+            vst1q_u32((uint32_t*)buf, value);
+            for (size_t i = 0; i < 4; ++i)
+                for (size_t c = 0; c < 3; ++c)
+                    dst[i * 3 + c] = buf[i * 4 + c];
+        }
+
+        template<> SIMD_INLINE void WarpStore<4>(uint32x4_t value, uint8_t * dst)
+        {
+            vst1q_u32((uint32_t*)dst, value);
+        }
+
+        template<size_t N> SIMD_INLINE void WarpByte(const uint8_t * src, size_t stride, const int32_t * o, uint32x4_t fx, uint32x4_t fy, uint8_t * dst)
+        {
+            uint32x4_t range = vdupq_n_u32(WARP_RANGE);
+            uint32x4_t kx0 = vsubq_u32(range, fx), ky0 = vsubq_u32(range, fy);
+            const uint8_t * s0 = src, * s1 = src + stride;
+            uint32x4_t value = vdupq_n_u32(0);
+            if (N == 4)
+            {
+                uint32x4_t p00 = WarpLoad32(s0, o), p01 = WarpLoad32(s0 + 4, o), p10 = WarpLoad32(s1, o), p11 = WarpLoad32(s1 + 4, o);
+                for (size_t c = 0; c < N; ++c)
+                {
+                    uint32x4_t r = WarpInterpolate(WarpChannel(p00, c), WarpChannel(p01, c), WarpChannel(p10, c), WarpChannel(p11, c), kx0, fx, ky0, fy);
+                    value = vorrq_u32(value, vshlq_u32(r, vdupq_n_s32(8 * int(c))));
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < N; ++c)
+                {
+                    uint32x4_t r = WarpInterpolate(WarpLoad8(s0 + c, o), WarpLoad8(s0 + c + N, o), WarpLoad8(s1 + c, o), WarpLoad8(s1 + c + N, o), kx0, fx, ky0, fy);
+                    value = vorrq_u32(value, vshlq_u32(r, vdupq_n_s32(8 * int(c))));
+                }
+            }
+            WarpStore<N>(value, dst);
+        }
+
+        SIMD_INLINE float32x4_t WarpLoad(const uint8_t * src, const int32_t * o)
+        {
+            float32x4_t value = vdupq_n_f32(*(float*)(src + o[0]));
+            value = vsetq_lane_f32(*(float*)(src + o[1]), value, 1);
+            value = vsetq_lane_f32(*(float*)(src + o[2]), value, 2);
+            value = vsetq_lane_f32(*(float*)(src + o[3]), value, 3);
+            return value;
+        }
+
+        template<size_t N> SIMD_INLINE void WarpFloat(const uint8_t * src, size_t stride, const int32_t * o, uint32x4_t fx, uint32x4_t fy, float * dst)
+        {
+            float32x4_t one = vdupq_n_f32(1.0f);
+            float32x4_t kx1 = vmulq_n_f32(vcvtq_f32_u32(fx), 1.0f / WARP_RANGE), kx0 = vsubq_f32(one, kx1);
+            float32x4_t ky1 = vmulq_n_f32(vcvtq_f32_u32(fy), 1.0f / WARP_RANGE), ky0 = vsubq_f32(one, ky1);
+            const uint8_t * s0 = src, * s1 = src + stride;
+            float32x4_t r[4];
+            for (size_t c = 0; c < N; ++c)
+            {
+                size_t c0 = c * 4, c1 = (c + N) * 4;
+                float32x4_t t0 = vaddq_f32(vmulq_f32(WarpLoad(s0 + c0, o), kx0), vmulq_f32(WarpLoad(s0 + c1, o), kx1));
+                float32x4_t t1 = vaddq_f32(vmulq_f32(WarpLoad(s1 + c0, o), kx0), vmulq_f32(WarpLoad(s1 + c1, o), kx1));
+                r[c] = vaddq_f32(vmulq_f32(t0, ky0), vmulq_f32(t1, ky1));
+            }
+            if (N == 1)
+                vst1q_f32(dst, r[0]);
+            else if (N == 2)
+            {
+                float32x4x2_t value = { r[0], r[1] };
+                vst2q_f32(dst, value);
+            }
+            else if (N == 3)
+            {
+                float32x4x3_t value = { r[0], r[1], r[2] };
+                vst3q_f32(dst, value);
+            }
+            else
+            {
+                float32x4x4_t value = { r[0], r[1], r[2], r[3] };
+                vst4q_f32(dst, value);
+            }
+        }
+
+        template<class T, size_t N> void WarpRow(const WarpParam & p, const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst)
+        {
+            size_t dstW = p.dstW, dstWF = AlignLo(dstW, F), x = 0;
+            int32x4_t w = vdupq_n_s32((int32_t)p.srcW - 1), h = vdupq_n_s32((int32_t)p.srcH - 1);
+            int32x4_t stride = vdupq_n_s32((int32_t)srcStride), size = vdupq_n_s32(int32_t(N * sizeof(T)));
+            uint32x4_t mask = vdupq_n_u32(WARP_MASK);
+            SIMD_ALIGNED(16) int32_t o[F];
+            for (; x < dstWF; x += F)
+            {
+                int32x4_t fx = vld1q_s32(sx + x);
+                int32x4_t fy = vld1q_s32(sy + x);
+                int32x4_t ix = vshrq_n_s32(fx, WARP_SHIFT);
+                int32x4_t iy = vshrq_n_s32(fy, WARP_SHIFT);
+                if (!WarpInside(ix, iy, w, h))
+                {
+                    Base::WarpRow<T, N>(p, src, srcStride, sx, sy, x, x + F, dst);
+                    continue;
+                }
+                vst1q_s32(o, vmlaq_s32(vmulq_s32(ix, size), iy, stride));
+                uint32x4_t _fx = vandq_u32(vreinterpretq_u32_s32(fx), mask);
+                uint32x4_t _fy = vandq_u32(vreinterpretq_u32_s32(fy), mask);
+                if (sizeof(T) == 1)
+                    WarpByte<N>(src, srcStride, o, _fx, _fy, dst + x * N);
+                else
+                    WarpFloat<N>(src, srcStride, o, _fx, _fy, (float*)dst + x * N);
+            }
+            Base::WarpRow<T, N>(p, src, srcStride, sx, sy, x, dstW, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        WarpBilinear::WarpBilinear(const WarpParam & param)
+            : Base::WarpBilinear(param)
+        {
+        }
+
+        void WarpBilinear::EstimateCoords(size_t y, int32_t * sx, int32_t * sy)
+        {
+            if (_param.perspective)
+            {
+                Base::WarpBilinear::EstimateCoords(y, sx, sy);
+                return;
+            }
+            const double * m = _param.inv;
+            int32_t x0 = Base::WarpRound(m[1] * y + m[2]), y0 = Base::WarpRound(m[4] * y + m[5]);
+            size_t dstW = _param.dstW, dstWF = AlignLo(dstW, F), x = 0;
+            int32x4_t _x0 = vdupq_n_s32(x0), _y0 = vdupq_n_s32(y0);
+            for (; x < dstWF; x += F)
+            {
+                vst1q_s32(sx + x, vaddq_s32(_x0, vld1q_s32(_ax.data + x)));
+                vst1q_s32(sy + x, vaddq_s32(_y0, vld1q_s32(_ay.data + x)));
+            }
+            for (; x < dstW; ++x)
+            {
+                sx[x] = x0 + _ax[x];
+                sy[x] = y0 + _ay[x];
+            }
+        }
+
+        void WarpBilinear::RunRow(const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst)
+        {
+            if (_param.type == SimdResizeChannelByte)
+            {
+                switch (_param.channels)
+                {
+                case 1: WarpRow<uint8_t, 1>(_param, src, srcStride, sx, sy, dst); break;
+                case 2: WarpRow<uint8_t, 2>(_param, src, srcStride, sx, sy, dst); break;
+                case 3: WarpRow<uint8_t, 3>(_param, src, srcStride, sx, sy, dst); break;
+                case 4: WarpRow<uint8_t, 4>(_param, src, srcStride, sx, sy, dst); break;
+                default: assert(0);
+                }
+            }
+            else
+            {
+                switch (_param.channels)
+                {
+                case 1: WarpRow<float, 1>(_param, src, srcStride, sx, sy, dst); break;
+                case 2: WarpRow<float, 2>(_param, src, srcStride, sx, sy, dst); break;
+                case 3: WarpRow<float, 3>(_param, src, srcStride, sx, sy, dst); break;
+                case 4: WarpRow<float, 4>(_param, src, srcStride, sx, sy, dst); break;
+                default: assert(0);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, false, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarpBilinear(param);
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, true, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarpBilinear(param);
+        }
+    }
+#endif//SIMD_NEON_ENABLE
+}
@@ -26,12 +26,371 @@
 
 #include <thread>
 #include <vector>
-#ifndef SIMD_FUTURE_DISABLE
-#include <future>
-#endif
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+#include <exception>
+#include <algorithm>
 
 namespace Simd
 {
+    /*! @ingroup cpp_parallel
+
+        \short ThreadPool is a persistent work-stealing thread pool which is used by function Simd::Parallel.
+
+        Each worker thread has its own task queue. External threads push tasks into the shared queue.
+        An idle worker takes tasks from the back of its own queue and steals them from the front of other queues.
+        The thread which waits for completion of its tasks executes pending tasks too, so nested calls of Simd::Parallel
+        do not create additional threads and never oversubscribe the machine. When there is nothing to execute it sleeps
+        until its tasks are completed.
+    */
+    class ThreadPool
+    {
+    public:
+        typedef std::function<void()> Task; /*!< A task type. */
+
+        /*!
+            Gets the global thread pool of Simd Library. It is created at first call without worker threads.
+            Worker threads are started when they are needed (see function ThreadPool::Execute), so their number
+            does not exceed (threadNumber - 1), where threadNumber is the largest number of threads requested by algorithms 
+            (see function ::SimdGetThreadNumber). Function ::SimdSetThreadNumber reduces the number of worker threads.
+
+            \return a reference to the global thread pool.
+        */
+        static ThreadPool & Global()
+        {
+            static ThreadPool pool(0);
+            return pool;
+        }
+
+        /*!
+            Creates a new thread pool.
+
+            \param [in] size - a number of worker threads. It is restricted by the number of hardware threads.
+        */
+        ThreadPool(size_t size)
+            : _queues(Capacity() + 1)
+            , _pending(0)
+            , _stop(false)
+            , _size(0)
+        {
+            Resize(size);
+        }
+
+        /*!
+            Stops and joins all worker threads.
+        */
+        ~ThreadPool()
+        {
+            Stop();
+        }
+
+        /*!
+            Gets current number of worker threads.
+
+            \return a number of worker threads.
+        */
+        size_t Size() const
+        {
+            return _size;
+        }
+
+        /*!
+            Changes the number of worker threads. Pending tasks are not lost: they are executed by new workers or by waiting threads.
+
+            \param [in] size - a new number of worker threads. It is restricted by the number of hardware threads.
+        */
+        void Resize(size_t size)
+        {
+            std::lock_guard<std::mutex> lock(_resize);
+            size = std::min(size, Capacity());
+            if (size < _threads.size())
+            {
+                Stop();
+                _stop = false;
+            }
+            Start(size);
+        }
+
+        /*!
+            Starts additional worker threads if current number of worker threads is less than given value. Running workers are not stopped.
+
+            \param [in] size - a required number of worker threads. It is restricted by the number of hardware threads.
+        */
+        void Reserve(size_t size)
+        {
+            size = std::min(size, Capacity());
+            if (size > _size)
+            {
+                std::lock_guard<std::mutex> lock(_resize);
+                Start(std::max<size_t>(size, _threads.size()));
+            }
+        }
+
+        /*!
+            Pushes a task to the pool. If it is called from a worker thread of this pool the task is pushed into the own queue of the worker.
+
+            \param [in] task - a task.
+        */
+        void Push(const Task & task)
+        {
+            Queue & queue = _queues[Current()];
+            {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back(task);
+            }
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _pending++;
+            }
+            _condition.notify_one();
+        }
+
+        /*!
+            Tries to take a pending task and execute it in the calling thread.
+
+            \return true if a task was executed.
+        */
+        bool RunOne()
+        {
+            Task task;
+            if (Pop(Current(), task))
+            {
+                task();
+                return true;
+            }
+            return false;
+        }
+
+        /*!
+            Executes task(index) for every index in range [0, count). Tasks with index > 0 are pushed to the pool (necessary worker threads 
+            are started by function ThreadPool::Reserve), the task with index 0 is executed in the calling thread. Then the calling thread 
+            executes pending tasks of the pool until all its tasks are completed, or sleeps if there is nothing to execute.
+            If some tasks throw exceptions, the first of them is rethrown in the calling thread after completion of all tasks.
+
+            \param [in] count - a number of tasks.
+            \param [in] task - a function with signature void(size_t index).
+        */
+        template<class Function> void Execute(size_t count, const Function & task)
+        {
+            if (count <= 1)
+            {
+                if (count)
+                    task(0);
+                return;
+            }
+            Reserve(count - 1);
+            Group group(count - 1);
+            for (size_t i = 1; i < count; ++i)
+            {
+                Push([i, &task, &group]
+                {
+                    Group::Guard guard(group);
+                    try
+                    {
+                        task(i);
+                    }
+                    catch (...)
+                    {
+                        group.Fail(std::current_exception());
+                    }
+                });
+            }
+            try
+            {
+                task(0);
+            }
+            catch (...)
+            {
+                group.Fail(std::current_exception());
+            }
+            while (!group.Finished())
+            {
+                if (!RunOne())
+                    group.Wait();
+            }
+            group.Rethrow();
+        }
+
+    private:
+        class Group
+        {
+        public:
+            struct Guard
+            {
+                Guard(Group & group) : _group(group) {}
+                ~Guard() { _group.Done(); }
+            private:
+                Group & _group;
+            };
+
+            Group(size_t count)
+                : _remain(count)
+            {
+            }
+
+            void Fail(std::exception_ptr error)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_error)
+                    _error = error;
+            }
+
+            bool Finished()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _remain == 0;
+            }
+
+            void Wait()
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _condition.wait(lock, [this] { return _remain == 0; });
+            }
+
+            void Rethrow()
+            {
+                if (_error)
+                    std::rethrow_exception(_error);
+            }
+
+        private:
+            size_t _remain;
+            std::exception_ptr _error;
+            std::mutex _mutex;
+            std::condition_variable _condition;
+
+            void Done()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (--_remain == 0)
+                    _condition.notify_all();
+            }
+        };
+
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        std::vector<Queue> _queues;
+        std::vector<std::thread> _threads;
+        std::mutex _mutex, _resize;
+        std::condition_variable _condition;
+        std::atomic<size_t> _pending;
+        std::atomic<bool> _stop;
+        std::atomic<size_t> _size;
+
+        static size_t Capacity()
+        {
+            return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        }
+
+        static ThreadPool * & Owner()
+        {
+            static thread_local ThreadPool * owner = NULL;
+            return owner;
+        }
+
+        static size_t & Index()
+        {
+            static thread_local size_t index = 0;
+            return index;
+        }
+
+        size_t Current() const
+        {
+            return Owner() == this ? Index() : 0;
+        }
+
+        bool Pop(size_t current, Task & task)
+        {
+            if (current && TakeBack(_queues[current], task))
+                return true;
+            for (size_t i = 0; i < _queues.size(); ++i)
+            {
+                if (i != current && TakeFront(_queues[i], task))
+                    return true;
+            }
+            return false;
+        }
+
+        bool TakeBack(Queue & queue, Task & task)
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+                return false;
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            _pending--;
+            return true;
+        }
+
+        bool TakeFront(Queue & queue, Task & task)
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+                return false;
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            _pending--;
+            return true;
+        }
+
+        void Work(size_t index)
+        {
+            Owner() = this;
+            Index() = index;
+            while (!_stop)
+            {
+                if (RunOne())
+                    continue;
+                std::unique_lock<std::mutex> lock(_mutex);
+                _condition.wait(lock, [this] { return _stop || _pending > 0; });
+            }
+        }
+
+        void Start(size_t size)
+        {
+            for (size_t i = _threads.size(); i < size; ++i)
+                _threads.push_back(std::thread(&ThreadPool::Work, this, i + 1));
+            _size = _threads.size();
+        }
+
+        void Stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _condition.notify_all();
+            for (size_t i = 0; i < _threads.size(); ++i)
+                if (_threads[i].joinable())
+                    _threads[i].join();
+            _threads.clear();
+            _size = 0;
+        }
+    };
+
+    /*! @ingroup cpp_parallel
+
+        \fn void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1);
+
+        \short Executes function for range [begin, end) splitted into blocks in the global thread pool (see Simd::ThreadPool).
+
+        The range is divided into (threadNumber) blocks aligned to (blockAlign). The calling thread executes the first block
+        and helps the pool with remaining ones while it waits for them (see function ThreadPool::Execute).
+        If function throws an exception, it is rethrown in the calling thread after completion of all blocks.
+
+        \param [in] begin - a begin of the range.
+        \param [in] end - an end of the range.
+        \param [in] function - a function with signature void(size_t block, size_t begin, size_t end). Every block has unique index in range [0, threadNumber).
+        \param [in] threadNumber - a maximal number of blocks.
+        \param [in] blockAlign - an alignment of block size. By default it is equal to 1.
+    */
     template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1)
     {
 #ifdef SIMD_FUTURE_DISABLE
@@ -42,22 +401,54 @@ namespace Simd
             function(0, begin, end);
         else
         {
-            std::vector<std::future<void>> futures;
-
             size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
             blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
-            size_t blockBegin = begin;
-            size_t blockEnd = blockBegin + blockSize;
-
-            for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
+            size_t blockCount = (end - begin + blockSize - 1) / blockSize;
+            ThreadPool::Global().Execute(blockCount, [begin, end, blockSize, &function](size_t block)
             {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
-                blockBegin += blockSize;
-                blockEnd = std::min(blockBegin + blockSize, end);
-            }
+                size_t blockBegin = begin + block * blockSize;
+                function(block, blockBegin, std::min(blockBegin + blockSize, end));
+            });
+        }
+#endif
+    }
+
+    /*! @ingroup cpp_parallel
+
+        \fn void ParallelDynamic(size_t begin, size_t end, const Function & function, size_t threadNumber);
+
+        \short Executes function for every index in range [begin, end) with dynamic scheduling in the global thread pool (see Simd::ThreadPool).
+
+        Unlike function Simd::Parallel the range is not divided into blocks beforehand: (threadNumber) workers take next index from shared 
+        atomic counter until the range is exhausted. It is useful when execution time of items is unequal or unknown in advance.
+        The calling thread is one of the workers. If function throws an exception, it is rethrown in the calling thread after completion of all workers.
 
-            for (size_t i = 0; i < futures.size(); ++i)
-                futures[i].wait();
+        \param [in] begin - a begin of the range.
+        \param [in] end - an end of the range.
+        \param [in] function - a function with signature void(size_t index).
+        \param [in] threadNumber - a maximal number of workers.
+    */
+    template<class Function> inline void ParallelDynamic(size_t begin, size_t end, const Function & function, size_t threadNumber)
+    {
+#ifdef SIMD_FUTURE_DISABLE
+        for (size_t i = begin; i < end; ++i)
+            function(i);
+#else
+        threadNumber = std::min<size_t>(threadNumber, std::thread::hardware_concurrency());
+        threadNumber = std::min<size_t>(threadNumber, end > begin ? end - begin : 0);
+        if (threadNumber <= 1)
+        {
+            for (size_t i = begin; i < end; ++i)
+                function(i);
+        }
+        else
+        {
+            std::atomic<size_t> next(begin);
+            ThreadPool::Global().Execute(threadNumber, [end, &function, &next](size_t)
+            {
+                for (size_t i = next++; i < end; i = next++)
+                    function(i);
+            });
         }
 #endif
     }
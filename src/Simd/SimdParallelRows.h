@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdParallelRows_h__
+#define __SimdParallelRows_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    const size_t PARALLEL_ROWS_MIN_CONVERT = 256 * 1024;
+    const size_t PARALLEL_ROWS_MIN_FILTER = 64 * 1024;
+
+    SIMD_INLINE bool & ParallelRowsInside()
+    {
+        static thread_local bool inside = false;
+        return inside;
+    }
+
+    SIMD_INLINE uint8_t * ParallelRowsBuffer(size_t size)
+    {
+        static thread_local Array8u buffer;
+        if (buffer.size < size)
+            buffer.Resize(size);
+        return buffer.data;
+    }
+
+    SIMD_INLINE size_t ParallelRowsNumber(size_t width, size_t height, size_t minSize, size_t minHeight)
+    {
+        if (ParallelRowsInside())
+            return 1;
+        size_t number = Base::GetThreadNumber();
+        number = Min(number, width * height / Max<size_t>(minSize, 1));
+        number = Min(number, height / Max<size_t>(minHeight, 1));
+        return number;
+    }
+
+    template<class Band> SIMD_INLINE void ParallelRowsRun(size_t height, size_t align, size_t number, Band band)
+    {
+        Simd::Parallel(0, number, [&](size_t thread, size_t begin, size_t end)
+        {
+            bool & inside = ParallelRowsInside();
+            bool outer = inside;
+            inside = true;
+            for (size_t i = begin; i < end; ++i)
+            {
+                size_t yBeg = AlignLoAny(height * i / number, align);
+                size_t yEnd = i + 1 == number ? height : AlignLoAny(height * (i + 1) / number, align);
+                if (yBeg < yEnd)
+                    band(yBeg, yEnd);
+            }
+            inside = outer;
+        }, number);
+    }
+
+    /*
+    * Splits an image into horizontal bands which are processed in the global thread pool.
+    * Function band(yBeg, yEnd) must process rows [yBeg, yEnd). Bands are aligned to (align) rows.
+    * It returns false if the image is too small (less than minSize pixels per band) or Base::GetThreadNumber() is 1.
+    * In this case the caller has to process the whole image itself.
+    */
+    template<class Band> SIMD_INLINE bool ParallelRows(size_t width, size_t height, size_t minSize, size_t align, Band band)
+    {
+        size_t number = ParallelRowsNumber(width, height, minSize, 2 * align);
+        if (number <= 1)
+            return false;
+        ParallelRowsRun(height, align, number, band);
+        return true;
+    }
+
+    /*
+    * Splits an output of a filter with (border) rows of vertical support into horizontal bands.
+    * Function band(yBeg, bandH, dst, dstStride) must process the source sub-image of (bandH) rows started from row (yBeg) 
+    * and store its output to (dst), so rows near the sub-image edges are processed as image borders. Every band writes its own output rows directly 
+    * and then recomputes (border) rows at each inner edge from a small overlapping sub-image into a scratch buffer.
+    * The scratch buffer belongs to the executing thread and is reused by following calls.
+    * It returns false if the image is too small (see ParallelRows above).
+    */
+    template<class Band> SIMD_INLINE bool ParallelRows(size_t width, size_t height, size_t minSize, size_t border, 
+        uint8_t * dst, size_t dstStride, size_t dstRowSize, Band band)
+    {
+        size_t number = ParallelRowsNumber(width, height, minSize, 3 * border);
+        if (number <= 1)
+            return false;
+        ParallelRowsRun(height, 1, number, [&](size_t yBeg, size_t yEnd)
+        {
+            band(yBeg, yEnd - yBeg, dst + yBeg * dstStride, dstStride);
+            if (border == 0)
+                return;
+            size_t stride = AlignHi(dstRowSize, SIMD_ALIGN);
+            uint8_t * buffer = ParallelRowsBuffer(3 * border * stride);
+            if (yBeg > 0)
+            {
+                band(yBeg - border, 3 * border, buffer, stride);
+                for (size_t row = 0; row < border; ++row)
+                    memcpy(dst + (yBeg + row) * dstStride, buffer + (border + row) * stride, dstRowSize);
+            }
+            if (yEnd < height)
+            {
+                band(yEnd - 2 * border, 3 * border, buffer, stride);
+                for (size_t row = 0; row < border; ++row)
+                    memcpy(dst + (yEnd - border + row) * dstStride, buffer + (border + row) * stride, dstRowSize);
+            }
+        });
+        return true;
+    }
+}
+
+#endif//__SimdParallelRows_h__
@@ -46,6 +46,16 @@ namespace Simd
             this->channels = channels;
             this->align = align;
         }
+
+        SIMD_INLINE bool IsFilter() const
+        {
+            return method == SimdResizeMethodBicubic || method == SimdResizeMethodLanczos3;
+        }
+
+        SIMD_INLINE size_t ChannelSize() const
+        {
+            return type == SimdResizeChannelFloat ? 4 : (type == SimdResizeChannelShort ? 2 : 1);
+        }
     };
 
     class Resizer : Deletable
@@ -58,6 +68,12 @@ namespace Simd
 
         virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
 
+        virtual size_t Stream(const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride)
+        {
+            assert(0);
+            return 0;
+        }
+
     protected:
         ResParam _param;
     };
@@ -110,7 +126,121 @@ namespace Simd
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
+        SIMD_INLINE uint16_t ResizerShortRound(float value)
+        {
+            // Values are not negative, so SIMD optimizations use the same rounding: add 0.5f and truncate.
+            return (uint16_t)Simd::RestrictRange(int(value + 0.5f), 0, 0xFFFF);
+        }
+
+        class ResizerShortBilinear : public ResizerFloatBilinear
+        {
+        protected:
+            void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+
+            virtual void RunX(const uint16_t * src, float * dst);
+
+            virtual void RunY(const float * src0, const float * src1, float fy, uint16_t * dst);
+
+        public:
+            ResizerShortBilinear(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerFloatArea : public Resizer
+        {
+        protected:
+            Array32i _ix, _iy;
+            Array32f _ax, _ay, _by;
+
+            void EstimateParams(size_t srcSize, size_t dstSize, float * alpha, int32_t * index);
+
+            void Run(const float * src, size_t srcStride, float * dst, size_t dstStride);
+
+            virtual void RowSum(const float * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst);
+
+            virtual void ColSum(const float * src, float * dst);
+
+        public:
+            ResizerFloatArea(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerShortArea : public ResizerFloatArea
+        {
+        protected:
+            void Run(const uint16_t * src, size_t srcStride, uint16_t * dst, size_t dstStride);
+
+            virtual void RowSum(const uint16_t * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst);
+
+        public:
+            ResizerShortArea(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerNearest : public Resizer
+        {
+        protected:
+            size_t _pixelSize;
+            Array32i _ix, _iy;
+
+            void EstimateIndex(size_t srcSize, size_t dstSize, size_t pixelSize, int32_t * indices);
+            template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        public:
+            ResizerNearest(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        const int32_t FILTER_RANGE = 1 << 11;
+        const int32_t FILTER_SHIFT_X = 7;
+        const int32_t FILTER_ROUND_X = 1 << (FILTER_SHIFT_X - 1);
+        const int32_t FILTER_SHIFT_Y = 15;
+        const int32_t FILTER_ROUND_Y = 1 << (FILTER_SHIFT_Y - 1);
+
+        void ResizerFilterEstimate(SimdResizeMethodType method, size_t srcSize, size_t dstSize, int32_t * first, int32_t * indices, float * alphas);
+
+        class ResizerByteFilter : public Resizer
+        {
+        protected:
+            size_t _sizeX, _sizeY, _stride, _srcRow, _dstRow;
+            Array32i _ix, _iy;
+            Array16i _ax, _ay, _bx;
+            Array<const int16_t*> _rows;
+
+            void RunX(const uint8_t * src, int16_t * dst);
+            virtual void RunY(const int16_t * const * src, const int16_t * alpha, size_t size, uint8_t * dst);
+        public:
+            ResizerByteFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            virtual size_t Stream(const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerFloatFilter : public Resizer
+        {
+        protected:
+            size_t _sizeX, _sizeY, _stride, _srcRow, _dstRow;
+            Array32i _ix, _iy;
+            Array32f _ax, _ay, _bx;
+            Array<const float*> _rows;
+
+            void RunX(const float * src, float * dst);
+            virtual void RunY(const float * const * src, const float * alpha, size_t size, float * dst);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+            virtual size_t Stream(const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 
 #ifdef SIMD_SSE_ENABLE    
@@ -123,7 +253,28 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerFloatFilter : public Base::ResizerFloatFilter
+        {
+        protected:
+            virtual void RunY(const float * const * src, const float * alpha, size_t size, float * dst);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+        };
+
+        class ResizerFloatArea : public Base::ResizerFloatArea
+        {
+        protected:
+            virtual void RowSum(const float * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst);
+
+            virtual void ColSum(const float * src, float * dst);
+
+        public:
+            ResizerFloatArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_SSE_ENABLE 
 
@@ -156,7 +307,17 @@ namespace Simd
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
+        class ResizerByteFilter : public Base::ResizerByteFilter
+        {
+        protected:
+            virtual void RunY(const int16_t * const * src, const int16_t * alpha, size_t size, uint8_t * dst);
+        public:
+            ResizerByteFilter(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_SSE2_ENABLE 
 
@@ -202,6 +363,26 @@ namespace Simd
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
+        class ResizerShortBilinear : public Base::ResizerShortBilinear
+        {
+        protected:
+            virtual void RunX(const uint16_t * src, float * dst);
+
+            virtual void RunY(const float * src0, const float * src1, float fy, uint16_t * dst);
+
+        public:
+            ResizerShortBilinear(const ResParam & param);
+        };
+
+        class ResizerShortArea : public Base::ResizerShortArea
+        {
+        protected:
+            virtual void RowSum(const uint16_t * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst);
+
+        public:
+            ResizerShortArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_SSE41_ENABLE
@@ -216,7 +397,28 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerFloatFilter : public Sse::ResizerFloatFilter
+        {
+        protected:
+            virtual void RunY(const float * const * src, const float * alpha, size_t size, float * dst);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+        };
+
+        class ResizerFloatArea : public Sse::ResizerFloatArea
+        {
+        protected:
+            virtual void RowSum(const float * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst);
+
+            virtual void ColSum(const float * src, float * dst);
+
+        public:
+            ResizerFloatArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX_ENABLE 
 
@@ -267,7 +469,47 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerNearest : public Base::ResizerNearest
+        {
+        protected:
+            void Run4(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        public:
+            ResizerNearest(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerByteFilter : public Sse2::ResizerByteFilter
+        {
+        protected:
+            virtual void RunY(const int16_t * const * src, const int16_t * alpha, size_t size, uint8_t * dst);
+        public:
+            ResizerByteFilter(const ResParam & param);
+        };
+
+        class ResizerShortBilinear : public Base::ResizerShortBilinear
+        {
+        protected:
+            virtual void RunX(const uint16_t * src, float * dst);
+
+            virtual void RunY(const float * src0, const float * src1, float fy, uint16_t * dst);
+
+        public:
+            ResizerShortBilinear(const ResParam & param);
+        };
+
+        class ResizerShortArea : public Base::ResizerShortArea
+        {
+        protected:
+            virtual void RowSum(const uint16_t * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst);
+
+        public:
+            ResizerShortArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX2_ENABLE 
 
@@ -281,7 +523,28 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerFloatFilter : public Avx::ResizerFloatFilter
+        {
+        protected:
+            virtual void RunY(const float * const * src, const float * alpha, size_t size, float * dst);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+        };
+
+        class ResizerFloatArea : public Avx::ResizerFloatArea
+        {
+        protected:
+            virtual void RowSum(const float * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst);
+
+            virtual void ColSum(const float * src, float * dst);
+
+        public:
+            ResizerFloatArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX512F_ENABLE 
 
@@ -309,7 +572,37 @@ namespace Simd
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
+        class ResizerByteFilter : public Avx2::ResizerByteFilter
+        {
+        protected:
+            virtual void RunY(const int16_t * const * src, const int16_t * alpha, size_t size, uint8_t * dst);
+        public:
+            ResizerByteFilter(const ResParam & param);
+        };
+
+        class ResizerShortBilinear : public Base::ResizerShortBilinear
+        {
+        protected:
+            virtual void RunX(const uint16_t * src, float * dst);
+
+            virtual void RunY(const float * src0, const float * src1, float fy, uint16_t * dst);
+
+        public:
+            ResizerShortBilinear(const ResParam & param);
+        };
+
+        class ResizerShortArea : public Base::ResizerShortArea
+        {
+        protected:
+            virtual void RowSum(const uint16_t * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst);
+
+        public:
+            ResizerShortArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX512BW_ENABLE 
 
@@ -357,7 +650,56 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerByteFilter : public Base::ResizerByteFilter
+        {
+        protected:
+            virtual void RunY(const int16_t * const * src, const int16_t * alpha, size_t size, uint8_t * dst);
+        public:
+            ResizerByteFilter(const ResParam & param);
+        };
+
+        class ResizerFloatFilter : public Base::ResizerFloatFilter
+        {
+        protected:
+            virtual void RunY(const float * const * src, const float * alpha, size_t size, float * dst);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+        };
+
+        class ResizerFloatArea : public Base::ResizerFloatArea
+        {
+        protected:
+            virtual void RowSum(const float * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst);
+
+            virtual void ColSum(const float * src, float * dst);
+
+        public:
+            ResizerFloatArea(const ResParam & param);
+        };
+
+        class ResizerShortBilinear : public Base::ResizerShortBilinear
+        {
+        protected:
+            virtual void RunX(const uint16_t * src, float * dst);
+
+            virtual void RunY(const float * src0, const float * src1, float fy, uint16_t * dst);
+
+        public:
+            ResizerShortBilinear(const ResParam & param);
+        };
+
+        class ResizerShortArea : public Base::ResizerShortArea
+        {
+        protected:
+            virtual void RowSum(const uint16_t * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst);
+
+        public:
+            ResizerShortArea(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_NEON_ENABLE 
 }
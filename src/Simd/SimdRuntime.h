@@ -31,6 +31,8 @@
 #include <limits>
 #include <algorithm>
 #include <string>
+#include <map>
+#include <mutex>
 #ifdef SIMD_RUNTIME_STATISTIC
 #include <sstream>
 #include <iostream>
@@ -41,10 +43,39 @@ namespace Simd
 {
     typedef ::std::string String;
 
+    class RuntimeCache
+    {
+    public:
+        static RuntimeCache & Global();
+
+        bool Find(const String & key, String & name) const;
+        void Update(const String & key, const String & name);
+        size_t Updates() const;
+
+        bool Load(const String & path);
+        bool Save(const String & path) const;
+        void Clear();
+
+    private:
+        RuntimeCache();
+
+        String Full(const String & key) const;
+
+        typedef std::map<String, String> Map;
+
+        String _id;
+        Map _map;
+        size_t _updates;
+        mutable std::mutex _mutex;
+    };
+
+    //-------------------------------------------------------------------------
+
     template <class Func, class Args> struct Runtime
     {
         SIMD_INLINE Runtime()
             : _best(NULL)
+            , _cached(false)
         {
         }
 
@@ -68,6 +99,7 @@ namespace Simd
             _candidates.clear();
             _candidates.push_back(Candidate(func));
             _best = &_candidates[0].func;
+            _cached = true;
         }
 
         SIMD_INLINE void Init(const std::vector<Func> & funcs)
@@ -77,6 +109,7 @@ namespace Simd
             for (size_t i = 0; i < funcs.size(); ++i)
                 _candidates.push_back(Candidate(funcs[i]));
             _best = funcs.size() == 1 ? &_candidates[0].func : NULL;
+            _cached = _best != NULL;
         }
 
         SIMD_INLINE void Run(const Args & args)
@@ -132,11 +165,21 @@ namespace Simd
 
         Func * _best;
         Candidates _candidates;
-        String _info;
+        String _info, _key;
+        bool _cached;
 
         SIMD_INLINE void Test(const Args & args)
         {
             assert(_candidates.size());
+            if (!_cached)
+            {
+                _cached = true;
+                if (Cached(args))
+                {
+                    _best->Run(args);
+                    return;
+                }
+            }
             Candidate * current = Current();
             if (current)
             {
@@ -151,10 +194,31 @@ namespace Simd
             else
             {
                 _best = &Best()->func;
+                RuntimeCache::Global().Update(_key, _best->Name());
                 _best->Run(args);
             }
         }
 
+        SIMD_INLINE bool Cached(const Args & args)
+        {
+            _key = args.Key();
+            for (size_t i = 0; i < _candidates.size(); ++i)
+                _key += (i ? "," : ":") + _candidates[i].func.Name();
+            String name;
+            if (RuntimeCache::Global().Find(_key, name))
+            {
+                for (size_t i = 0; i < _candidates.size(); ++i)
+                {
+                    if (_candidates[i].func.Name() == name)
+                    {
+                        _best = &_candidates[i].func;
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
         SIMD_INLINE Candidate * Current()
         {
             size_t min = TEST_COUNT;
@@ -195,6 +259,11 @@ namespace Simd
         SIMD_INLINE GemmArgs(size_t M_, size_t N_, size_t K_, const float * alpha_, const float * A_, size_t lda_, const float * B_, size_t ldb_, const float * beta_, float * C_, size_t ldc_)
             :M(M_), N(N_), K(K_), alpha(alpha_), A(A_), lda(lda_), B(B_), ldb(ldb_), beta(beta_), ldc(ldc_), C(C_) 
         {}
+
+        SIMD_INLINE String Key() const
+        {
+            return "Gemm-" + ToStr(M) + "-" + ToStr(N) + "-" + ToStr(K) + "-" + ToStr(lda) + "-" + ToStr(ldb) + "-" + ToStr(ldc);
+        }
     };
 
     struct GemmFunc
@@ -248,6 +317,11 @@ namespace Simd
         SIMD_INLINE GemmCbArgs(size_t M_, size_t N_, size_t K_, const float * A_, const float * pB_, float * C_)
             :M(M_), N(N_), K(K_), A(A_), pB(pB_), C(C_)
         {}
+
+        SIMD_INLINE String Key() const
+        {
+            return "GemmCb-" + ToStr(M) + "-" + ToStr(N) + "-" + ToStr(K);
+        }
     };
 
     struct GemmCbFunc
@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdUpdate.h"
 
 namespace Simd
 {
@@ -115,14 +116,112 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Base::ResizerFloatFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerFloatFilterRowY(const float * const * src, const float * alpha, size_t size, size_t offset, float * dst)
+        {
+            __m128 sum = _mm_mul_ps(_mm_loadu_ps(src[0] + offset), _mm_set1_ps(alpha[0]));
+            for (size_t k = 1; k < size; ++k)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src[k] + offset), _mm_set1_ps(alpha[k])));
+            _mm_storeu_ps(dst + offset, sum);
+        }
+
+        void ResizerFloatFilter::RunY(const float * const * src, const float * alpha, size_t size, float * dst)
+        {
+            if (size < F)
+            {
+                Base::ResizerFloatFilter::RunY(src, alpha, size, dst);
+                return;
+            }
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                ResizerFloatFilterRowY(src, alpha, _sizeY, i, dst);
+            if (sizeF < size)
+                ResizerFloatFilterRowY(src, alpha, _sizeY, size - F, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatArea::ResizerFloatArea(const ResParam & param)
+            : Base::ResizerFloatArea(param)
+        {
+        }
+
+        template<UpdateType update> SIMD_INLINE void ResizerFloatAreaRowUpdate(const float * src, size_t size, float a, float * dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m128 alpha = _mm_set1_ps(a);
+            for (; i < sizeF; i += F)
+                Update<update, false>(dst + i, _mm_mul_ps(_mm_loadu_ps(src + i), alpha));
+            for (; i < size; ++i)
+                Base::Update<update>(dst + i, src[i] * a);
+        }
+
+        void ResizerFloatArea::RowSum(const float * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst)
+        {
+            ResizerFloatAreaRowUpdate<UpdateSet>(src, size, count ? curr : curr - next, dst);
+            for (size_t i = 1; i <= count; ++i)
+                src += stride, ResizerFloatAreaRowUpdate<UpdateAdd>(src, size, i < count ? zero : zero - next, dst);
+        }
+
+        SIMD_INLINE void ResizerFloatAreaColSum(const float * src, size_t stride, size_t count, __m128 curr, __m128 zero, __m128 next, float * dst)
+        {
+            __m128 sum = _mm_mul_ps(_mm_loadu_ps(src), curr);
+            for (size_t i = 0; i < count; ++i)
+                src += stride, sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src), zero));
+            _mm_storeu_ps(dst, _mm_sub_ps(sum, _mm_mul_ps(_mm_loadu_ps(src), next)));
+        }
+
+        void ResizerFloatArea::ColSum(const float * src, float * dst)
+        {
+            size_t cn = _param.channels;
+            if (cn < F)
+            {
+                Base::ResizerFloatArea::ColSum(src, dst);
+                return;
+            }
+            size_t cnF = AlignLo(cn, F);
+            const int32_t * ix = _ix.data;
+            const float * ax = _ax.data;
+            __m128 zero = _mm_set1_ps(ax[0]);
+            for (size_t dx = 0; dx < _param.dstW; dx++, dst += cn)
+            {
+                size_t count = ix[dx + 1] - ix[dx];
+                __m128 curr = _mm_set1_ps(ax[dx]), next = _mm_set1_ps(ax[dx + 1]);
+                for (size_t c = 0; c < cnF; c += F)
+                    ResizerFloatAreaColSum(src + c, cn, count, curr, zero, next, dst + c);
+                if (cnF < cn)
+                    ResizerFloatAreaColSum(src + cn - F, cn, count, curr, zero, next, dst + cn - F);
+                src += count * cn;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m128));
             if (type == SimdResizeChannelFloat && (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp))
                 return new ResizerFloatBilinear(param);
+            else if (type == SimdResizeChannelFloat && method == SimdResizeMethodArea)
+                return new ResizerFloatArea(param);
+            else if (type == SimdResizeChannelFloat && (param.IsFilter() || method == SimdResizeMethodBilinearAntiAlias))
+                return new ResizerFloatFilter(param);
             else
                 return Base::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m128));
+            if (type == SimdResizeChannelFloat && (method == SimdResizeMethodBilinear || method == SimdResizeMethodBilinearAntiAlias || param.IsFilter()))
+                return new ResizerFloatFilter(param);
+            else
+                return Base::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+        }
     }
 #endif //SIMD_SSE_ENABLE 
 }
@@ -23,7 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
-#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
 
 namespace Simd
 {
@@ -343,6 +343,242 @@ namespace Simd
             else
                 BgraToYuva420p<false>(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
         }
+
+        template <class T, bool align> SIMD_INLINE __m128i LoadAndConvertY16V2(const __m128i * bgra, __m128i & b16_r16, __m128i & g16_1)
+        {
+            __m128i _b16_r16[2], _g16_1[2];
+            LoadPreparedBgra16<align>(bgra + 0, _b16_r16[0], _g16_1[0]);
+            LoadPreparedBgra16<align>(bgra + 1, _b16_r16[1], _g16_1[1]);
+            b16_r16 = HorizontalAdd32(_b16_r16[0], _b16_r16[1]);
+            g16_1 = HorizontalAdd32(_g16_1[0], _g16_1[1]);
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::Y_LO), _mm_packs_epi32(BgrToY32<T>(_b16_r16[0], _g16_1[0]), BgrToY32<T>(_b16_r16[1], _g16_1[1]))));
+        }
+
+        template <class T, bool align> SIMD_INLINE __m128i LoadAndConvertY8V2(const __m128i * bgra, __m128i b16_r16[2], __m128i g16_1[2])
+        {
+            return _mm_packus_epi16(LoadAndConvertY16V2<T, align>(bgra + 0, b16_r16[0], g16_1[0]), LoadAndConvertY16V2<T, align>(bgra + 2, b16_r16[1], g16_1[1]));
+        }
+
+        template <class T> SIMD_INLINE __m128i ConvertY16V2(__m128i b16_r16[2], __m128i g16_1[2])
+        {
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::Y_LO), _mm_packs_epi32(BgrToY32<T>(b16_r16[0], g16_1[0]), BgrToY32<T>(b16_r16[1], g16_1[1]))));
+        }
+
+        template <class T> SIMD_INLINE __m128i ConvertU16V2(__m128i b16_r16[2], __m128i g16_1[2])
+        {
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::UV_Z), _mm_packs_epi32(BgrToU32<T>(b16_r16[0], g16_1[0]), BgrToU32<T>(b16_r16[1], g16_1[1]))));
+        }
+
+        template <class T> SIMD_INLINE __m128i ConvertV16V2(__m128i b16_r16[2], __m128i g16_1[2])
+        {
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::UV_Z), _mm_packs_epi32(BgrToV32<T>(b16_r16[0], g16_1[0]), BgrToV32<T>(b16_r16[1], g16_1[1]))));
+        }
+
+        template <class T, bool align> SIMD_INLINE void BgraToYuv420pV2(const uint8_t * bgra0, size_t bgraStride, uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            const uint8_t * bgra1 = bgra0 + bgraStride;
+            uint8_t * y1 = y0 + yStride;
+
+            __m128i _b16_r16[2][2][2], _g16_1[2][2][2];
+            Store<align>((__m128i*)y0 + 0, LoadAndConvertY8V2<T, align>((__m128i*)bgra0 + 0, _b16_r16[0][0], _g16_1[0][0]));
+            Store<align>((__m128i*)y0 + 1, LoadAndConvertY8V2<T, align>((__m128i*)bgra0 + 4, _b16_r16[0][1], _g16_1[0][1]));
+            Store<align>((__m128i*)y1 + 0, LoadAndConvertY8V2<T, align>((__m128i*)bgra1 + 0, _b16_r16[1][0], _g16_1[1][0]));
+            Store<align>((__m128i*)y1 + 1, LoadAndConvertY8V2<T, align>((__m128i*)bgra1 + 4, _b16_r16[1][1], _g16_1[1][1]));
+
+            Average16(_b16_r16[0][0][0], _b16_r16[1][0][0]);
+            Average16(_b16_r16[0][0][1], _b16_r16[1][0][1]);
+            Average16(_b16_r16[0][1][0], _b16_r16[1][1][0]);
+            Average16(_b16_r16[0][1][1], _b16_r16[1][1][1]);
+
+            Average16(_g16_1[0][0][0], _g16_1[1][0][0]);
+            Average16(_g16_1[0][0][1], _g16_1[1][0][1]);
+            Average16(_g16_1[0][1][0], _g16_1[1][1][0]);
+            Average16(_g16_1[0][1][1], _g16_1[1][1][1]);
+
+            Store<align>((__m128i*)u, _mm_packus_epi16(ConvertU16V2<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertU16V2<T>(_b16_r16[0][1], _g16_1[0][1])));
+            Store<align>((__m128i*)v, _mm_packus_epi16(ConvertV16V2<T>(_b16_r16[0][0], _g16_1[0][0]), ConvertV16V2<T>(_b16_r16[0][1], _g16_1[0][1])));
+        }
+
+        template <class T, bool align> void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, DA);
+            const size_t A8 = A * 8;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colUV = 0, colY = 0, colBgra = 0; colY < alignedWidth; colY += DA, colUV += A, colBgra += A8)
+                    BgraToYuv420pV2<T, align>(bgra + colBgra, bgraStride, y + colY, yStride, u + colUV, v + colUV);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - DA;
+                    BgraToYuv420pV2<T, false>(bgra + offset * 4, bgraStride, y + offset, yStride, u + offset / 2, v + offset / 2);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2 * bgraStride;
+            }
+        }
+
+        template <class T> void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
+                BgraToYuv420pV2<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgraToYuv420pV2<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv420pV2<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv420pV2<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv420pV2<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgraToYuv420pV2<Base::Trect871>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align> SIMD_INLINE void BgraToYuv422pV2(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
+        {
+            __m128i _b16_r16[2][2], _g16_1[2][2];
+            Store<align>((__m128i*)y + 0, LoadAndConvertY8V2<T, align>((__m128i*)bgra + 0, _b16_r16[0], _g16_1[0]));
+            Store<align>((__m128i*)y + 1, LoadAndConvertY8V2<T, align>((__m128i*)bgra + 4, _b16_r16[1], _g16_1[1]));
+
+            Average16(_b16_r16);
+            Average16(_g16_1);
+
+            Store<align>((__m128i*)u, _mm_packus_epi16(ConvertU16V2<T>(_b16_r16[0], _g16_1[0]), ConvertU16V2<T>(_b16_r16[1], _g16_1[1])));
+            Store<align>((__m128i*)v, _mm_packus_epi16(ConvertV16V2<T>(_b16_r16[0], _g16_1[0]), ConvertV16V2<T>(_b16_r16[1], _g16_1[1])));
+        }
+
+        template <class T, bool align> void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (width >= DA));
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, DA);
+            const size_t A8 = A * 8;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t colUV = 0, colY = 0, colBgra = 0; colY < alignedWidth; colY += DA, colUV += A, colBgra += A8)
+                    BgraToYuv422pV2<T, align>(bgra + colBgra, y + colY, u + colUV, v + colUV);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - DA;
+                    BgraToYuv422pV2<T, false>(bgra + offset * 4, y + offset, u + offset / 2, v + offset / 2);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgra += bgraStride;
+            }
+        }
+
+        template <class T> void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
+                BgraToYuv422pV2<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgraToYuv422pV2<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv422pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv422pV2<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv422pV2<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv422pV2<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgraToYuv422pV2<Base::Trect871>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <class T, bool align> SIMD_INLINE void BgraToYuv444pV2(const uint8_t * bgra, uint8_t * y, uint8_t * u, uint8_t * v)
+        {
+            __m128i _b16_r16[2][2], _g16_1[2][2];
+            LoadPreparedBgra16<align>((__m128i*)bgra + 0, _b16_r16[0][0], _g16_1[0][0]);
+            LoadPreparedBgra16<align>((__m128i*)bgra + 1, _b16_r16[0][1], _g16_1[0][1]);
+            LoadPreparedBgra16<align>((__m128i*)bgra + 2, _b16_r16[1][0], _g16_1[1][0]);
+            LoadPreparedBgra16<align>((__m128i*)bgra + 3, _b16_r16[1][1], _g16_1[1][1]);
+
+            Store<align>((__m128i*)y, _mm_packus_epi16(ConvertY16V2<T>(_b16_r16[0], _g16_1[0]), ConvertY16V2<T>(_b16_r16[1], _g16_1[1])));
+            Store<align>((__m128i*)u, _mm_packus_epi16(ConvertU16V2<T>(_b16_r16[0], _g16_1[0]), ConvertU16V2<T>(_b16_r16[1], _g16_1[1])));
+            Store<align>((__m128i*)v, _mm_packus_epi16(ConvertV16V2<T>(_b16_r16[0], _g16_1[0]), ConvertV16V2<T>(_b16_r16[1], _g16_1[1])));
+        }
+
+        template <class T, bool align> void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert(width >= A);
+            if (align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, colBgra = 0; col < alignedWidth; col += A, colBgra += QA)
+                    BgraToYuv444pV2<T, align>(bgra + colBgra, y + col, u + col, v + col);
+                if (width != alignedWidth)
+                {
+                    size_t offset = width - A;
+                    BgraToYuv444pV2<T, false>(bgra + offset * 4, y + offset, u + offset, v + offset);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgra += bgraStride;
+            }
+        }
+
+        template <class T> void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
+                BgraToYuv444pV2<T, true>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+            else
+                BgraToYuv444pV2<T, false>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride);
+        }
+
+        void BgraToYuv444pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgraToYuv444pV2<Base::Bt601>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: BgraToYuv444pV2<Base::Bt709>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: BgraToYuv444pV2<Base::Bt2020>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvTrect871: BgraToYuv444pV2<Base::Trect871>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
     }
 #endif// SIMD_SSE2_ENABLE
 }
@@ -294,6 +294,42 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Base::ResizerByteFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowY(const int16_t * const * src, const int16_t * alpha, size_t size, size_t offset, uint8_t * dst)
+        {
+            __m128i lo = _mm_set1_epi32(Base::FILTER_ROUND_Y), hi = lo;
+            for (size_t k = 0; k < size; k += 2)
+            {
+                __m128i s0 = _mm_loadu_si128((__m128i*)(src[k + 0] + offset));
+                __m128i s1 = _mm_loadu_si128((__m128i*)(src[k + 1] + offset));
+                __m128i a = _mm_set1_epi32(*(int32_t*)(alpha + k));
+                lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(s0, s1), a));
+                hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(s0, s1), a));
+            }
+            __m128i res = _mm_packs_epi32(_mm_srai_epi32(lo, Base::FILTER_SHIFT_Y), _mm_srai_epi32(hi, Base::FILTER_SHIFT_Y));
+            _mm_storel_epi64((__m128i*)(dst + offset), _mm_packus_epi16(res, res));
+        }
+
+        void ResizerByteFilter::RunY(const int16_t * const * src, const int16_t * alpha, size_t size, uint8_t * dst)
+        {
+            if (size < HA)
+            {
+                Base::ResizerByteFilter::RunY(src, alpha, size, dst);
+                return;
+            }
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                ResizerByteFilterRowY(src, alpha, _sizeY, i, dst);
+            if (sizeHA < size)
+                ResizerByteFilterRowY(src, alpha, _sizeY, size - HA, dst);
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m128i));
@@ -301,9 +337,20 @@ namespace Simd
                 return new ResizerByteBilinear(param);
             else if (type == SimdResizeChannelByte && method == SimdResizeMethodArea)
                 return new ResizerByteArea(param);
+            else if (type == SimdResizeChannelByte && param.IsFilter())
+                return new ResizerByteFilter(param);
             else
                 return Sse::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
+
+        void * ResizerStreamInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m128i));
+            if (type == SimdResizeChannelByte && (method == SimdResizeMethodBilinear || param.IsFilter()))
+                return new ResizerByteFilter(param);
+            else
+                return Sse::ResizerStreamInit(srcX, srcY, dstX, dstY, channels, type, method);
+        }
     }
 #endif//SIMD_SSE2_ENABLE
 }
@@ -0,0 +1,115 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetImageToTensor.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE
+    namespace Sse2
+    {
+        SynetImageToTensor::SynetImageToTensor(const ImgToTenParam & param)
+            : Base::SynetImageToTensor(param)
+        {
+            SetConverters(Base::BgraToBgr, Base::GrayToBgr,
+                param.srcW >= A ? Sse2::BgrToGray : Base::BgrToGray,
+                param.srcW >= A ? Sse2::BgraToGray : Base::BgraToGray,
+                param.srcW / 2 >= A ? Sse2::DeinterleaveUv : Base::DeinterleaveUv, Base::Yuv420pToBgr);
+        }
+
+        SIMD_INLINE void SynetImageToTensorRowX(const uint8_t * src, const int32_t * ix, const float * ax, size_t dx, size_t i, float * dst)
+        {
+            const int32_t * o = ix + i;
+            __m128 s0 = _mm_cvtepi32_ps(_mm_setr_epi32(src[o[0]], src[o[1]], src[o[2]], src[o[3]]));
+            __m128 s1 = _mm_cvtepi32_ps(_mm_setr_epi32(src[o[0] + dx], src[o[1] + dx], src[o[2] + dx], src[o[3] + dx]));
+            _mm_storeu_ps(dst + i, _mm_add_ps(s0, _mm_mul_ps(_mm_sub_ps(s1, s0), _mm_loadu_ps(ax + i))));
+        }
+
+        void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst)
+        {
+            if (size < F)
+            {
+                Base::SynetImageToTensorRowX(src, srcSize, ix, ax, dx, size, dst);
+                return;
+            }
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                SynetImageToTensorRowX(src, ix, ax, dx, i, dst);
+            if (sizeF < size)
+                SynetImageToTensorRowX(src, ix, ax, dx, size - F, dst);
+        }
+
+        void SynetImageToTensor::RunX(const uint8_t * src, float * dst)
+        {
+            SynetImageToTensorRowX(src, _rowSize, _ix.data, _ax.data, _dx, _size, dst);
+        }
+
+        SIMD_INLINE void SynetImageToTensorRowY(const float * src0, const float * src1, __m128 alpha, const float * scale, const float * shift, size_t i, float * dst)
+        {
+            __m128 s0 = _mm_loadu_ps(src0 + i);
+            __m128 s = _mm_add_ps(s0, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src1 + i), s0), alpha));
+            _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(s, _mm_loadu_ps(scale + i)), _mm_loadu_ps(shift + i)));
+        }
+
+        void SynetImageToTensorRowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            if (size < F)
+            {
+                Base::SynetImageToTensorRowY(src0, src1, alpha, scale, shift, size, dst);
+                return;
+            }
+            __m128 _alpha = _mm_set1_ps(alpha);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                SynetImageToTensorRowY(src0, src1, _alpha, scale, shift, i, dst);
+            if (sizeF < size)
+                SynetImageToTensorRowY(src0, src1, _alpha, scale, shift, size - F, dst);
+        }
+
+        void SynetImageToTensor::RowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            SynetImageToTensorRowY(src0, src1, alpha, scale, shift, size, dst);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat)
+        {
+            ImgToTenParam param(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+            if (!param.Valid())
+                return NULL;
+            return new SynetImageToTensor(param);
+        }
+
+        void * SynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale)
+        {
+            CropResParam param(channels, dstWidth, dstHeight, dstFormat, dstType, keepAspect, mean, scale);
+            if (!param.Valid())
+                return NULL;
+            return new Base::SynetCropResize(param, Sse2::SynetImageToTensorRowX, Sse2::SynetImageToTensorRowY);
+        }
+    }
+#endif//SIMD_SSE2_ENABLE
+}
@@ -164,6 +164,7 @@ namespace Simd
             typedef HidHaarCascade Hid;
             const float * leaves = hid.leaves.data();
             const Hid::Node * node = hid.nodes.data();
+            const Hid::Feature * feature = hid.features.data();
             const Hid::Stage * stages = hid.stages.data();
             for (int i = 0, n = (int)hid.stages.size(); i < n; ++i)
             {
@@ -174,21 +175,19 @@ namespace Simd
                 __m128 stageSum = _mm_setzero_ps();
                 if (stage.hasThree)
                 {
-                    for (; node < end; ++node, leaves += 2)
+                    for (; node < end; ++node, ++feature, leaves += 2)
                     {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        __m128 sum = _mm_add_ps(WeightedSum32f(feature.rect[0], offset), WeightedSum32f(feature.rect[1], offset));
-                        if (feature.rect[2].p0)
-                            sum = _mm_add_ps(sum, WeightedSum32f(feature.rect[2], offset));
+                        __m128 sum = _mm_add_ps(WeightedSum32f(feature->rect[0], offset), WeightedSum32f(feature->rect[1], offset));
+                        if (feature->rect[2].p0)
+                            sum = _mm_add_ps(sum, WeightedSum32f(feature->rect[2], offset));
                         StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                     }
                 }
                 else
                 {
-                    for (; node < end; ++node, leaves += 2)
+                    for (; node < end; ++node, ++feature, leaves += 2)
                     {
-                        const Hid::Feature & feature = hid.features[node->featureIdx];
-                        __m128 sum = _mm_add_ps(WeightedSum32f(feature.rect[0], offset), WeightedSum32f(feature.rect[1], offset));
+                        __m128 sum = _mm_add_ps(WeightedSum32f(feature->rect[0], offset), WeightedSum32f(feature->rect[1], offset));
                         StageSum32f(leaves, node->threshold, sum, norm, stageSum);
                     }
                 }
@@ -409,7 +408,6 @@ namespace Simd
             size_t subsetSize = (hid.ncategories + 31) / 32;
             const int * subsets = hid.subsets.data();
             const Hid::Leave * leaves = hid.leaves.data();
-            const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
             int nodeOffset = 0, leafOffset = 0;
             for (int i_stage = 0, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
@@ -418,7 +416,7 @@ namespace Simd
                 __m128 sum = _mm_setzero_ps();
                 for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
                 {
-                    const Hid::Feature & feature = hid.features[nodes[nodeOffset].featureIdx];
+                    const Hid::Feature & feature = hid.features[nodeOffset];
                     const int * subset = subsets + nodeOffset*subsetSize;
                     __m128i mask = LeafMask(feature, offset, subset);
                     sum = _mm_add_ps(sum, _mm_blendv_ps(_mm_set1_ps(leaves[leafOffset + 1]),
@@ -629,7 +627,6 @@ namespace Simd
             size_t subsetSize = (hid.ncategories + 31) / 32;
             const int * subsets = hid.subsets.data();
             const Hid::Leave * leaves = hid.leaves.data();
-            const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
             int nodeOffset = 0, leafOffset = 0;
             for (int i_stage = 0, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
@@ -638,7 +635,7 @@ namespace Simd
                 __m128i sum = _mm_setzero_si128();
                 for (int i_tree = 0, n_trees = stage.ntrees; i_tree < n_trees; i_tree++)
                 {
-                    const Hid::Feature & feature = hid.features[nodes[nodeOffset].featureIdx];
+                    const Hid::Feature & feature = hid.features[nodeOffset];
                     const int * subset = subsets + nodeOffset*subsetSize;
                     __m128i mask = LeafMask(feature, offset, subset);
                     sum = _mm_add_epi16(sum, _mm_blendv_epi8(_mm_set1_epi16(leaves[leafOffset + 1]),
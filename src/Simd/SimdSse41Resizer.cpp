@@ -197,11 +197,103 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerShortBilinear::ResizerShortBilinear(const ResParam & param)
+            : Base::ResizerShortBilinear(param)
+        {
+        }
+
+        SIMD_INLINE __m128i ResizerShortLoad(const uint16_t * src, const int32_t * ix, size_t offset)
+        {
+            return _mm_setr_epi32(*(int32_t*)(src + ix[0] + offset), *(int32_t*)(src + ix[1] + offset), 
+                *(int32_t*)(src + ix[2] + offset), *(int32_t*)(src + ix[3] + offset));
+        }
+
+        void ResizerShortBilinear::RunX(const uint16_t * src, float * dst)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn, rsF = AlignLo(rs, F);
+            const int32_t * ix = _ix.data;
+            const float * ax = _ax.data;
+            __m128 _1 = _mm_set1_ps(1.0f);
+            __m128i lo = _mm_set1_epi32(0xFFFF);
+            size_t dx = 0;
+            for (; dx < rsF; dx += F)
+            {
+                __m128i s0 = ResizerShortLoad(src, ix + dx, 0);
+                __m128i s1 = cn == 1 ? s0 : ResizerShortLoad(src, ix + dx, cn - 1);
+                __m128 fx1 = _mm_loadu_ps(ax + dx);
+                __m128 fx0 = _mm_sub_ps(_1, fx1);
+                __m128 m0 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(s0, lo)), fx0);
+                __m128 m1 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(s1, 16)), fx1);
+                _mm_storeu_ps(dst + dx, _mm_add_ps(m0, m1));
+            }
+            for (; dx < rs; dx++)
+            {
+                int32_t sx = ix[dx];
+                float fx = ax[dx];
+                dst[dx] = src[sx] * (1.0f - fx) + src[sx + cn] * fx;
+            }
+        }
+
+        SIMD_INLINE __m128i ResizerShortRunY(const float * src0, const float * src1, __m128 fy0, __m128 fy1)
+        {
+            __m128 value = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src0), fy0), _mm_mul_ps(_mm_loadu_ps(src1), fy1));
+            return _mm_cvttps_epi32(_mm_add_ps(value, _mm_set1_ps(0.5f)));
+        }
+
+        void ResizerShortBilinear::RunY(const float * src0, const float * src1, float fy, uint16_t * dst)
+        {
+            size_t rs = _param.dstW * _param.channels, rsDF = AlignLo(rs, DF);
+            __m128 _fy0 = _mm_set1_ps(1.0f - fy), _fy1 = _mm_set1_ps(fy);
+            size_t dx = 0;
+            for (; dx < rsDF; dx += DF)
+            {
+                __m128i d0 = ResizerShortRunY(src0 + dx + 0, src1 + dx + 0, _fy0, _fy1);
+                __m128i d1 = ResizerShortRunY(src0 + dx + F, src1 + dx + F, _fy0, _fy1);
+                _mm_storeu_si128((__m128i*)(dst + dx), _mm_packus_epi32(d0, d1));
+            }
+            for (; dx < rs; dx++)
+                dst[dx] = Base::ResizerShortRound(src0[dx] * (1.0f - fy) + src1[dx] * fy);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerShortArea::ResizerShortArea(const ResParam & param)
+            : Base::ResizerShortArea(param)
+        {
+        }
+
+        template<UpdateType update> SIMD_INLINE void ResizerShortAreaRowUpdate(const uint16_t * src, size_t size, float a, float * dst)
+        {
+            size_t sizeHA = AlignLo(size, HA), i = 0;
+            __m128 alpha = _mm_set1_ps(a);
+            for (; i < sizeHA; i += HA)
+            {
+                __m128i s = _mm_loadu_si128((__m128i*)(src + i));
+                Update<update, false>(dst + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(s, K_ZERO)), alpha));
+                Update<update, false>(dst + i + F, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(s, K_ZERO)), alpha));
+            }
+            for (; i < size; ++i)
+                Base::Update<update>(dst + i, src[i] * a);
+        }
+
+        void ResizerShortArea::RowSum(const uint16_t * src, size_t stride, size_t count, size_t size, float curr, float zero, float next, float * dst)
+        {
+            ResizerShortAreaRowUpdate<UpdateSet>(src, size, count ? curr : curr - next, dst);
+            for (size_t i = 1; i <= count; ++i)
+                src += stride, ResizerShortAreaRowUpdate<UpdateAdd>(src, size, i < count ? zero : zero - next, dst);
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m128i));
             if (type == SimdResizeChannelByte && method == SimdResizeMethodArea)
                 return new ResizerByteArea(param);
+            else if (type == SimdResizeChannelShort && (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp))
+                return new ResizerShortBilinear(param);
+            else if (type == SimdResizeChannelShort && method == SimdResizeMethodArea)
+                return new ResizerShortArea(param);
             else
                 return Ssse3::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
@@ -0,0 +1,59 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetImageToTensor.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse2.h"
+#include "Simd/SimdSsse3.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSSE3_ENABLE
+    namespace Ssse3
+    {
+        SynetImageToTensor::SynetImageToTensor(const ImgToTenParam & param)
+            : Sse2::SynetImageToTensor(param)
+        {
+            ConvertPtr bgraToBgr = Base::BgraToBgr;
+            if (param.srcW >= A)
+                bgraToBgr = Ssse3::BgraToBgr;
+            SetConverters(bgraToBgr,
+                param.srcW >= A ? Ssse3::GrayToBgr : Base::GrayToBgr,
+                param.srcW >= Sse2::A ? Sse2::BgrToGray : Base::BgrToGray,
+                param.srcW >= Sse2::A ? Sse2::BgraToGray : Base::BgraToGray,
+                param.srcW / 2 >= Sse2::A ? Sse2::DeinterleaveUv : Base::DeinterleaveUv,
+                param.srcW >= DA ? Ssse3::Yuv420pToBgr : Base::Yuv420pToBgr);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat)
+        {
+            ImgToTenParam param(srcWidth, srcHeight, srcFormat, dstWidth, dstHeight, dstChannels, mean, scale, dstFormat);
+            if (!param.Valid())
+                return NULL;
+            return new SynetImageToTensor(param);
+        }
+    }
+#endif//SIMD_SSSE3_ENABLE
+}
@@ -89,6 +89,27 @@ namespace Simd
             return IsKernel(1) && IsDilation(1) && IsStride(1) && IsPad(0);
         }
 
+        String Key() const
+        {
+            return ToStr(batch) + "x" + ToStr(srcC) + "x" + ToStr(srcH) + "x" + ToStr(srcW) + "-" + ToStr(dstC) + "x" + ToStr(kernelY) + "x" + ToStr(kernelX) + 
+                "-" + ToStr(dilationY) + "x" + ToStr(dilationX) + "-" + ToStr(strideY) + "x" + ToStr(strideX) + "-" + ToStr(padY) + "x" + ToStr(padX) + 
+                "x" + ToStr(padH) + "x" + ToStr(padW) + "-" + ToStr(group) + "-" + ToStr(activation) + "-" + ToStr(trans);
+        }
+
+        ConvParam32f Rows(size_t dyBeg, size_t dyEnd, size_t & syBeg) const
+        {
+            ConvParam32f rows(*this);
+            size_t dyTop = dyBeg * strideY, dyLast = (dyEnd - 1) * strideY + dilationY * (kernelY - 1) + 1;
+            syBeg = dyTop > padY ? dyTop - padY : 0;
+            size_t syEnd = Simd::Min(dyLast - padY, srcH);
+            rows.batch = 1;
+            rows.srcH = syEnd - syBeg;
+            rows.dstH = dyEnd - dyBeg;
+            rows.padY = dyTop < padY ? padY - dyTop : 0;
+            rows.padH = dyLast - padY > srcH ? dyLast - padY - srcH : 0;
+            return rows;
+        }
+
 #ifdef SIMD_PERFORMANCE_STATISTIC
         String Info() const
         {
@@ -106,6 +127,119 @@ namespace Simd
 #endif
     };
 
+    struct ConvEpilogue32f
+    {
+        bool enable, pool, add;
+        Array32f scale, shift;
+
+        ConvEpilogue32f()
+            : enable(false)
+            , pool(false)
+            , add(false)
+        {
+        }
+
+        void Init(const ConvParam32f & p, const float * scale, const float * shift, SimdBool pool, SimdBool add)
+        {
+            this->pool = pool == SimdTrue;
+            this->add = add == SimdTrue;
+            this->enable = scale || shift || this->pool || this->add;
+            this->scale.Resize(enable ? p.dstC : 0);
+            this->shift.Resize(enable ? p.dstC : 0);
+            for (size_t c = 0; c < this->scale.size; ++c)
+            {
+                this->scale[c] = scale ? scale[c] : 1.0f;
+                this->shift[c] = shift ? shift[c] : 0.0f;
+            }
+        }
+
+        SIMD_INLINE size_t DstH(const ConvParam32f & p) const
+        {
+            return pool ? (p.dstH + 1) / 2 : p.dstH;
+        }
+
+        SIMD_INLINE size_t DstW(const ConvParam32f & p) const
+        {
+            return pool ? (p.dstW + 1) / 2 : p.dstW;
+        }
+    };
+
+    namespace Base
+    {
+        void SynetConvolution32fEpilogue(const ConvParam32f & p, const ConvEpilogue32f & e, const float * src, size_t srcY, size_t srcH, size_t yBeg, size_t yEnd, float * dst);
+    }
+
+    const size_t SYNET_CONVOLUTION_32F_PARALLEL_MIN = 256 * 1024;
+    const size_t SYNET_CONVOLUTION_32F_EPILOGUE_SIZE = 64 * 1024;
+
+    SIMD_INLINE size_t SynetConvolution32fThreadNumber(const ConvParam32f & p)
+    {
+        size_t work = p.batch * p.dstC * p.dstH * p.dstW * p.kernelY * p.kernelX * p.srcC / p.group;
+        return Simd::RestrictRange<size_t>(work / SYNET_CONVOLUTION_32F_PARALLEL_MIN, 1, Base::GetThreadNumber());
+    }
+
+    template<class Task> SIMD_INLINE void SynetConvolution32fParallel(size_t threads, size_t batch, size_t count, size_t minCount, Task task)
+    {
+        size_t parts = batch >= threads ? 1 : Simd::Min((threads + batch - 1) / batch, Simd::Max<size_t>(count / minCount, 1));
+        Simd::Parallel(0, batch * parts, [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                size_t b = i / parts, n = i % parts;
+                task(thread, b, count * n / parts, count * (n + 1) / parts);
+            }
+        }, threads);
+    }
+
+    SIMD_INLINE size_t SynetConvolution32fRowsMin(const ConvParam32f & p)
+    {
+        return Simd::Max<size_t>(p.padY + p.padH, 2);
+    }
+
+    SIMD_INLINE size_t SynetConvolution32fRowsStep(const ConvParam32f & p)
+    {
+        return AlignHi(Simd::Max(SynetConvolution32fRowsMin(p), SYNET_CONVOLUTION_32F_EPILOGUE_SIZE / (p.dstW * p.dstC)), 2);
+    }
+
+    SIMD_INLINE size_t SynetConvolution32fRowsBufferSize(const ConvParam32f & p)
+    {
+        size_t rows = Simd::Min(SynetConvolution32fRowsStep(p) + SynetConvolution32fRowsMin(p), p.dstH);
+        return SynetConvolution32fThreadNumber(p) * rows * p.dstW * p.dstC;
+    }
+
+    template<class Convolution> SIMD_INLINE void SynetConvolution32fForwardRows(const ConvParam32f & p, const ConvEpilogue32f & e, 
+        const float * src, float * buf, float * dst, Convolution convolution)
+    {
+        size_t threads = SynetConvolution32fThreadNumber(p), sizeS = p.srcC * p.srcH * p.srcW, rowS = p.srcW * p.srcC, rowD = p.dstW * p.dstC;
+        size_t minRows = SynetConvolution32fRowsMin(p);
+        if (e.enable)
+        {
+            size_t step = SynetConvolution32fRowsStep(p), sizeB = Simd::Min(step + minRows, p.dstH) * rowD, sizeE = p.dstC * e.DstH(p) * e.DstW(p);
+            SynetConvolution32fParallel(threads, p.batch, (p.dstH + 1) / 2, (minRows + 1) / 2, [&](size_t thread, size_t b, size_t beg, size_t end)
+            {
+                size_t yBeg = beg * 2, yEnd = Simd::Min(end * 2, p.dstH);
+                float * rowsBuf = buf + thread * sizeB;
+                while (yBeg < yEnd)
+                {
+                    size_t syBeg, yNext = yEnd - yBeg < step + minRows ? yEnd : yBeg + step;
+                    ConvParam32f rows = p.Rows(yBeg, yNext, syBeg);
+                    convolution(src + b * sizeS + syBeg * rowS, rows, rowsBuf);
+                    Base::SynetConvolution32fEpilogue(p, e, rowsBuf, yBeg, yNext - yBeg, yBeg, yNext, dst + b * sizeE);
+                    yBeg = yNext;
+                }
+            });
+        }
+        else
+        {
+            SynetConvolution32fParallel(threads, p.batch, p.dstH, minRows, [&](size_t thread, size_t b, size_t yBeg, size_t yEnd)
+            {
+                size_t syBeg;
+                ConvParam32f rows = p.Rows(yBeg, yEnd, syBeg);
+                convolution(src + b * sizeS + syBeg * rowS, rows, dst + (b * p.dstH + yBeg) * rowD);
+            });
+        }
+    }
+
     class SynetConvolution32f : public Deletable
     {
     public:
@@ -151,13 +285,22 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        virtual void SetEpilogue(const float * scale, const float * shift, SimdBool pool, SimdBool add)
+        {
+            _epilogue.Init(_param, scale, shift, pool, add);
+        }
+
+        virtual size_t EpilogueBufferSize() const;
+
+        void ForwardEpilogue(const float * src, float * buf, float * dst);
+
         float * Buffer(float * buffer)
         {
             if (buffer)
                 return buffer;
             else
             {
-                _buffer.Resize(ExternalBufferSize());
+                _buffer.Resize(ExternalBufferSize() + EpilogueBufferSize());
                 return _buffer.data;
             }
         }
@@ -176,7 +319,13 @@ namespace Simd
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
+        virtual bool FusedEpilogue() const
+        {
+            return false;
+        }
+
         ConvParam32f _param;
+        ConvEpilogue32f _epilogue;
         Array32f _buffer;
         float _0, _1;
         const float * _weight, * _bias, * _params;
@@ -191,6 +340,36 @@ namespace Simd
 #endif
     };
 
+    class SynetConvolution32fTuned : public SynetConvolution32f
+    {
+    public:
+        typedef std::vector<SynetConvolution32f*> Candidates;
+
+        static SynetConvolution32f * Create(const ConvParam32f & p, const Candidates & candidates);
+
+        virtual ~SynetConvolution32fTuned();
+        virtual String Ext() const;
+        virtual String Desc() const;
+        virtual size_t ExternalBufferSize() const;
+        virtual size_t InternalBufferSize() const;
+        virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
+        virtual void Forward(const float * src, float * buf, float * dst);
+        virtual void SetEpilogue(const float * scale, const float * shift, SimdBool pool, SimdBool add);
+        virtual size_t EpilogueBufferSize() const;
+
+    protected:
+        virtual bool FusedEpilogue() const;
+
+    private:
+        SynetConvolution32fTuned(const ConvParam32f & p, const Candidates & candidates, const String & key);
+
+        static const size_t TEST_COUNT = 5;
+
+        Candidates _candidates;
+        SynetConvolution32f * _best;
+        String _key;
+    };
+
     namespace Base
     {
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
@@ -223,6 +402,7 @@ namespace Simd
             virtual void Forward(const float * src, float * buf, float * dst);
 
             static bool Preferable(const ConvParam32f & p);
+            static bool Applicable(const ConvParam32f & p);
 
         protected:
             virtual void GemmAndBias(const float * src, float * dst);
@@ -245,6 +425,7 @@ namespace Simd
             virtual void Forward(const float * src, float * buf, float * dst);
 
             static bool Preferable(const ConvParam32f & p);
+            static bool Applicable(const ConvParam32f & p);
 
         protected:
             typedef void(*SetFilter)(const float * src, size_t size, float * dst, SimdBool trans);
@@ -306,7 +487,7 @@ namespace Simd
             void Pad(const float * src, float * dst) const;
             virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
 
-            size_t _grW, _grS, _grD, _srcC, _srcH, _srcW, _dstC;
+            size_t _grW, _grS, _grD, _srcC, _srcH, _srcW, _dstC, _threadNumber;
             int _pad;
             ConvolutionBiasActivationPtr _convolutionBiasActivation;
         };
@@ -320,10 +501,12 @@ namespace Simd
             virtual void Forward(const float * src, float * buf, float * dst);
 
             static bool Preferable(const ConvParam32f & p);
+            static bool Applicable(const ConvParam32f & p);
 
             typedef void(*ConvolutionBiasActivationPtr)(const float * src, const ConvParam32f & p, const float * weight, const float * bias, const float * params, float * dst);
         protected:
             virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(); 
+            virtual bool FusedEpilogue() const { return true; }
 
             size_t _batch, _sizeS, _sizeD;
             ConvolutionBiasActivationPtr _convolutionBiasActivation;
@@ -363,6 +546,7 @@ namespace Simd
 
         protected:
             void SetAlgParam(size_t microD, size_t L1, size_t L2, size_t L3);
+            virtual bool FusedEpilogue() const { return true; }
             void ReorderWeight(const float * src, float * dst);
 
             size_t _sizeS, _sizeD;
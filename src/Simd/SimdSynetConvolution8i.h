@@ -0,0 +1,283 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetConvolution8i_h__
+#define __SimdSynetConvolution8i_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdPerformance.h"
+
+namespace Simd
+{
+    const size_t SYNET_CONVOLUTION_8I_WEIGHT_MAX = 64; // 7-bit weights: a pair of u8*i8 products never saturates vpmaddubsw.
+    const size_t SYNET_CONVOLUTION_8I_N_ALIGN = 16; // Output channels of packed weights are padded to the widest SIMD kernel.
+
+    struct ConvParam8i : public SimdConvolutionParameters
+    {
+        size_t batch;
+
+        ConvParam8i(size_t batch, const SimdConvolutionParameters * conv)
+        {
+            *((SimdConvolutionParameters*)this) = *conv;
+            this->batch = batch;
+        }
+
+        bool Valid()
+        {
+            return
+                dstH == (srcH + padY + padH - (dilationY * (kernelY - 1) + 1)) / strideY + 1 && dstH > 0 &&
+                dstW == (srcW + padX + padW - (dilationX * (kernelX - 1) + 1)) / strideX + 1 && dstW > 0 &&
+                (srcT == SimdTensorData32f || srcT == SimdTensorData8u) && (dstT == SimdTensorData32f || dstT == SimdTensorData8u) &&
+                srcF == SimdTensorFormatNhwc && dstF == SimdTensorFormatNhwc && srcC % group == 0 && dstC % group == 0;
+        }
+
+        SIMD_INLINE bool IsKernel(size_t value) const
+        {
+            return kernelY == value && kernelX == value;
+        }
+
+        SIMD_INLINE bool IsDilation(size_t value) const
+        {
+            return dilationY == value && dilationX == value;
+        }
+
+        SIMD_INLINE bool IsStride(size_t value) const
+        {
+            return strideY == value && strideX == value;
+        }
+
+        SIMD_INLINE bool IsPad(size_t value) const
+        {
+            return padY == value && padX == value && padH == value && padW == value;
+        }
+
+        SIMD_INLINE bool Is1x1() const
+        {
+            return IsKernel(1) && IsDilation(1) && IsStride(1) && IsPad(0);
+        }
+
+        SIMD_INLINE bool IsDepthwise() const
+        {
+            return srcC == group && dstC == group;
+        }
+
+#ifdef SIMD_PERFORMANCE_STATISTIC
+        String Info() const
+        {
+            std::stringstream ss;
+            ss << batch << "x" << srcC << "x" << srcH << "x" << srcW;
+            ss << "-" << dstC << "x" << kernelY << "x" << kernelX;
+            ss << "-" << strideX << "-" << Simd::Max(padX, padW) << "-" << group;
+            ss << "-" << (srcT == SimdTensorData8u ? "u8" : "f32") << (dstT == SimdTensorData8u ? "u8" : "f32");
+            return ss.str();
+        }
+
+        long long Flop() const
+        {
+            return batch * kernelY * kernelX * srcC * dstH * dstW * dstC / group * 2;
+        }
+#endif
+    };
+
+    class SynetConvolution8i : public Deletable
+    {
+    public:
+        SynetConvolution8i(const ConvParam8i & p);
+
+        const ConvParam8i & Param() const
+        {
+            return _param;
+        }
+
+        virtual String Ext() const = 0;
+        virtual String Desc() const = 0;
+
+        virtual size_t ExternalBufferSize() const
+        {
+            return 1;
+        }
+
+        virtual size_t InternalBufferSize() const
+        {
+            return _buffer.size + (_srcScale.size + _srcShift.size + _dstScale.size + _dstShift.size + _params.size) * sizeof(float) + _srcZero.size;
+        }
+
+        virtual void SetParams(const float * weight, const float * bias, const float * params, const float * const * stats);
+
+        virtual void Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst) = 0;
+
+        uint8_t * Buffer(uint8_t * buffer)
+        {
+            if (buffer)
+                return buffer;
+            else
+            {
+                _buffer.Resize(ExternalBufferSize());
+                return _buffer.data;
+            }
+        }
+
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+        Base::PerformanceMeasurer * Perf(const String & func)
+        {
+            if (_perf == NULL)
+                _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+            return _perf;
+        }
+#endif
+
+    protected:
+        void QuantizeSrc(const float * src, uint8_t * dst) const;
+
+        ConvParam8i _param;
+        Array8u _buffer, _srcZero;
+        Array32f _srcScale, _srcShift, _dstScale, _dstShift, _params;
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+        Base::PerformanceMeasurer * _perf;
+#endif
+    };
+
+    namespace Base
+    {
+        class SynetConvolution8iGemmNN : public SynetConvolution8i
+        {
+        public:
+            SynetConvolution8iGemmNN(const ConvParam8i & p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const { return Ext() + "::GemmNN"; }
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float * weight, const float * bias, const float * params, const float * const * stats);
+            virtual void Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst);
+
+            typedef void(*GemmPtr)(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc);
+            typedef void(*ConvertPtr)(const int32_t * src, size_t M, size_t N, size_t ldS, const float * norm, const float * bias, const float * params,
+                const float * scale, const float * shift, uint8_t * dst, size_t ldD);
+
+        protected:
+            void ImgToRow(const uint8_t * src, size_t m, size_t count, size_t g, uint8_t * dst) const;
+
+            bool _is1x1;
+            size_t _M, _N, _K, _kA, _ldB, _blockM, _sizeS, _sizeD;
+            Array8i _weight;
+            Array32f _norm, _bias;
+            GemmPtr _gemm;
+            ConvertPtr _convert;
+        };
+
+        class SynetConvolution8iDepthwise : public SynetConvolution8i
+        {
+        public:
+            SynetConvolution8iDepthwise(const ConvParam8i & p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const { return Ext() + "::Depthwise"; }
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float * weight, const float * bias, const float * params, const float * const * stats);
+            virtual void Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst);
+
+        protected:
+            void Forward(const uint8_t * src, size_t dy, int32_t * dst) const;
+
+            size_t _sizeS, _sizeD;
+            Array8i _weight;
+            Array32f _norm, _bias;
+            SynetConvolution8iGemmNN::ConvertPtr _convert;
+        };
+
+        void Gemm8iNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc);
+
+        void * SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv);
+    }
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class SynetConvolution8iGemmNN : public Base::SynetConvolution8iGemmNN
+        {
+        public:
+            SynetConvolution8iGemmNN(const ConvParam8i & p);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        class SynetConvolution8iDepthwise : public Base::SynetConvolution8iDepthwise
+        {
+        public:
+            SynetConvolution8iDepthwise(const ConvParam8i & p);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        void Gemm8iNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc);
+
+        void * SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class SynetConvolution8iGemmNN : public Avx2::SynetConvolution8iGemmNN
+        {
+        public:
+            SynetConvolution8iGemmNN(const ConvParam8i & p);
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
+        class SynetConvolution8iDepthwise : public Avx2::SynetConvolution8iDepthwise
+        {
+        public:
+            SynetConvolution8iDepthwise(const ConvParam8i & p);
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
+        void Gemm8iNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc);
+
+        void * SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv);
+    }
+#endif//SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        class SynetConvolution8iGemmNN : public Base::SynetConvolution8iGemmNN
+        {
+        public:
+            SynetConvolution8iGemmNN(const ConvParam8i & p);
+            virtual String Ext() const { return "Neon"; }
+        };
+
+        class SynetConvolution8iDepthwise : public Base::SynetConvolution8iDepthwise
+        {
+        public:
+            SynetConvolution8iDepthwise(const ConvParam8i & p);
+            virtual String Ext() const { return "Neon"; }
+        };
+
+        void Gemm8iNN(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, const int8_t * B, size_t ldb, int32_t * C, size_t ldc);
+
+        void * SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv);
+    }
+#endif//SIMD_NEON_ENABLE
+}
+
+#endif//__SimdSynetConvolution8i_h__
@@ -0,0 +1,291 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetImageToTensor_h__
+#define __SimdSynetImageToTensor_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct ImgToTenParam
+    {
+        SimdFrameFormatType srcF;
+        SimdTensorFormatType dstF;
+        size_t srcW, srcH, dstW, dstH, channels;
+        float mean[3], scale[3];
+
+        ImgToTenParam(size_t srcW, size_t srcH, SimdFrameFormatType srcF, size_t dstW, size_t dstH, size_t channels, const float * mean, const float * scale, SimdTensorFormatType dstF)
+        {
+            this->srcF = srcF;
+            this->dstF = dstF;
+            this->srcW = srcW;
+            this->srcH = srcH;
+            this->dstW = dstW;
+            this->dstH = dstH;
+            this->channels = channels;
+            for (size_t c = 0; c < 3; ++c)
+            {
+                this->mean[c] = mean && c < channels ? mean[c] : 0.0f;
+                this->scale[c] = scale && c < channels ? scale[c] : 1.0f;
+            }
+        }
+
+        SIMD_INLINE bool IsYuv() const
+        {
+            return srcF == SimdFrameFormatNv12 || srcF == SimdFrameFormatYuv420p;
+        }
+
+        bool Valid() const
+        {
+            return srcW && srcH && dstW && dstH && (channels == 1 || channels == 3) && srcF > SimdFrameFormatNone && srcF <= SimdFrameFormatGray8 &&
+                (dstF == SimdTensorFormatNchw || dstF == SimdTensorFormatNhwc) && (!IsYuv() || (srcW % 2 == 0 && srcH % 2 == 0));
+        }
+    };
+
+    class SynetImageToTensor : Deletable
+    {
+    public:
+        SynetImageToTensor(const ImgToTenParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * const * src, const size_t * srcStride, float * dst) = 0;
+
+    protected:
+        ImgToTenParam _param;
+    };
+
+    struct CropResParam
+    {
+        SimdTensorFormatType dstF;
+        SimdTensorDataType dstT;
+        size_t channels, dstW, dstH;
+        bool keepAspect;
+        float mean[4], scale[4];
+
+        CropResParam(size_t channels, size_t dstW, size_t dstH, SimdTensorFormatType dstF, SimdTensorDataType dstT, SimdBool keepAspect, const float * mean, const float * scale)
+        {
+            this->dstF = dstF;
+            this->dstT = dstT;
+            this->channels = channels;
+            this->dstW = dstW;
+            this->dstH = dstH;
+            this->keepAspect = keepAspect == SimdTrue;
+            for (size_t c = 0; c < 4; ++c)
+            {
+                this->mean[c] = mean && c < channels ? mean[c] : 0.0f;
+                this->scale[c] = scale && c < channels ? scale[c] : 1.0f;
+            }
+        }
+
+        bool Valid() const
+        {
+            return channels >= 1 && channels <= 4 && dstW && dstH && (dstF == SimdTensorFormatNchw || dstF == SimdTensorFormatNhwc) &&
+                (dstT == SimdTensorData32f || dstT == SimdTensorData8u);
+        }
+    };
+
+    class SynetCropResize : Deletable
+    {
+    public:
+        SynetCropResize(const CropResParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const ptrdiff_t * rois, size_t count, uint8_t * dst) = 0;
+
+    protected:
+        CropResParam _param;
+    };
+
+    namespace Base
+    {
+        class SynetImageToTensor : public Simd::SynetImageToTensor
+        {
+        public:
+            SynetImageToTensor(const ImgToTenParam & param);
+
+            virtual void Run(const uint8_t * const * src, const size_t * srcStride, float * dst);
+
+        protected:
+            typedef void(*ConvertPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
+            typedef void(*DeinterleaveUvPtr)(const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+            typedef void(*Yuv420pToBgrPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+            void SetConverters(ConvertPtr bgraToBgr, ConvertPtr grayToBgr, ConvertPtr bgrToGray, ConvertPtr bgraToGray, DeinterleaveUvPtr deinterleaveUv, Yuv420pToBgrPtr yuv420pToBgr);
+            const uint8_t * SrcRow(const uint8_t * const * src, const size_t * srcStride, size_t y);
+            const float * RowX(const uint8_t * const * src, const size_t * srcStride, size_t y);
+
+            virtual void RunX(const uint8_t * src, float * dst);
+            virtual void RowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+
+            ConvertPtr _convert;
+            DeinterleaveUvPtr _deinterleaveUv;
+            Yuv420pToBgrPtr _yuv420pToBgr;
+            size_t _size, _dx, _dy, _rowSize;
+            ptrdiff_t _pair, _rows[2];
+            Array32i _ix, _iy;
+            Array32f _ax, _ay, _scale, _shift, _bx[2];
+            Array8u _bgr, _u, _v;
+        };
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat);
+
+        typedef void(*SynetImageToTensorRowXPtr)(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst);
+
+        void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst);
+
+        typedef void(*SynetImageToTensorRowYPtr)(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+
+        void SynetImageToTensorRowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+
+        class SynetCropResize : public Simd::SynetCropResize
+        {
+        public:
+            SynetCropResize(const CropResParam & param, SynetImageToTensorRowXPtr rowX, SynetImageToTensorRowYPtr rowY);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const ptrdiff_t * rois, size_t count, uint8_t * dst);
+
+        protected:
+            void RunRoi(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const ptrdiff_t * roi, size_t thread, uint8_t * dst);
+
+            SynetImageToTensorRowXPtr _rowX;
+            SynetImageToTensorRowYPtr _rowY;
+            size_t _rowSize, _dstSize, _bufSize, _threads;
+            Array32i _index;
+            Array32f _scale, _shift, _alpha, _rows;
+        };
+
+        void * SynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale);
+    }
+
+#ifdef SIMD_SSE2_ENABLE
+    namespace Sse2
+    {
+        class SynetImageToTensor : public Base::SynetImageToTensor
+        {
+        public:
+            SynetImageToTensor(const ImgToTenParam & param);
+
+        protected:
+            virtual void RunX(const uint8_t * src, float * dst);
+            virtual void RowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+        };
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat);
+
+        void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst);
+
+        void SynetImageToTensorRowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+
+        void * SynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale);
+    }
+#endif//SIMD_SSE2_ENABLE
+
+#ifdef SIMD_SSSE3_ENABLE
+    namespace Ssse3
+    {
+        class SynetImageToTensor : public Sse2::SynetImageToTensor
+        {
+        public:
+            SynetImageToTensor(const ImgToTenParam & param);
+        };
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat);
+    }
+#endif//SIMD_SSSE3_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class SynetImageToTensor : public Sse2::SynetImageToTensor
+        {
+        public:
+            SynetImageToTensor(const ImgToTenParam & param);
+
+        protected:
+            virtual void RunX(const uint8_t * src, float * dst);
+            virtual void RowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+        };
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat);
+
+        void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst);
+
+        void SynetImageToTensorRowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+
+        void * SynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class SynetImageToTensor : public Avx2::SynetImageToTensor
+        {
+        public:
+            SynetImageToTensor(const ImgToTenParam & param);
+
+        protected:
+            virtual void RunX(const uint8_t * src, float * dst);
+            virtual void RowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+        };
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat);
+
+        void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst);
+
+        void SynetImageToTensorRowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+
+        void * SynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale);
+    }
+#endif//SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        class SynetImageToTensor : public Base::SynetImageToTensor
+        {
+        public:
+            SynetImageToTensor(const ImgToTenParam & param);
+
+        protected:
+            virtual void RunX(const uint8_t * src, float * dst);
+            virtual void RowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+        };
+
+        void * SynetImageToTensorInit(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat);
+
+        void SynetImageToTensorRowX(const uint8_t * src, size_t srcSize, const int32_t * ix, const float * ax, size_t dx, size_t size, float * dst);
+
+        void SynetImageToTensorRowY(const float * src0, const float * src1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+
+        void * SynetCropResizeInit(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale);
+    }
+#endif//SIMD_NEON_ENABLE
+}
+
+#endif//__SimdSynetImageToTensor_h__
@@ -36,6 +36,11 @@
 
 namespace Simd
 {
+    /*
+    * Merged convolution consists of input convolution (conv[0]), depthwise convolution (conv[1]) and output 1x1 convolution (conv[2]).
+    * Two merged convolutions (depthwise and output 1x1) are stored in conv[1] and conv[2]. 
+    * In this case conv[0] describes an identity 1x1 layer which only copies input into intermediate buffer.
+    */
     struct MergConvParam32f
     {
         SimdBool trans, add;
@@ -50,16 +55,30 @@ namespace Simd
             this->batch = batch;
             this->count = count;
             for (size_t i = 0; i < count; ++i)
-                this->conv[i] = convs[i];
+                this->conv[3 - count + i] = convs[i];
+            if (count == 2)
+            {
+                SimdConvolutionParameters & c = conv[0];
+                c = convs[0];
+                c.dstC = c.srcC;
+                c.dstH = c.srcH;
+                c.dstW = c.srcW;
+                c.kernelY = 1, c.kernelX = 1;
+                c.dilationY = 1, c.dilationX = 1;
+                c.strideY = 1, c.strideX = 1;
+                c.padY = 0, c.padX = 0, c.padH = 0, c.padW = 0;
+                c.group = 1;
+                c.activation = SimdConvolutionActivationIdentity;
+            }
         }
 
         bool Valid()
         {
             if (trans != SimdTrue)
                 return false;
-            if (count != 3)
+            if (count != 2 && count != 3)
                 return false;
-            for (size_t i = 0; i < count; ++i)
+            for (size_t i = 3 - count; i < 3; ++i)
             {
                 SimdConvolutionParameters & c = conv[i];                
                 if (c.srcT != SimdTensorData32f || c.dstT != SimdTensorData32f)
@@ -70,11 +89,11 @@ namespace Simd
                     return false;
                 if (c.dstW != (c.srcW + c.padX + c.padW - (c.dilationY * (c.kernelX - 1) + 1)) / c.strideX + 1 || c.dstW == 0)
                     return false;
-                if (c.kernelY != c.kernelX || !(c.kernelY == 1 || c.kernelY == 3))
+                if (c.kernelY != c.kernelX || !(c.kernelY == 1 || c.kernelY == 3 || (i == 1 && c.kernelY == 5)))
                     return false;
                 if (c.strideY != c.strideX || !(c.strideY == 1 || c.strideY == 2))
                     return false;
-                if (c.dilationY != 1 || c.dilationX != 1)
+                if (c.dilationY != c.dilationX || c.dilationY == 0 || (i != 1 && c.dilationY != 1))
                     return false;
 
                 if (c.dstH == (c.srcH + c.padY + c.padH - (c.dilationY * (c.kernelY - 1) + 1) - 1) / c.strideY + 1)
@@ -84,7 +103,7 @@ namespace Simd
             }
             if (conv[0].group != 1)
                 return false;
-            if (conv[1].group != conv[1].srcC || conv[1].group != conv[1].dstC || conv[1].kernelY != 3)
+            if (conv[1].group != conv[1].srcC || conv[1].group != conv[1].dstC || conv[1].kernelY == 1)
                 return false;
             if (conv[2].group != 1 || conv[2].kernelY != 1 || conv[2].strideY != 1)
                 return false;
@@ -98,13 +117,28 @@ namespace Simd
             return conv[index].padY == value && conv[index].padX == value && conv[index].padH == value && conv[index].padW == value;
         }
 
+        SIMD_INLINE bool IsDepthwise3x3() const
+        {
+            const SimdConvolutionParameters & c = conv[1];
+            return c.kernelY == 3 && c.dilationY == 1 && c.padY <= 1 && c.padX <= 1 && c.padH <= 1 && c.padW <= 1;
+        }
+
+        SIMD_INLINE size_t KernelY(size_t index) const
+        {
+            return conv[index].dilationY * (conv[index].kernelY - 1) + 1;
+        }
+
 #ifdef SIMD_PERFORMANCE_STATISTIC
         String Info() const
         {
             std::stringstream ss;
             ss << batch << "x" << conv[0].srcC << "x" << conv[0].srcH << "x" << conv[0].srcW;
-            ss << "-" << conv[0].dstC << "x" << conv[0].kernelY << "x" << conv[0].strideY;
-            ss << "-" << conv[1].kernelY << "x" << conv[1].strideY << "-" << conv[2].dstC;
+            if (count == 3)
+                ss << "-" << conv[0].dstC << "x" << conv[0].kernelY << "x" << conv[0].strideY;
+            ss << "-" << conv[1].kernelY << "x" << conv[1].strideY;
+            if (conv[1].dilationY > 1)
+                ss << "x" << conv[1].dilationY;
+            ss << "-" << conv[2].dstC;
             return ss.str();
         }
 
@@ -115,7 +149,7 @@ namespace Simd
 
         long long Flop() const
         {
-            return Flop(0) + Flop(1) + Flop(2);
+            return (count == 3 ? Flop(0) : 0) + Flop(1) + Flop(2);
         }
 #endif
     };
@@ -177,18 +211,41 @@ namespace Simd
         protected:
             void SetSize(size_t L1, size_t L2, size_t L3, size_t F);
             float * GetBuffer(float * buffer);
+            void Forward(const float * src, float * buf0, float * buf1, size_t yBeg, size_t yEnd, float * dst);
             virtual void ReorderInputWeight(const float * src, float * dst) const;
             virtual void ReorderDepthwiseWeight(const float * src, float * dst) const;
             virtual void ReorderOutputWeight(const float * src, float * dst) const;
 
             MergConvParam32f _param;
             bool _base;
-            size_t _sizeS, _sizeD, _miC, _maC, _yStep[2], _bufH[2], _sizeB[2], _dp[2], _dw[3];
+            size_t _sizeS, _sizeD, _miC, _maC, _yStep[2], _bufH[2], _sizeB[2], _dp[2], _dw[3], _threadNumber;
             ConvolutionPtr _convolution[6];
             Array32f _buffer, _rWeight[3], _rBias[3], _rParams[3];
             const float * _weight[3], * _bias[3], * _params[3];
         };
 
+        template<size_t F> void InputCopy(const float * src, const SimdConvolutionParameters & p, size_t maC, size_t yBeg, size_t yEnd,
+            const size_t bufH[2], const float * weight, const float * bias, const float * params, float * dst)
+        {
+            size_t srcC = p.srcC, srcW = p.srcW, dstM = bufH[0] - 1, dstS = bufH[0] * srcW * F;
+            for (size_t c = 0; c < maC; c += F)
+            {
+                size_t size = Simd::Min(F, maC - c);
+                for (size_t y = yBeg; y < yEnd; ++y)
+                {
+                    const float * ps = src + y * srcW * srcC + c;
+                    float * pd = dst + (y & dstM) * srcW * F;
+                    for (size_t x = 0; x < srcW; ++x, ps += srcC, pd += F)
+                    {
+                        memcpy(pd, ps, size * sizeof(float));
+                        if (size < F)
+                            memset(pd + size, 0, (F - size) * sizeof(float));
+                    }
+                }
+                dst += dstS;
+            }
+        }
+
         void * SynetMergedConvolution32fInit(size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add);
     }
 
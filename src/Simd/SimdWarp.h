@@ -0,0 +1,279 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdWarp_h__
+#define __SimdWarp_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    const int32_t WARP_SHIFT = 10;
+    const int32_t WARP_RANGE = 1 << WARP_SHIFT;
+    const int32_t WARP_MASK = WARP_RANGE - 1;
+    const int32_t WARP_ROUND = 1 << (2 * WARP_SHIFT - 1);
+    const double WARP_LIMIT = double(1 << 29);
+
+    struct WarpParam
+    {
+        size_t srcW, srcH, dstW, dstH, channels;
+        SimdResizeChannelType type;
+        SimdWarpBorderType border;
+        bool perspective, valid;
+        double inv[9];
+        uint8_t value[16];
+
+        WarpParam(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, bool perspective, SimdWarpBorderType border, const uint8_t * value)
+        {
+            this->srcW = srcW;
+            this->srcH = srcH;
+            this->dstW = dstW;
+            this->dstH = dstH;
+            this->channels = channels;
+            this->type = type;
+            this->border = border;
+            this->perspective = perspective;
+            memset(this->value, 0, sizeof(this->value));
+            if (value && channels <= 4)
+                memcpy(this->value, value, PixelSize());
+            double m[9] = { mat[0], mat[1], mat[2], mat[3], mat[4], mat[5], 0.0, 0.0, 1.0 };
+            if (perspective)
+                m[6] = mat[6], m[7] = mat[7], m[8] = mat[8];
+            valid = Invert(m, inv);
+        }
+
+        SIMD_INLINE size_t PixelSize() const
+        {
+            return channels * (type == SimdResizeChannelFloat ? 4 : 1);
+        }
+
+        bool Valid() const
+        {
+            return valid && srcW && srcH && dstW && dstH && channels >= 1 && channels <= 4 && 
+                (type == SimdResizeChannelByte || type == SimdResizeChannelFloat) &&
+                (border == SimdWarpBorderConstant || border == SimdWarpBorderTransparent || border == SimdWarpBorderReplicate);
+        }
+
+    private:
+        static bool Invert(const double * m, double * inv)
+        {
+            double det = m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6]) + m[2] * (m[3] * m[7] - m[4] * m[6]);
+            if (::fabs(det) < 1e-12)
+                return false;
+            double k = 1.0 / det;
+            inv[0] = (m[4] * m[8] - m[5] * m[7]) * k;
+            inv[1] = (m[2] * m[7] - m[1] * m[8]) * k;
+            inv[2] = (m[1] * m[5] - m[2] * m[4]) * k;
+            inv[3] = (m[5] * m[6] - m[3] * m[8]) * k;
+            inv[4] = (m[0] * m[8] - m[2] * m[6]) * k;
+            inv[5] = (m[2] * m[3] - m[0] * m[5]) * k;
+            inv[6] = (m[3] * m[7] - m[4] * m[6]) * k;
+            inv[7] = (m[1] * m[6] - m[0] * m[7]) * k;
+            inv[8] = (m[0] * m[4] - m[1] * m[3]) * k;
+            return true;
+        }
+    };
+
+    class Warp : Deletable
+    {
+    public:
+        Warp(const WarpParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+
+    protected:
+        WarpParam _param;
+    };
+
+    namespace Base
+    {
+        SIMD_INLINE int32_t WarpRound(double value)
+        {
+            return Round(Simd::RestrictRange(value * WARP_RANGE, -WARP_LIMIT, WARP_LIMIT));
+        }
+
+        template<size_t N> SIMD_INLINE void WarpInterpolate(const uint8_t * const * ps, int32_t fx, int32_t fy, uint8_t * dst)
+        {
+            for (size_t c = 0; c < N; ++c)
+            {
+                int32_t t0 = ps[0][c] * (WARP_RANGE - fx) + ps[1][c] * fx;
+                int32_t t1 = ps[2][c] * (WARP_RANGE - fx) + ps[3][c] * fx;
+                dst[c] = uint8_t((t0 * (WARP_RANGE - fy) + t1 * fy + WARP_ROUND) >> (2 * WARP_SHIFT));
+            }
+        }
+
+        template<size_t N> SIMD_INLINE void WarpInterpolate(const float * const * ps, int32_t fx, int32_t fy, float * dst)
+        {
+            float kx1 = fx * (1.0f / WARP_RANGE), kx0 = 1.0f - kx1;
+            float ky1 = fy * (1.0f / WARP_RANGE), ky0 = 1.0f - ky1;
+            for (size_t c = 0; c < N; ++c)
+                dst[c] = (ps[0][c] * kx0 + ps[1][c] * kx1) * ky0 + (ps[2][c] * kx0 + ps[3][c] * kx1) * ky1;
+        }
+
+        template<class T, size_t N> SIMD_INLINE void WarpPixel(const WarpParam & p, const uint8_t * src, size_t srcStride, int32_t sx, int32_t sy, T * dst)
+        {
+            int32_t x0 = sx >> WARP_SHIFT, y0 = sy >> WARP_SHIFT, w = (int32_t)p.srcW, h = (int32_t)p.srcH;
+            const T * ps[4];
+            if (x0 >= 0 && y0 >= 0 && x0 < w - 1 && y0 < h - 1)
+            {
+                ps[0] = (const T*)(src + y0 * srcStride) + x0 * N;
+                ps[1] = ps[0] + N;
+                ps[2] = (const T*)(src + (y0 + 1) * srcStride) + x0 * N;
+                ps[3] = ps[2] + N;
+            }
+            else
+            {
+                if (p.border == SimdWarpBorderTransparent)
+                    return;
+                if (p.border == SimdWarpBorderConstant && (x0 < -1 || y0 < -1 || x0 >= w || y0 >= h))
+                {
+                    memcpy(dst, p.value, N * sizeof(T));
+                    return;
+                }
+                for (int32_t k = 0; k < 4; ++k)
+                {
+                    int32_t x = x0 + (k & 1), y = y0 + (k >> 1);
+                    if (p.border == SimdWarpBorderReplicate)
+                        ps[k] = (const T*)(src + Simd::RestrictRange(y, 0, h - 1) * srcStride) + Simd::RestrictRange(x, 0, w - 1) * N;
+                    else
+                        ps[k] = x >= 0 && y >= 0 && x < w && y < h ? (const T*)(src + y * srcStride) + x * N : (const T*)p.value;
+                }
+            }
+            WarpInterpolate<N>(ps, sx & WARP_MASK, sy & WARP_MASK, dst);
+        }
+
+        template<class T, size_t N> void WarpRow(const WarpParam & p, const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, size_t beg, size_t end, uint8_t * dst)
+        {
+            for (size_t x = beg; x < end; ++x)
+                WarpPixel<T, N>(p, src, srcStride, sx[x], sy[x], (T*)dst + x * N);
+        }
+
+        void WarpRow(const WarpParam & p, const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, size_t beg, size_t end, uint8_t * dst);
+
+        class WarpBilinear : public Warp
+        {
+        protected:
+            Array32i _ax, _ay;
+
+            void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride, size_t yBeg, size_t yEnd);
+
+            virtual void EstimateCoords(size_t y, int32_t * sx, int32_t * sy);
+
+            virtual void RunRow(const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst);
+
+        public:
+            WarpBilinear(const WarpParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class WarpBilinear : public Base::WarpBilinear
+        {
+        protected:
+            virtual void EstimateCoords(size_t y, int32_t * sx, int32_t * sy);
+
+            virtual void RunRow(const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst);
+
+        public:
+            WarpBilinear(const WarpParam & param);
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+    }
+#endif//SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class WarpBilinear : public Base::WarpBilinear
+        {
+        protected:
+            virtual void EstimateCoords(size_t y, int32_t * sx, int32_t * sy);
+
+            virtual void RunRow(const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst);
+
+        public:
+            WarpBilinear(const WarpParam & param);
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class WarpBilinear : public Base::WarpBilinear
+        {
+        protected:
+            virtual void EstimateCoords(size_t y, int32_t * sx, int32_t * sy);
+
+            virtual void RunRow(const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst);
+
+        public:
+            WarpBilinear(const WarpParam & param);
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+    }
+#endif//SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class WarpBilinear : public Base::WarpBilinear
+        {
+        protected:
+            virtual void EstimateCoords(size_t y, int32_t * sx, int32_t * sy);
+
+            virtual void RunRow(const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst);
+
+        public:
+            WarpBilinear(const WarpParam & param);
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+    }
+#endif//SIMD_NEON_ENABLE
+}
+#endif//__SimdWarp_h__
@@ -0,0 +1,658 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdYuvToBgr_h__
+#define __SimdYuvToBgr_h__
+
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdSet.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct Bt601
+        {
+            static const int Y_LO = 16;
+            static const int UV_Z = 128;
+            static const int F = 13;
+            static const int ROUND = 1 << (F - 1);
+            static const int Y_2_A = int(1.164 * (1 << F) + 0.5);
+            static const int U_2_B = int(2.018 * (1 << F) + 0.5);
+            static const int U_2_G = -int(0.391 * (1 << F) + 0.5);
+            static const int V_2_G = -int(0.813 * (1 << F) + 0.5);
+            static const int V_2_R = int(1.596 * (1 << F) + 0.5);
+
+            static const int BGR_F = 14;
+            static const int BGR_ROUND = 1 << (BGR_F - 1);
+            static const int B_2_Y = int(0.098 * (1 << BGR_F) + 0.5);
+            static const int G_2_Y = int(0.504 * (1 << BGR_F) + 0.5);
+            static const int R_2_Y = int(0.257 * (1 << BGR_F) + 0.5);
+            static const int B_2_U = int(0.439 * (1 << BGR_F) + 0.5);
+            static const int G_2_U = -int(0.291 * (1 << BGR_F) + 0.5);
+            static const int R_2_U = -int(0.148 * (1 << BGR_F) + 0.5);
+            static const int B_2_V = -int(0.071 * (1 << BGR_F) + 0.5);
+            static const int G_2_V = -int(0.368 * (1 << BGR_F) + 0.5);
+            static const int R_2_V = int(0.439 * (1 << BGR_F) + 0.5);
+        };
+
+        struct Bt709
+        {
+            static const int Y_LO = 16;
+            static const int UV_Z = 128;
+            static const int F = 13;
+            static const int ROUND = 1 << (F - 1);
+            static const int Y_2_A = int(1.164 * (1 << F) + 0.5);
+            static const int U_2_B = int(2.112 * (1 << F) + 0.5);
+            static const int U_2_G = -int(0.213 * (1 << F) + 0.5);
+            static const int V_2_G = -int(0.533 * (1 << F) + 0.5);
+            static const int V_2_R = int(1.793 * (1 << F) + 0.5);
+
+            static const int BGR_F = 14;
+            static const int BGR_ROUND = 1 << (BGR_F - 1);
+            static const int B_2_Y = int(0.0620 * (1 << BGR_F) + 0.5);
+            static const int G_2_Y = int(0.6142 * (1 << BGR_F) + 0.5);
+            static const int R_2_Y = int(0.1826 * (1 << BGR_F) + 0.5);
+            static const int B_2_U = int(0.4392 * (1 << BGR_F) + 0.5);
+            static const int G_2_U = -int(0.3386 * (1 << BGR_F) + 0.5);
+            static const int R_2_U = -int(0.1006 * (1 << BGR_F) + 0.5);
+            static const int B_2_V = -int(0.0403 * (1 << BGR_F) + 0.5);
+            static const int G_2_V = -int(0.3989 * (1 << BGR_F) + 0.5);
+            static const int R_2_V = int(0.4392 * (1 << BGR_F) + 0.5);
+        };
+
+        struct Bt2020
+        {
+            static const int Y_LO = 16;
+            static const int UV_Z = 128;
+            static const int F = 13;
+            static const int ROUND = 1 << (F - 1);
+            static const int Y_2_A = int(1.164 * (1 << F) + 0.5);
+            static const int U_2_B = int(2.142 * (1 << F) + 0.5);
+            static const int U_2_G = -int(0.187 * (1 << F) + 0.5);
+            static const int V_2_G = -int(0.650 * (1 << F) + 0.5);
+            static const int V_2_R = int(1.679 * (1 << F) + 0.5);
+
+            static const int BGR_F = 14;
+            static const int BGR_ROUND = 1 << (BGR_F - 1);
+            static const int B_2_Y = int(0.0509 * (1 << BGR_F) + 0.5);
+            static const int G_2_Y = int(0.5823 * (1 << BGR_F) + 0.5);
+            static const int R_2_Y = int(0.2256 * (1 << BGR_F) + 0.5);
+            static const int B_2_U = int(0.4392 * (1 << BGR_F) + 0.5);
+            static const int G_2_U = -int(0.3166 * (1 << BGR_F) + 0.5);
+            static const int R_2_U = -int(0.1227 * (1 << BGR_F) + 0.5);
+            static const int B_2_V = -int(0.0353 * (1 << BGR_F) + 0.5);
+            static const int G_2_V = -int(0.4039 * (1 << BGR_F) + 0.5);
+            static const int R_2_V = int(0.4392 * (1 << BGR_F) + 0.5);
+        };
+
+        struct Trect871
+        {
+            static const int Y_LO = 0;
+            static const int UV_Z = 128;
+            static const int F = 13;
+            static const int ROUND = 1 << (F - 1);
+            static const int Y_2_A = int(1.000 * (1 << F) + 0.5);
+            static const int U_2_B = int(1.772 * (1 << F) + 0.5);
+            static const int U_2_G = -int(0.344 * (1 << F) + 0.5);
+            static const int V_2_G = -int(0.714 * (1 << F) + 0.5);
+            static const int V_2_R = int(1.402 * (1 << F) + 0.5);
+
+            static const int BGR_F = 14;
+            static const int BGR_ROUND = 1 << (BGR_F - 1);
+            static const int B_2_Y = int(0.1140 * (1 << BGR_F) + 0.5);
+            static const int G_2_Y = int(0.5870 * (1 << BGR_F) + 0.5);
+            static const int R_2_Y = int(0.2990 * (1 << BGR_F) + 0.5);
+            static const int B_2_U = int(0.5000 * (1 << BGR_F) + 0.5);
+            static const int G_2_U = -int(0.3313 * (1 << BGR_F) + 0.5);
+            static const int R_2_U = -int(0.1687 * (1 << BGR_F) + 0.5);
+            static const int B_2_V = -int(0.0813 * (1 << BGR_F) + 0.5);
+            static const int G_2_V = -int(0.4187 * (1 << BGR_F) + 0.5);
+            static const int R_2_V = int(0.5000 * (1 << BGR_F) + 0.5);
+        };
+
+        template<class T> SIMD_INLINE int YuvToBlue(int y, int u)
+        {
+            return RestrictRange((T::Y_2_A * (y - T::Y_LO) + T::U_2_B * (u - T::UV_Z) + T::ROUND) >> T::F);
+        }
+
+        template<class T> SIMD_INLINE int YuvToGreen(int y, int u, int v)
+        {
+            return RestrictRange((T::Y_2_A * (y - T::Y_LO) + T::U_2_G * (u - T::UV_Z) + T::V_2_G * (v - T::UV_Z) + T::ROUND) >> T::F);
+        }
+
+        template<class T> SIMD_INLINE int YuvToRed(int y, int v)
+        {
+            return RestrictRange((T::Y_2_A * (y - T::Y_LO) + T::V_2_R * (v - T::UV_Z) + T::ROUND) >> T::F);
+        }
+
+        template<class T> SIMD_INLINE void YuvToBgr(int y, int u, int v, uint8_t * bgr)
+        {
+            bgr[0] = YuvToBlue<T>(y, u);
+            bgr[1] = YuvToGreen<T>(y, u, v);
+            bgr[2] = YuvToRed<T>(y, v);
+        }
+
+        template<class T> SIMD_INLINE void YuvToBgra(int y, int u, int v, int alpha, uint8_t * bgra)
+        {
+            bgra[0] = YuvToBlue<T>(y, u);
+            bgra[1] = YuvToGreen<T>(y, u, v);
+            bgra[2] = YuvToRed<T>(y, v);
+            bgra[3] = alpha;
+        }
+
+        template<class T> SIMD_INLINE int BgrToY(int blue, int green, int red)
+        {
+            return RestrictRange(((T::B_2_Y * blue + T::G_2_Y * green + T::R_2_Y * red + T::BGR_ROUND) >> T::BGR_F) + T::Y_LO);
+        }
+
+        template<class T> SIMD_INLINE int BgrToU(int blue, int green, int red)
+        {
+            return RestrictRange(((T::B_2_U * blue + T::G_2_U * green + T::R_2_U * red + T::BGR_ROUND) >> T::BGR_F) + T::UV_Z);
+        }
+
+        template<class T> SIMD_INLINE int BgrToV(int blue, int green, int red)
+        {
+            return RestrictRange(((T::B_2_V * blue + T::G_2_V * green + T::R_2_V * red + T::BGR_ROUND) >> T::BGR_F) + T::UV_Z);
+        }
+    }
+
+#ifdef SIMD_SSE2_ENABLE
+    namespace Sse2
+    {
+        template<class T> SIMD_INLINE __m128i AdjustY16(__m128i y16)
+        {
+            return _mm_subs_epi16(y16, _mm_set1_epi16(T::Y_LO));
+        }
+
+        template<class T> SIMD_INLINE __m128i AdjustUV16(__m128i uv16)
+        {
+            return _mm_subs_epi16(uv16, _mm_set1_epi16(T::UV_Z));
+        }
+
+        template<class T> SIMD_INLINE __m128i AdjustedYuvToRed32(__m128i y16_1, __m128i v16_0)
+        {
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16(T::Y_2_A, T::ROUND)),
+                _mm_madd_epi16(v16_0, SetInt16(T::V_2_R, 0))), T::F);
+        }
+
+        template<class T> SIMD_INLINE __m128i AdjustedYuvToRed16(__m128i y16, __m128i v16)
+        {
+            return SaturateI16ToU8(_mm_packs_epi32(
+                AdjustedYuvToRed32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(v16, K_ZERO))));
+        }
+
+        template<class T> SIMD_INLINE __m128i AdjustedYuvToGreen32(__m128i y16_1, __m128i u16_v16)
+        {
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16(T::Y_2_A, T::ROUND)),
+                _mm_madd_epi16(u16_v16, SetInt16(T::U_2_G, T::V_2_G))), T::F);
+        }
+
+        template<class T> SIMD_INLINE __m128i AdjustedYuvToGreen16(__m128i y16, __m128i u16, __m128i v16)
+        {
+            return SaturateI16ToU8(_mm_packs_epi32(
+                AdjustedYuvToGreen32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, v16))));
+        }
+
+        template<class T> SIMD_INLINE __m128i AdjustedYuvToBlue32(__m128i y16_1, __m128i u16_0)
+        {
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(y16_1, SetInt16(T::Y_2_A, T::ROUND)),
+                _mm_madd_epi16(u16_0, SetInt16(T::U_2_B, 0))), T::F);
+        }
+
+        template<class T> SIMD_INLINE __m128i AdjustedYuvToBlue16(__m128i y16, __m128i u16)
+        {
+            return SaturateI16ToU8(_mm_packs_epi32(
+                AdjustedYuvToBlue32<T>(_mm_unpacklo_epi16(y16, K16_0001), _mm_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm_unpackhi_epi16(y16, K16_0001), _mm_unpackhi_epi16(u16, K_ZERO))));
+        }
+
+        template<class T> SIMD_INLINE __m128i YuvToRed(__m128i y, __m128i v)
+        {
+            __m128i lo = AdjustedYuvToRed16<T>(AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)), AdjustUV16<T>(_mm_unpacklo_epi8(v, K_ZERO)));
+            __m128i hi = AdjustedYuvToRed16<T>(AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)), AdjustUV16<T>(_mm_unpackhi_epi8(v, K_ZERO)));
+            return _mm_packus_epi16(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m128i YuvToGreen(__m128i y, __m128i u, __m128i v)
+        {
+            __m128i lo = AdjustedYuvToGreen16<T>(AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpacklo_epi8(u, K_ZERO)), AdjustUV16<T>(_mm_unpacklo_epi8(v, K_ZERO)));
+            __m128i hi = AdjustedYuvToGreen16<T>(AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm_unpackhi_epi8(u, K_ZERO)), AdjustUV16<T>(_mm_unpackhi_epi8(v, K_ZERO)));
+            return _mm_packus_epi16(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m128i YuvToBlue(__m128i y, __m128i u)
+        {
+            __m128i lo = AdjustedYuvToBlue16<T>(AdjustY16<T>(_mm_unpacklo_epi8(y, K_ZERO)), AdjustUV16<T>(_mm_unpacklo_epi8(u, K_ZERO)));
+            __m128i hi = AdjustedYuvToBlue16<T>(AdjustY16<T>(_mm_unpackhi_epi8(y, K_ZERO)), AdjustUV16<T>(_mm_unpackhi_epi8(u, K_ZERO)));
+            return _mm_packus_epi16(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToY32(__m128i b16_r16, __m128i g16_1)
+        {
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, SetInt16(T::B_2_Y, T::R_2_Y)),
+                _mm_madd_epi16(g16_1, SetInt16(T::G_2_Y, T::BGR_ROUND))), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToY16(__m128i b16, __m128i g16, __m128i r16)
+        {
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::Y_LO), _mm_packs_epi32(
+                BgrToY32<T>(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
+                BgrToY32<T>(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToY8(__m128i b8, __m128i g8, __m128i r8)
+        {
+            return _mm_packus_epi16(
+                BgrToY16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToY16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToU32(__m128i b16_r16, __m128i g16_1)
+        {
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, SetInt16(T::B_2_U, T::R_2_U)),
+                _mm_madd_epi16(g16_1, SetInt16(T::G_2_U, T::BGR_ROUND))), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToU16(__m128i b16, __m128i g16, __m128i r16)
+        {
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::UV_Z), _mm_packs_epi32(
+                BgrToU32<T>(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
+                BgrToU32<T>(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToU8(__m128i b8, __m128i g8, __m128i r8)
+        {
+            return _mm_packus_epi16(
+                BgrToU16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToU16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToV32(__m128i b16_r16, __m128i g16_1)
+        {
+            return _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(b16_r16, SetInt16(T::B_2_V, T::R_2_V)),
+                _mm_madd_epi16(g16_1, SetInt16(T::G_2_V, T::BGR_ROUND))), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToV16(__m128i b16, __m128i g16, __m128i r16)
+        {
+            return SaturateI16ToU8(_mm_add_epi16(_mm_set1_epi16(T::UV_Z), _mm_packs_epi32(
+                BgrToV32<T>(_mm_unpacklo_epi16(b16, r16), _mm_unpacklo_epi16(g16, K16_0001)),
+                BgrToV32<T>(_mm_unpackhi_epi16(b16, r16), _mm_unpackhi_epi16(g16, K16_0001)))));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToV8(__m128i b8, __m128i g8, __m128i r8)
+        {
+            return _mm_packus_epi16(
+                BgrToV16<T>(_mm_unpacklo_epi8(b8, K_ZERO), _mm_unpacklo_epi8(g8, K_ZERO), _mm_unpacklo_epi8(r8, K_ZERO)),
+                BgrToV16<T>(_mm_unpackhi_epi8(b8, K_ZERO), _mm_unpackhi_epi8(g8, K_ZERO), _mm_unpackhi_epi8(r8, K_ZERO)));
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        template<class T> SIMD_INLINE __m256i AdjustY16(__m256i y16)
+        {
+            return _mm256_subs_epi16(y16, _mm256_set1_epi16(T::Y_LO));
+        }
+
+        template<class T> SIMD_INLINE __m256i AdjustUV16(__m256i uv16)
+        {
+            return _mm256_subs_epi16(uv16, _mm256_set1_epi16(T::UV_Z));
+        }
+
+        template<class T> SIMD_INLINE __m256i AdjustedYuvToRed32(__m256i y16_1, __m256i v16_0)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16(T::Y_2_A, T::ROUND)),
+                _mm256_madd_epi16(v16_0, SetInt16(T::V_2_R, 0))), T::F);
+        }
+
+        template<class T> SIMD_INLINE __m256i AdjustedYuvToRed16(__m256i y16, __m256i v16)
+        {
+            return SaturateI16ToU8(_mm256_packs_epi32(
+                AdjustedYuvToRed32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(v16, K_ZERO))));
+        }
+
+        template<class T> SIMD_INLINE __m256i AdjustedYuvToGreen32(__m256i y16_1, __m256i u16_v16)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16(T::Y_2_A, T::ROUND)),
+                _mm256_madd_epi16(u16_v16, SetInt16(T::U_2_G, T::V_2_G))), T::F);
+        }
+
+        template<class T> SIMD_INLINE __m256i AdjustedYuvToGreen16(__m256i y16, __m256i u16, __m256i v16)
+        {
+            return SaturateI16ToU8(_mm256_packs_epi32(
+                AdjustedYuvToGreen32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, v16))));
+        }
+
+        template<class T> SIMD_INLINE __m256i AdjustedYuvToBlue32(__m256i y16_1, __m256i u16_0)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(y16_1, SetInt16(T::Y_2_A, T::ROUND)),
+                _mm256_madd_epi16(u16_0, SetInt16(T::U_2_B, 0))), T::F);
+        }
+
+        template<class T> SIMD_INLINE __m256i AdjustedYuvToBlue16(__m256i y16, __m256i u16)
+        {
+            return SaturateI16ToU8(_mm256_packs_epi32(
+                AdjustedYuvToBlue32<T>(_mm256_unpacklo_epi16(y16, K16_0001), _mm256_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm256_unpackhi_epi16(y16, K16_0001), _mm256_unpackhi_epi16(u16, K_ZERO))));
+        }
+
+        template<class T> SIMD_INLINE __m256i YuvToRed(__m256i y, __m256i v)
+        {
+            __m256i lo = AdjustedYuvToRed16<T>(AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)), AdjustUV16<T>(_mm256_unpacklo_epi8(v, K_ZERO)));
+            __m256i hi = AdjustedYuvToRed16<T>(AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)), AdjustUV16<T>(_mm256_unpackhi_epi8(v, K_ZERO)));
+            return _mm256_packus_epi16(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m256i YuvToGreen(__m256i y, __m256i u, __m256i v)
+        {
+            __m256i lo = AdjustedYuvToGreen16<T>(AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpacklo_epi8(u, K_ZERO)), AdjustUV16<T>(_mm256_unpacklo_epi8(v, K_ZERO)));
+            __m256i hi = AdjustedYuvToGreen16<T>(AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm256_unpackhi_epi8(u, K_ZERO)), AdjustUV16<T>(_mm256_unpackhi_epi8(v, K_ZERO)));
+            return _mm256_packus_epi16(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m256i YuvToBlue(__m256i y, __m256i u)
+        {
+            __m256i lo = AdjustedYuvToBlue16<T>(AdjustY16<T>(_mm256_unpacklo_epi8(y, K_ZERO)), AdjustUV16<T>(_mm256_unpacklo_epi8(u, K_ZERO)));
+            __m256i hi = AdjustedYuvToBlue16<T>(AdjustY16<T>(_mm256_unpackhi_epi8(y, K_ZERO)), AdjustUV16<T>(_mm256_unpackhi_epi8(u, K_ZERO)));
+            return _mm256_packus_epi16(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToY32(__m256i b16_r16, __m256i g16_1)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, SetInt16(T::B_2_Y, T::R_2_Y)),
+                _mm256_madd_epi16(g16_1, SetInt16(T::G_2_Y, T::BGR_ROUND))), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToY16(__m256i b16, __m256i g16, __m256i r16)
+        {
+            return SaturateI16ToU8(_mm256_add_epi16(_mm256_set1_epi16(T::Y_LO), _mm256_packs_epi32(
+                BgrToY32<T>(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
+                BgrToY32<T>(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToY8(__m256i b8, __m256i g8, __m256i r8)
+        {
+            return _mm256_packus_epi16(
+                BgrToY16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToY16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToU32(__m256i b16_r16, __m256i g16_1)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, SetInt16(T::B_2_U, T::R_2_U)),
+                _mm256_madd_epi16(g16_1, SetInt16(T::G_2_U, T::BGR_ROUND))), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToU16(__m256i b16, __m256i g16, __m256i r16)
+        {
+            return SaturateI16ToU8(_mm256_add_epi16(_mm256_set1_epi16(T::UV_Z), _mm256_packs_epi32(
+                BgrToU32<T>(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
+                BgrToU32<T>(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToU8(__m256i b8, __m256i g8, __m256i r8)
+        {
+            return _mm256_packus_epi16(
+                BgrToU16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToU16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToV32(__m256i b16_r16, __m256i g16_1)
+        {
+            return _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(b16_r16, SetInt16(T::B_2_V, T::R_2_V)),
+                _mm256_madd_epi16(g16_1, SetInt16(T::G_2_V, T::BGR_ROUND))), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToV16(__m256i b16, __m256i g16, __m256i r16)
+        {
+            return SaturateI16ToU8(_mm256_add_epi16(_mm256_set1_epi16(T::UV_Z), _mm256_packs_epi32(
+                BgrToV32<T>(_mm256_unpacklo_epi16(b16, r16), _mm256_unpacklo_epi16(g16, K16_0001)),
+                BgrToV32<T>(_mm256_unpackhi_epi16(b16, r16), _mm256_unpackhi_epi16(g16, K16_0001)))));
+        }
+
+        template<class T> SIMD_INLINE __m256i BgrToV8(__m256i b8, __m256i g8, __m256i r8)
+        {
+            return _mm256_packus_epi16(
+                BgrToV16<T>(_mm256_unpacklo_epi8(b8, K_ZERO), _mm256_unpacklo_epi8(g8, K_ZERO), _mm256_unpacklo_epi8(r8, K_ZERO)),
+                BgrToV16<T>(_mm256_unpackhi_epi8(b8, K_ZERO), _mm256_unpackhi_epi8(g8, K_ZERO), _mm256_unpackhi_epi8(r8, K_ZERO)));
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template<class T> SIMD_INLINE __m512i AdjustY16(__m512i y16)
+        {
+            return _mm512_subs_epi16(y16, _mm512_set1_epi16(T::Y_LO));
+        }
+
+        template<class T> SIMD_INLINE __m512i AdjustUV16(__m512i uv16)
+        {
+            return _mm512_subs_epi16(uv16, _mm512_set1_epi16(T::UV_Z));
+        }
+
+        template<class T> SIMD_INLINE __m512i AdjustedYuvToRed32(__m512i y16_1, __m512i v16_0)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16(T::Y_2_A, T::ROUND)),
+                _mm512_madd_epi16(v16_0, SetInt16(T::V_2_R, 0))), T::F);
+        }
+
+        template<class T> SIMD_INLINE __m512i AdjustedYuvToRed16(__m512i y16, __m512i v16)
+        {
+            return SaturateI16ToU8(_mm512_packs_epi32(
+                AdjustedYuvToRed32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(v16, K_ZERO))));
+        }
+
+        template<class T> SIMD_INLINE __m512i AdjustedYuvToGreen32(__m512i y16_1, __m512i u16_v16)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16(T::Y_2_A, T::ROUND)),
+                _mm512_madd_epi16(u16_v16, SetInt16(T::U_2_G, T::V_2_G))), T::F);
+        }
+
+        template<class T> SIMD_INLINE __m512i AdjustedYuvToGreen16(__m512i y16, __m512i u16, __m512i v16)
+        {
+            return SaturateI16ToU8(_mm512_packs_epi32(
+                AdjustedYuvToGreen32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, v16))));
+        }
+
+        template<class T> SIMD_INLINE __m512i AdjustedYuvToBlue32(__m512i y16_1, __m512i u16_0)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, SetInt16(T::Y_2_A, T::ROUND)),
+                _mm512_madd_epi16(u16_0, SetInt16(T::U_2_B, 0))), T::F);
+        }
+
+        template<class T> SIMD_INLINE __m512i AdjustedYuvToBlue16(__m512i y16, __m512i u16)
+        {
+            return SaturateI16ToU8(_mm512_packs_epi32(
+                AdjustedYuvToBlue32<T>(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32<T>(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, K_ZERO))));
+        }
+
+        template<class T> SIMD_INLINE __m512i YuvToRed(__m512i y, __m512i v)
+        {
+            __m512i lo = AdjustedYuvToRed16<T>(AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)), AdjustUV16<T>(_mm512_unpacklo_epi8(v, K_ZERO)));
+            __m512i hi = AdjustedYuvToRed16<T>(AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)), AdjustUV16<T>(_mm512_unpackhi_epi8(v, K_ZERO)));
+            return _mm512_packus_epi16(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m512i YuvToGreen(__m512i y, __m512i u, __m512i v)
+        {
+            __m512i lo = AdjustedYuvToGreen16<T>(AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpacklo_epi8(u, K_ZERO)), AdjustUV16<T>(_mm512_unpacklo_epi8(v, K_ZERO)));
+            __m512i hi = AdjustedYuvToGreen16<T>(AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)),
+                AdjustUV16<T>(_mm512_unpackhi_epi8(u, K_ZERO)), AdjustUV16<T>(_mm512_unpackhi_epi8(v, K_ZERO)));
+            return _mm512_packus_epi16(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m512i YuvToBlue(__m512i y, __m512i u)
+        {
+            __m512i lo = AdjustedYuvToBlue16<T>(AdjustY16<T>(_mm512_unpacklo_epi8(y, K_ZERO)), AdjustUV16<T>(_mm512_unpacklo_epi8(u, K_ZERO)));
+            __m512i hi = AdjustedYuvToBlue16<T>(AdjustY16<T>(_mm512_unpackhi_epi8(y, K_ZERO)), AdjustUV16<T>(_mm512_unpackhi_epi8(u, K_ZERO)));
+            return _mm512_packus_epi16(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToY32(__m512i b16_r16, __m512i g16_1)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, SetInt16(T::B_2_Y, T::R_2_Y)),
+                _mm512_madd_epi16(g16_1, SetInt16(T::G_2_Y, T::BGR_ROUND))), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToU32(__m512i b16_r16, __m512i g16_1)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, SetInt16(T::B_2_U, T::R_2_U)),
+                _mm512_madd_epi16(g16_1, SetInt16(T::G_2_U, T::BGR_ROUND))), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToV32(__m512i b16_r16, __m512i g16_1)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(b16_r16, SetInt16(T::B_2_V, T::R_2_V)),
+                _mm512_madd_epi16(g16_1, SetInt16(T::G_2_V, T::BGR_ROUND))), T::BGR_F);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        template <class T, int part> SIMD_INLINE int16x8_t AdjustY(uint8x16_t y)
+        {
+            return vsubq_s16((int16x8_t)UnpackU8<part>(y), vdupq_n_s16(T::Y_LO));
+        }
+
+        template <class T, int part> SIMD_INLINE int16x8_t AdjustUV(uint8x16_t uv)
+        {
+            return vsubq_s16((int16x8_t)UnpackU8<part>(uv), vdupq_n_s16(T::UV_Z));
+        }
+
+        template <class T, int part> SIMD_INLINE int32x4_t YuvToRed(int16x8_t y, int16x8_t v)
+        {
+            return vshrq_n_s32(vmlal_n_s16(vmlal_n_s16(vdupq_n_s32(T::ROUND), Half<part>(y), T::Y_2_A), Half<part>(v), T::V_2_R), T::F);
+        }
+
+        template <class T> SIMD_INLINE int16x8_t YuvToRed(int16x8_t y, int16x8_t v)
+        {
+            return PackI32(YuvToRed<T, 0>(y, v), YuvToRed<T, 1>(y, v));
+        }
+
+        template <class T, int part> SIMD_INLINE int32x4_t YuvToGreen(int16x8_t y, int16x8_t u, int16x8_t v)
+        {
+            return vshrq_n_s32(vmlal_n_s16(vmlal_n_s16(vmlal_n_s16(vdupq_n_s32(T::ROUND), Half<part>(y), T::Y_2_A),
+                Half<part>(u), T::U_2_G), Half<part>(v), T::V_2_G), T::F);
+        }
+
+        template <class T> SIMD_INLINE int16x8_t YuvToGreen(int16x8_t y, int16x8_t u, int16x8_t v)
+        {
+            return PackI32(YuvToGreen<T, 0>(y, u, v), YuvToGreen<T, 1>(y, u, v));
+        }
+
+        template <class T, int part> SIMD_INLINE int32x4_t YuvToBlue(int16x8_t y, int16x8_t u)
+        {
+            return vshrq_n_s32(vmlal_n_s16(vmlal_n_s16(vdupq_n_s32(T::ROUND), Half<part>(y), T::Y_2_A), Half<part>(u), T::U_2_B), T::F);
+        }
+
+        template <class T> SIMD_INLINE int16x8_t YuvToBlue(int16x8_t y, int16x8_t u)
+        {
+            return PackI32(YuvToBlue<T, 0>(y, u), YuvToBlue<T, 1>(y, u));
+        }
+
+        template <class T> SIMD_INLINE void YuvToBgr(uint8x16_t y, uint8x16_t u, uint8x16_t v, uint8x16x3_t & bgr)
+        {
+            int16x8_t yLo = AdjustY<T, 0>(y), uLo = AdjustUV<T, 0>(u), vLo = AdjustUV<T, 0>(v);
+            int16x8_t yHi = AdjustY<T, 1>(y), uHi = AdjustUV<T, 1>(u), vHi = AdjustUV<T, 1>(v);
+            bgr.val[0] = PackSaturatedI16(YuvToBlue<T>(yLo, uLo), YuvToBlue<T>(yHi, uHi));
+            bgr.val[1] = PackSaturatedI16(YuvToGreen<T>(yLo, uLo, vLo), YuvToGreen<T>(yHi, uHi, vHi));
+            bgr.val[2] = PackSaturatedI16(YuvToRed<T>(yLo, vLo), YuvToRed<T>(yHi, vHi));
+        }
+
+        template<class T, int part> SIMD_INLINE int32x4_t BgrToY(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        {
+            return vshrq_n_s32(vmlal_n_s16(vmlal_n_s16(vmlal_n_s16(vdupq_n_s32(T::BGR_ROUND), (int16x4_t)Half<part>(blue), T::B_2_Y),
+                (int16x4_t)Half<part>(green), T::G_2_Y), (int16x4_t)Half<part>(red), T::R_2_Y), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE int16x8_t BgrToY(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        {
+            return vaddq_s16(vdupq_n_s16(T::Y_LO), PackI32(BgrToY<T, 0>(blue, green, red), BgrToY<T, 1>(blue, green, red)));
+        }
+
+        template<class T> SIMD_INLINE uint8x16_t BgrToY(uint8x16_t blue, uint8x16_t green, uint8x16_t red)
+        {
+            return PackSaturatedI16(
+                BgrToY<T>(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red)),
+                BgrToY<T>(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red)));
+        }
+
+        template<class T, int part> SIMD_INLINE int32x4_t BgrToU(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        {
+            return vshrq_n_s32(vmlal_n_s16(vmlal_n_s16(vmlal_n_s16(vdupq_n_s32(T::BGR_ROUND), (int16x4_t)Half<part>(blue), T::B_2_U),
+                (int16x4_t)Half<part>(green), T::G_2_U), (int16x4_t)Half<part>(red), T::R_2_U), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE int16x8_t BgrToU(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        {
+            return vaddq_s16(vdupq_n_s16(T::UV_Z), PackI32(BgrToU<T, 0>(blue, green, red), BgrToU<T, 1>(blue, green, red)));
+        }
+
+        template<class T> SIMD_INLINE uint8x16_t BgrToU(uint8x16_t blue, uint8x16_t green, uint8x16_t red)
+        {
+            return PackSaturatedI16(
+                BgrToU<T>(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red)),
+                BgrToU<T>(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red)));
+        }
+
+        template<class T, int part> SIMD_INLINE int32x4_t BgrToV(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        {
+            return vshrq_n_s32(vmlal_n_s16(vmlal_n_s16(vmlal_n_s16(vdupq_n_s32(T::BGR_ROUND), (int16x4_t)Half<part>(blue), T::B_2_V),
+                (int16x4_t)Half<part>(green), T::G_2_V), (int16x4_t)Half<part>(red), T::R_2_V), T::BGR_F);
+        }
+
+        template<class T> SIMD_INLINE int16x8_t BgrToV(uint16x8_t blue, uint16x8_t green, uint16x8_t red)
+        {
+            return vaddq_s16(vdupq_n_s16(T::UV_Z), PackI32(BgrToV<T, 0>(blue, green, red), BgrToV<T, 1>(blue, green, red)));
+        }
+
+        template<class T> SIMD_INLINE uint8x16_t BgrToV(uint8x16_t blue, uint8x16_t green, uint8x16_t red)
+        {
+            return PackSaturatedI16(
+                BgrToV<T>(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red)),
+                BgrToV<T>(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red)));
+        }
+    }
+#endif// SIMD_NEON_ENABLE
+}
+#endif//__SimdYuvToBgr_h__
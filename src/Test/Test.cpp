@@ -108,6 +108,12 @@ namespace Test
     TEST_ADD_GROUP_AD0(BgrToYuv420p);
     TEST_ADD_GROUP_AD0(BgrToYuv422p);
     TEST_ADD_GROUP_AD0(BgrToYuv444p);
+    TEST_ADD_GROUP_A00(BgraToYuv420pV2);
+    TEST_ADD_GROUP_A00(BgraToYuv422pV2);
+    TEST_ADD_GROUP_A00(BgraToYuv444pV2);
+    TEST_ADD_GROUP_A00(BgrToYuv420pV2);
+    TEST_ADD_GROUP_A00(BgrToYuv422pV2);
+    TEST_ADD_GROUP_A00(BgrToYuv444pV2);
     TEST_ADD_GROUP_A00(BgraToYuva420p);
 
     TEST_ADD_GROUP_AD0(BackgroundGrowRangeSlow);
@@ -154,7 +160,10 @@ namespace Test
     TEST_ADD_GROUP_AD0(DetectionLbpDetect32fi);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ip);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ii);
+    TEST_ADD_GROUP_A00(DetectionLoadBinary);
     TEST_ADD_GROUP_00S(Detection);
+    TEST_ADD_GROUP_00S(DetectionBatch);
+    TEST_ADD_GROUP_00S(DetectionMotion);
 
     TEST_ADD_GROUP_AD0(AlphaBlending);
     TEST_ADD_GROUP_AD0(AlphaFilling);
@@ -286,11 +295,14 @@ namespace Test
     TEST_ADD_GROUP_AD0(OperationBinary16i);
     TEST_ADD_GROUP_AD0(VectorProduct);
 
+    TEST_ADD_GROUP_A00(ParallelRows);
+
     TEST_ADD_GROUP_AD0(ReduceColor2x2);
     TEST_ADD_GROUP_AD0(ReduceGray2x2);
     TEST_ADD_GROUP_AD0(ReduceGray3x3);
     TEST_ADD_GROUP_AD0(ReduceGray4x4);
     TEST_ADD_GROUP_AD0(ReduceGray5x5);
+    TEST_ADD_GROUP_A00(BuildPyramid);
 
     TEST_ADD_GROUP_AD0(Reorder16bit);
     TEST_ADD_GROUP_AD0(Reorder32bit);
@@ -298,6 +310,9 @@ namespace Test
 
     TEST_ADD_GROUP_ADS(ResizeBilinear);
     TEST_ADD_GROUP_A00(Resizer);
+    TEST_ADD_GROUP_A00(ResizerFilter);
+    TEST_ADD_GROUP_A00(ResizerCache);
+    TEST_ADD_GROUP_A00(ResizerStream);
 
     TEST_ADD_GROUP_AD0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_AD0(SegmentationFillSingleHoles);
@@ -337,6 +352,7 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetFusedLayerForward4);
     TEST_ADD_GROUP_A00(SynetFusedLayerForward8);
     TEST_ADD_GROUP_A00(SynetFusedLayerForward9);
+    TEST_ADD_GROUP_A00(SynetImageToTensor);
     TEST_ADD_GROUP_A00(SynetInnerProductLayerForward);
     TEST_ADD_GROUP_A00(SynetLrnLayerCrossChannels);
     TEST_ADD_GROUP_A00(SynetPoolingForwardMax);
@@ -349,6 +365,12 @@ namespace Test
 
     TEST_ADD_GROUP_A00(SynetConvolution32fForward);
 
+    TEST_ADD_GROUP_A00(RuntimeCache);
+
+    TEST_ADD_GROUP_A00(SynetConvolution8iForward);
+
+    TEST_ADD_GROUP_A00(SynetCropResize);
+
     TEST_ADD_GROUP_A00(SynetDeconvolution32fForward);
 
     TEST_ADD_GROUP_A00(SynetMergedConvolution32fForward);
@@ -360,6 +382,9 @@ namespace Test
 
     TEST_ADD_GROUP_A00(TransformImage);
 
+    TEST_ADD_GROUP_A00(WarpAffine);
+    TEST_ADD_GROUP_A00(WarpPerspective);
+
     TEST_ADD_GROUP_A00(Winograd2x3SetFilter);
     TEST_ADD_GROUP_A00(Winograd2x3SetInput);
     TEST_ADD_GROUP_A00(Winograd2x3SetOutput);
@@ -374,18 +399,28 @@ namespace Test
     TEST_ADD_GROUP_00S(Winograd3x3);
     TEST_ADD_GROUP_00S(Winograd4x3);
 
+    TEST_ADD_GROUP_AD0(Nv12ToBgr);
     TEST_ADD_GROUP_AD0(Yuv444pToBgr);
     TEST_ADD_GROUP_AD0(Yuv422pToBgr);
     TEST_ADD_GROUP_AD0(Yuv420pToBgr);
+    TEST_ADD_GROUP_A00(Nv12ToBgrV2);
+    TEST_ADD_GROUP_A00(Yuv444pToBgrV2);
+    TEST_ADD_GROUP_A00(Yuv422pToBgrV2);
+    TEST_ADD_GROUP_A00(Yuv420pToBgrV2);
     TEST_ADD_GROUP_AD0(Yuv444pToHsl);
     TEST_ADD_GROUP_AD0(Yuv444pToHsv);
     TEST_ADD_GROUP_AD0(Yuv444pToHue);
     TEST_ADD_GROUP_AD0(Yuv420pToHue);
 
+    TEST_ADD_GROUP_AD0(Nv12ToBgra);
     TEST_ADD_GROUP_A00(Yuva420pToBgra);
     TEST_ADD_GROUP_AD0(Yuv444pToBgra);
     TEST_ADD_GROUP_AD0(Yuv422pToBgra);
     TEST_ADD_GROUP_AD0(Yuv420pToBgra);
+    TEST_ADD_GROUP_A00(Nv12ToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv444pToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv422pToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv420pToBgraV2);
 
     class Task
     {
@@ -403,6 +403,287 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncYuvV2
+        {
+            typedef void(*FuncPtr)(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+                uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            FuncYuv::FuncPtr v1;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncYuvV2(const FuncPtr & f, const FuncYuv::FuncPtr & r, const String & d) : func(f), v1(r), description(d), yuvType(SimdYuvBt601) {}
+
+            void Update(SimdYuvType type)
+            {
+                yuvType = type;
+                description = description + "[" + ToString(int(type)) + "]";
+            }
+
+            void Call(const View & bgr, View & y, View & u, View & v) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+            }
+
+            void CallV1(const View & bgr, View & y, View & u, View & v) const
+            {
+                v1(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
+            }
+        };
+    }
+
+#define FUNC_YUV_V2(function, v1) FuncYuvV2(function, v1, #function)
+
+    bool AnyToYuvV2AutoTest(int width, int height, View::Format srcType, int dx, int dy, SimdYuvType yuvType, FuncYuvV2 f1, FuncYuvV2 f2)
+    {
+        bool result = true;
+
+        f1.Update(yuvType);
+        f2.Update(yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / dx;
+        const int uvHeight = height / dy;
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u1(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        View v1(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u2(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        View v2(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, y1, u1, v1));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, y2, u2, v2));
+
+        result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+        result = result && Compare(u1, u2, 0, true, 64, 0, "u");
+        result = result && Compare(v1, v2, 0, true, 64, 0, "v");
+
+        if (yuvType == SimdYuvBt601)
+        {
+            f1.CallV1(src, y2, u2, v2);
+            result = result && Compare(y1, y2, 0, true, 64, 0, "y v1");
+            result = result && Compare(u1, u2, 0, true, 64, 0, "u v1");
+            result = result && Compare(v1, v2, 0, true, 64, 0, "v v1");
+        }
+
+        if (dx == 1 && dy == 1)
+        {
+            BgrToYuv444pReference(src, y2, u2, v2, yuvType);
+            result = result && Compare(y1, y2, 1, true, 64, 0, "y reference");
+            result = result && Compare(u1, u2, 1, true, 64, 0, "u reference");
+            result = result && Compare(v1, v2, 1, true, 64, 0, "v reference");
+        }
+
+        return result;
+    }
+
+    bool AnyToYuvV2AutoTest(View::Format srcType, int dx, int dy, const FuncYuvV2 & f1, const FuncYuvV2 & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvTrect871 && result; ++type)
+        {
+            result = result && AnyToYuvV2AutoTest(W, H, srcType, dx, dy, (SimdYuvType)type, f1, f2);
+            result = result && AnyToYuvV2AutoTest(W + O*dx, H - O*dy, srcType, dx, dy, (SimdYuvType)type, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool BgraToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Base::BgraToYuv420pV2, Simd::Base::BgraToYuv420p), FUNC_YUV_V2(SimdBgraToYuv420pV2, SimdBgraToYuv420p));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Sse2::BgraToYuv420pV2, Simd::Sse2::BgraToYuv420p), FUNC_YUV_V2(SimdBgraToYuv420pV2, SimdBgraToYuv420p));
+#endif
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Ssse3::BgraToYuv420pV2, Simd::Ssse3::BgraToYuv420p), FUNC_YUV_V2(SimdBgraToYuv420pV2, SimdBgraToYuv420p));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Avx2::BgraToYuv420pV2, Simd::Avx2::BgraToYuv420p), FUNC_YUV_V2(SimdBgraToYuv420pV2, SimdBgraToYuv420p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv420pV2, Simd::Avx512bw::BgraToYuv420p), FUNC_YUV_V2(SimdBgraToYuv420pV2, SimdBgraToYuv420p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 2, FUNC_YUV_V2(Simd::Neon::BgraToYuv420pV2, Simd::Neon::BgraToYuv420p), FUNC_YUV_V2(SimdBgraToYuv420pV2, SimdBgraToYuv420p));
+#endif
+
+        return result;
+    }
+
+    bool BgraToYuv422pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Base::BgraToYuv422pV2, Simd::Base::BgraToYuv422p), FUNC_YUV_V2(SimdBgraToYuv422pV2, SimdBgraToYuv422p));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Sse2::BgraToYuv422pV2, Simd::Sse2::BgraToYuv422p), FUNC_YUV_V2(SimdBgraToYuv422pV2, SimdBgraToYuv422p));
+#endif
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Ssse3::BgraToYuv422pV2, Simd::Ssse3::BgraToYuv422p), FUNC_YUV_V2(SimdBgraToYuv422pV2, SimdBgraToYuv422p));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Avx2::BgraToYuv422pV2, Simd::Avx2::BgraToYuv422p), FUNC_YUV_V2(SimdBgraToYuv422pV2, SimdBgraToYuv422p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv422pV2, Simd::Avx512bw::BgraToYuv422p), FUNC_YUV_V2(SimdBgraToYuv422pV2, SimdBgraToYuv422p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 2, 1, FUNC_YUV_V2(Simd::Neon::BgraToYuv422pV2, Simd::Neon::BgraToYuv422p), FUNC_YUV_V2(SimdBgraToYuv422pV2, SimdBgraToYuv422p));
+#endif
+
+        return result;
+    }
+
+    bool BgraToYuv444pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Base::BgraToYuv444pV2, Simd::Base::BgraToYuv444p), FUNC_YUV_V2(SimdBgraToYuv444pV2, SimdBgraToYuv444p));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable && W >= Simd::Sse2::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Sse2::BgraToYuv444pV2, Simd::Sse2::BgraToYuv444p), FUNC_YUV_V2(SimdBgraToYuv444pV2, SimdBgraToYuv444p));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Avx2::BgraToYuv444pV2, Simd::Avx2::BgraToYuv444p), FUNC_YUV_V2(SimdBgraToYuv444pV2, SimdBgraToYuv444p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Avx512bw::BgraToYuv444pV2, Simd::Avx512bw::BgraToYuv444p), FUNC_YUV_V2(SimdBgraToYuv444pV2, SimdBgraToYuv444p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, 1, 1, FUNC_YUV_V2(Simd::Neon::BgraToYuv444pV2, Simd::Neon::BgraToYuv444p), FUNC_YUV_V2(SimdBgraToYuv444pV2, SimdBgraToYuv444p));
+#endif
+
+        return result;
+    }
+
+    bool BgrToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Base::BgrToYuv420pV2, Simd::Base::BgrToYuv420p), FUNC_YUV_V2(SimdBgrToYuv420pV2, SimdBgrToYuv420p));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Ssse3::BgrToYuv420pV2, Simd::Ssse3::BgrToYuv420p), FUNC_YUV_V2(SimdBgrToYuv420pV2, SimdBgrToYuv420p));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Avx2::BgrToYuv420pV2, Simd::Avx2::BgrToYuv420p), FUNC_YUV_V2(SimdBgrToYuv420pV2, SimdBgrToYuv420p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv420pV2, Simd::Avx512bw::BgrToYuv420p), FUNC_YUV_V2(SimdBgrToYuv420pV2, SimdBgrToYuv420p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 2, FUNC_YUV_V2(Simd::Neon::BgrToYuv420pV2, Simd::Neon::BgrToYuv420p), FUNC_YUV_V2(SimdBgrToYuv420pV2, SimdBgrToYuv420p));
+#endif
+
+        return result;
+    }
+
+    bool BgrToYuv422pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv422pV2, Simd::Base::BgrToYuv422p), FUNC_YUV_V2(SimdBgrToYuv422pV2, SimdBgrToYuv422p));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Ssse3::BgrToYuv422pV2, Simd::Ssse3::BgrToYuv422p), FUNC_YUV_V2(SimdBgrToYuv422pV2, SimdBgrToYuv422p));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Avx2::BgrToYuv422pV2, Simd::Avx2::BgrToYuv422p), FUNC_YUV_V2(SimdBgrToYuv422pV2, SimdBgrToYuv422p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv422pV2, Simd::Avx512bw::BgrToYuv422p), FUNC_YUV_V2(SimdBgrToYuv422pV2, SimdBgrToYuv422p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 2, 1, FUNC_YUV_V2(Simd::Neon::BgrToYuv422pV2, Simd::Neon::BgrToYuv422p), FUNC_YUV_V2(SimdBgrToYuv422pV2, SimdBgrToYuv422p));
+#endif
+
+        return result;
+    }
+
+    bool BgrToYuv444pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Base::BgrToYuv444pV2, Simd::Base::BgrToYuv444p), FUNC_YUV_V2(SimdBgrToYuv444pV2, SimdBgrToYuv444p));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Ssse3::BgrToYuv444pV2, Simd::Ssse3::BgrToYuv444p), FUNC_YUV_V2(SimdBgrToYuv444pV2, SimdBgrToYuv444p));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Avx2::BgrToYuv444pV2, Simd::Avx2::BgrToYuv444p), FUNC_YUV_V2(SimdBgrToYuv444pV2, SimdBgrToYuv444p));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Avx512bw::BgrToYuv444pV2, Simd::Avx512bw::BgrToYuv444p), FUNC_YUV_V2(SimdBgrToYuv444pV2, SimdBgrToYuv444p));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, 1, 1, FUNC_YUV_V2(Simd::Neon::BgrToYuv444pV2, Simd::Neon::BgrToYuv444p), FUNC_YUV_V2(SimdBgrToYuv444pV2, SimdBgrToYuv444p));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool AnyToYuvDataTest(bool create, int width, int height, View::Format srcType, int dx, int dy, const FuncYuv & f)
@@ -162,11 +162,15 @@ namespace Test
         View sqsum(width + 1, height + 1, View::Int32);
         View tilted(width + 1, height + 1, View::Int32);
 
-        void * hid = SimdDetectionInit(data, sum.data, sum.stride, sum.width, sum.height,
+        void * hid1 = SimdDetectionInit(data, sum.data, sum.stride, sum.width, sum.height,
             sqsum.data, sqsum.stride, tilted.data, tilted.stride, throughColumn, int16);
-        if (hid == NULL)
+        void * hid2 = SimdDetectionInit(data, sum.data, sum.stride, sum.width, sum.height,
+            sqsum.data, sqsum.stride, tilted.data, tilted.stride, throughColumn, int16);
+        if (hid1 == NULL || hid2 == NULL)
         {
             TEST_LOG_SS(Error, "Can't init haar cascade!");
+            SimdRelease(hid1);
+            SimdRelease(hid2);
             return false;
         }
 
@@ -192,15 +196,17 @@ namespace Test
         else
             Simd::Integral(src, sum, sqsum);
 
-        SimdDetectionPrepare(hid);
+        SimdDetectionPrepare(hid1);
+        SimdDetectionPrepareRegion(hid2, rect.left, rect.top, rect.right + w + 1, rect.bottom + h + 1);
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(hid, mask, rect, dst1));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(hid1, mask, rect, dst1));
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(hid, mask, rect, dst2));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(hid2, mask, rect, dst2));
 
         result = result && Compare(dst1, dst2, 0, true, 32);
 
-        SimdRelease(hid);
+        SimdRelease(hid1);
+        SimdRelease(hid2);
 
         //Annotate(src, dst1, w, h, f1.description);
         //Annotate(src, dst2, w, h, f2.description);
@@ -427,6 +433,207 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    bool DetectionLoadBinaryDetect(const void * data, const View & src, const FuncD & haar, const FuncD & lbp, View & dst)
+    {
+        size_t w, h;
+        SimdDetectionInfoFlags flags;
+        SimdDetectionInfo(data, &w, &h, &flags);
+
+        View sum(src.width + 1, src.height + 1, View::Int32);
+        View sqsum(src.width + 1, src.height + 1, View::Int32);
+        View tilted(src.width + 1, src.height + 1, View::Int32);
+        Simd::Integral(src, sum, sqsum, tilted);
+
+        void * hid = SimdDetectionInit(data, sum.data, sum.stride, sum.width, sum.height,
+            sqsum.data, sqsum.stride, tilted.data, tilted.stride, 0, 0);
+        if (hid == NULL)
+            return false;
+
+        View mask(src.Size(), View::Gray8);
+        Simd::Fill(mask, 255);
+        Simd::Fill(dst, 0);
+
+        SimdDetectionPrepare(hid);
+        const FuncD & f = (flags & SimdDetectionInfoFeatureMask) == SimdDetectionInfoFeatureLbp ? lbp : haar;
+        f.Call(hid, mask, Rect(0, 0, src.width - w, src.height - h), dst);
+
+        SimdRelease(hid);
+        return true;
+    }
+
+    namespace
+    {
+        // Mirrors the header of binary cascade which is written by SimdDetectionSaveBinary.
+        struct BinaryHeader
+        {
+            uint32_t magic, version, headerSize, align;
+            uint32_t recordSize[7];
+            int32_t featureType, ncategories, width, height;
+            uint8_t isStumpBased, hasTilted, canInt16, reserved;
+            uint64_t count[7];
+        };
+
+        typedef std::vector<char> Blob;
+
+        bool LoadBlob(const String & path, Blob & blob)
+        {
+            std::ifstream ifs(path.c_str(), std::ifstream::binary);
+            if (!ifs.is_open())
+                return false;
+            blob.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+            return blob.size() >= sizeof(BinaryHeader);
+        }
+
+        size_t BlobArrayOffset(const Blob & blob, size_t index)
+        {
+            BinaryHeader header;
+            memcpy(&header, blob.data(), sizeof(header));
+            size_t offset = header.headerSize;
+            for (size_t i = 0; i < index; ++i)
+                offset = (offset + header.align - 1) / header.align * header.align + (size_t)header.count[i] * header.recordSize[i];
+            return (offset + header.align - 1) / header.align * header.align;
+        }
+
+        void BlobSetInt(Blob & blob, size_t offset, int32_t value)
+        {
+            memcpy(blob.data() + offset, &value, sizeof(value));
+        }
+    }
+
+    bool DetectionLoadBinaryRejectTest(const Blob & blob, const String & desc)
+    {
+        String path = TemporaryPath("SimdDetectionRejected.bin");
+        {
+            std::ofstream ofs(path.c_str(), std::ofstream::binary);
+            ofs.write(blob.data(), blob.size());
+            if (!ofs.good())
+            {
+                TEST_LOG_SS(Error, "Can't save binary cascade '" << path << "' !");
+                return false;
+            }
+        }
+
+        void * bin = SimdDetectionLoadBinary(path.c_str());
+        std::remove(path.c_str());
+        if (bin != NULL)
+        {
+            TEST_LOG_SS(Error, "SimdDetectionLoadBinary accepts binary cascade with " << desc << " !");
+            SimdRelease(bin);
+            return false;
+        }
+        return true;
+    }
+
+    bool DetectionLoadBinaryRejectTest(const String & path)
+    {
+        bool result = true;
+
+        Blob blob;
+        if (!LoadBlob(path, blob))
+        {
+            TEST_LOG_SS(Error, "Can't read binary cascade '" << path << "' !");
+            return false;
+        }
+        BinaryHeader header;
+        memcpy(&header, blob.data(), sizeof(header));
+
+        result = result && DetectionLoadBinaryRejectTest(Blob(blob.begin(), blob.begin() + sizeof(header) - 1), "truncated header");
+        result = result && DetectionLoadBinaryRejectTest(Blob(blob.begin(), blob.begin() + blob.size() / 2), "truncated arrays");
+
+        Blob version(blob);
+        BlobSetInt(version, offsetof(BinaryHeader, version), header.version + 1);
+        result = result && DetectionLoadBinaryRejectTest(version, "wrong version");
+
+        Blob index(blob);
+        BlobSetInt(index, BlobArrayOffset(blob, 2), int32_t(header.count[5] + header.count[6]));
+        result = result && DetectionLoadBinaryRejectTest(index, "bad feature index");
+
+        Blob nodeCount(blob);
+        BlobSetInt(nodeCount, BlobArrayOffset(blob, 1), 2);
+        result = result && DetectionLoadBinaryRejectTest(nodeCount, "bad node count");
+
+        Blob rect(blob);
+        if (header.featureType == SimdDetectionInfoFeatureHaar)
+            BlobSetInt(rect, BlobArrayOffset(blob, 5) + sizeof(int32_t), header.width);
+        else
+            BlobSetInt(rect, BlobArrayOffset(blob, 6), header.width);
+        result = result && DetectionLoadBinaryRejectTest(rect, "feature rectangle outside of window");
+
+        return result;
+    }
+
+    bool DetectionLoadBinaryAutoTest(const String & name)
+    {
+        bool result = true;
+
+        String xmlPath = ROOT_PATH + "/data/cascade/" + name + ".xml", binPath = TemporaryPath(name + ".bin");
+
+        TEST_LOG_SS(Info, "Test SimdDetectionSaveBinary & SimdDetectionLoadBinary for '" << name << "'.");
+
+        void * xml = SimdDetectionLoadA(xmlPath.c_str());
+        if (xml == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load cascade '" << xmlPath << "' !");
+            return false;
+        }
+
+        if (SimdDetectionSaveBinary(xml, binPath.c_str()) != SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't save binary cascade '" << binPath << "' !");
+            SimdRelease(xml);
+            return false;
+        }
+
+        void * bin = SimdDetectionLoadBinary(binPath.c_str());
+        if (bin == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load binary cascade '" << binPath << "' !");
+            std::remove(binPath.c_str());
+            SimdRelease(xml);
+            return false;
+        }
+
+        result = result && DetectionLoadBinaryRejectTest(binPath);
+        std::remove(binPath.c_str());
+
+        size_t w1, h1, w2, h2;
+        SimdDetectionInfoFlags f1, f2;
+        SimdDetectionInfo(xml, &w1, &h1, &f1);
+        SimdDetectionInfo(bin, &w2, &h2, &f2);
+        if (w1 != w2 || h1 != h2 || f1 != f2)
+        {
+            TEST_LOG_SS(Error, "Information of binary cascade is different: [" << w1 << ", " << h1 << ", " << f1 << "] != [" << w2 << ", " << h2 << ", " << f2 << "] !");
+            result = false;
+        }
+
+        View src = GetSample(Size(W, H), false);
+        View dst1(W, H, View::Gray8), dst2(W, H, View::Gray8);
+        if (result)
+        {
+            result = result && DetectionLoadBinaryDetect(xml, src, FUNC_D(SimdDetectionHaarDetect32fp), FUNC_D(SimdDetectionLbpDetect32fp), dst1);
+            result = result && DetectionLoadBinaryDetect(bin, src, FUNC_D(SimdDetectionHaarDetect32fp), FUNC_D(SimdDetectionLbpDetect32fp), dst2);
+            result = result && Compare(dst1, dst2, 0, true, 32);
+        }
+
+        SimdRelease(bin);
+        SimdRelease(xml);
+
+        return result;
+    }
+
+    bool DetectionLoadBinaryAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionLoadBinaryAutoTest("haar_face_0");
+        result = result && DetectionLoadBinaryAutoTest("haar_face_1");
+        result = result && DetectionLoadBinaryAutoTest("lbp_face");
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool DetectionDetectDataTest(bool create, const String & path, int width, int height, int throughColumn, int int16, const FuncD & f)
     {
         bool result = true;
@@ -658,5 +865,88 @@ namespace Test
 
         return result;
     }
+
+    static bool DetectionObjectsCompare(const Objects & o1, const Objects & o2, const String & desc)
+    {
+        bool result = o1.size() == o2.size();
+        for (size_t i = 0; i < o1.size() && result; ++i)
+            if (o1[i].rect != o2[i].rect || o1[i].weight != o2[i].weight || o1[i].tag != o2[i].tag)
+                result = false;
+        if (!result)
+            TEST_LOG_SS(Error, "Batch detection result of " << desc << " is different: " << o2.size() << " objects instead of " << o1.size() << " !");
+        return result;
+    }
+
+    bool DetectionMotionSpecialTest()
+    {
+        bool result = true;
+
+        View src = GetSample(Size(W, H), true);
+        Detection::Rects full(1, Rect(src.Size())), left(1, Rect(0, 0, W / 2, H)), right(1, Rect(W / 2, 0, W, H));
+
+        Detection reference, reused, restricted;
+        Detection * detections[3] = { &reference, &reused, &restricted };
+        for (size_t i = 0; i < 3; ++i)
+        {
+            detections[i]->Load(ROOT_PATH + "/data/cascade/haar_face_0.xml", 0);
+            detections[i]->Load(ROOT_PATH + "/data/cascade/lbp_face.xml", 1);
+            detections[i]->Init(src.Size(), 1.1, Size(), Size(INT_MAX, INT_MAX), View(), 1);
+        }
+        restricted.SetMotionRestricted(true);
+
+        Objects o0, o1, o2, o3;
+        reference.Detect(src, o0);
+
+        reused.Detect(src, o1, 3, 0.2, true, full);
+        result = result && DetectionObjectsCompare(o0, o1, "default mode with full frame motion region");
+
+        restricted.Detect(src, o1, 3, 0.2, true, full);
+        result = result && DetectionObjectsCompare(o0, o1, "restricted mode with full frame motion region");
+
+        reference.Detect(src, o2, 3, 0.2, true, left);
+        reused.Detect(src, o3, 3, 0.2, true, right);
+        reused.Detect(src, o3, 3, 0.2, true, left);
+        result = result && DetectionObjectsCompare(o2, o3, "default mode with motion region after another region");
+
+        return result;
+    }
+
+    bool DetectionBatchSpecialTest()
+    {
+        Detection detection;
+        detection.Load(ROOT_PATH + "/data/cascade/haar_face_0.xml", 0);
+        detection.Load(ROOT_PATH + "/data/cascade/lbp_face.xml", 1);
+
+        View big = GetSample(Size(W, H), true);
+        View small(big.Size() * 2 / 3, View::Gray8);
+        Simd::ResizeBilinear(big, small);
+
+        Objects os, ob;
+        detection.Init(small.Size(), 1.1, Size(), Size(INT_MAX, INT_MAX), View(), 1);
+        detection.Detect(small, os);
+        detection.Init(big.Size(), 1.1, Size(), Size(INT_MAX, INT_MAX), View(), 1);
+        detection.Detect(big, ob);
+
+        Detection::Views srcs;
+        srcs.push_back(big);
+        srcs.push_back(small);
+        srcs.push_back(big);
+
+        detection.Init(big.Size());
+        std::vector<Objects> objects;
+        bool result = true;
+        for (size_t n = 0; n < 2 && result; ++n)
+        {
+            double time = GetTime();
+            result = detection.Detect(srcs, objects);
+            TEST_LOG_SS(Info, "Detect batch of " << srcs.size() << " images : " << (GetTime() - time) * 1000 << " ms ");
+            result = result && objects.size() == srcs.size();
+            result = result && DetectionObjectsCompare(ob, objects[0], "image 0");
+            result = result && DetectionObjectsCompare(os, objects[1], "image 1");
+            result = result && DetectionObjectsCompare(ob, objects[2], "image 2");
+        }
+
+        return result;
+    }
 }
 
@@ -0,0 +1,422 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncBgr
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncBgr(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & y, const View & uv, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride);
+            }
+        };
+
+        struct FuncBgra
+        {
+            typedef void(*FuncPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+
+            FuncPtr func;
+            String description;
+
+            FuncBgra(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & y, const View & uv, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, 0xFF);
+            }
+        };
+
+        void Nv12ToBgrReference(const View & y, const View & uv, View & dst)
+        {
+            View u(uv.width, uv.height, View::Gray8, NULL, TEST_ALIGN(uv.width));
+            View v(uv.width, uv.height, View::Gray8, NULL, TEST_ALIGN(uv.width));
+            Simd::DeinterleaveUv(uv, u, v);
+            Simd::Yuv420pToBgr(y, u, v, dst);
+        }
+
+        void Nv12ToBgraReference(const View & y, const View & uv, View & dst)
+        {
+            View u(uv.width, uv.height, View::Gray8, NULL, TEST_ALIGN(uv.width));
+            View v(uv.width, uv.height, View::Gray8, NULL, TEST_ALIGN(uv.width));
+            Simd::DeinterleaveUv(uv, u, v);
+            Simd::Yuv420pToBgra(y, u, v, dst, 0xFF);
+        }
+    }
+
+#define FUNC_BGR(function) FuncBgr(function, #function)
+#define FUNC_BGRA(function) FuncBgra(function, #function)
+
+    template<class Func> bool Nv12ToAnyAutoTest(int width, int height, View::Format dstType, const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst3(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 255);
+
+        if (dstType == View::Bgr24)
+            Nv12ToBgrReference(y, uv, dst3);
+        else
+            Nv12ToBgraReference(y, uv, dst3);
+
+        result = result && Compare(dst1, dst3, 0, true, 64, 255, "reference");
+
+        return result;
+    }
+
+    template<class Func> bool Nv12ToAnyAutoTest(View::Format dstType, const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyAutoTest(W, H, dstType, f1, f2);
+        result = result && Nv12ToAnyAutoTest(W + O * 2, H - O * 2, dstType, f1, f2);
+        result = result && Nv12ToAnyAutoTest(W - O * 2, H + O * 2, dstType, f1, f2);
+
+        return result;
+    }
+
+    bool Nv12ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyAutoTest(View::Bgr24, FUNC_BGR(Simd::Base::Nv12ToBgr), FUNC_BGR(SimdNv12ToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Bgr24, FUNC_BGR(Simd::Ssse3::Nv12ToBgr), FUNC_BGR(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Bgr24, FUNC_BGR(Simd::Avx2::Nv12ToBgr), FUNC_BGR(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Bgr24, FUNC_BGR(Simd::Avx512bw::Nv12ToBgr), FUNC_BGR(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Bgr24, FUNC_BGR(Simd::Neon::Nv12ToBgr), FUNC_BGR(SimdNv12ToBgr));
+#endif
+
+        return result;
+    }
+
+    bool Nv12ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyAutoTest(View::Bgra32, FUNC_BGRA(Simd::Base::Nv12ToBgra), FUNC_BGRA(SimdNv12ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Bgra32, FUNC_BGRA(Simd::Sse2::Nv12ToBgra), FUNC_BGRA(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Bgra32, FUNC_BGRA(Simd::Avx2::Nv12ToBgra), FUNC_BGRA(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Bgra32, FUNC_BGRA(Simd::Avx512bw::Nv12ToBgra), FUNC_BGRA(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Bgra32, FUNC_BGRA(Simd::Neon::Nv12ToBgra), FUNC_BGRA(SimdNv12ToBgra));
+#endif
+
+        return result;
+    }
+
+    namespace
+    {
+        struct FuncNv12V2
+        {
+            typedef void(*FuncBgrPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+            typedef void(*FuncBgrV2Ptr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+            typedef void(*FuncBgraPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+            typedef void(*FuncBgraV2Ptr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncBgrV2Ptr bgr;
+            FuncBgrPtr bgrV1;
+            FuncBgraV2Ptr bgra;
+            FuncBgraPtr bgraV1;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncNv12V2(const FuncBgrV2Ptr & f, const FuncBgrPtr & v1, const String & d) : bgr(f), bgrV1(v1), bgra(NULL), bgraV1(NULL), description(d), yuvType(SimdYuvBt601) {}
+            FuncNv12V2(const FuncBgraV2Ptr & f, const FuncBgraPtr & v1, const String & d) : bgr(NULL), bgrV1(NULL), bgra(f), bgraV1(v1), description(d), yuvType(SimdYuvBt601) {}
+
+            View::Format Format() const
+            {
+                return bgr ? View::Bgr24 : View::Bgra32;
+            }
+
+            void Update(SimdYuvType type)
+            {
+                yuvType = type;
+                description = description + "[" + ToString(int(type)) + "]";
+            }
+
+            void Call(const View & y, const View & uv, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (bgr)
+                    bgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+                else
+                    bgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, 0xFF, yuvType);
+            }
+
+            void CallV1(const View & y, const View & uv, View & dst) const
+            {
+                if (bgrV1)
+                    bgrV1(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride);
+                else
+                    bgraV1(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, 0xFF);
+            }
+        };
+
+        void Nv12ToAnyV2Reference(const View & y, const View & uv, View & dst, SimdYuvType yuvType)
+        {
+            View u(uv.width, uv.height, View::Gray8, NULL, TEST_ALIGN(uv.width));
+            View v(uv.width, uv.height, View::Gray8, NULL, TEST_ALIGN(uv.width));
+            Simd::DeinterleaveUv(uv, u, v);
+            if (dst.format == View::Bgr24)
+                Simd::Yuv420pToBgrV2(y, u, v, dst, yuvType);
+            else
+                Simd::Yuv420pToBgraV2(y, u, v, dst, 0xFF, yuvType);
+        }
+    }
+
+#define FUNC_NV12_V2(function, v1) FuncNv12V2(function, v1, #function)
+
+    bool Nv12ToAnyV2AutoTest(int width, int height, SimdYuvType yuvType, FuncNv12V2 f1, FuncNv12V2 f2)
+    {
+        bool result = true;
+
+        f1.Update(yuvType);
+        f2.Update(yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View dst1(width, height, f1.Format(), NULL, TEST_ALIGN(width));
+        View dst2(width, height, f1.Format(), NULL, TEST_ALIGN(width));
+        View dst3(width, height, f1.Format(), NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 255);
+
+        Nv12ToAnyV2Reference(y, uv, dst3, yuvType);
+        result = result && Compare(dst1, dst3, 0, true, 64, 255, "reference");
+
+        if (yuvType == SimdYuvBt601)
+        {
+            f1.CallV1(y, uv, dst3);
+            result = result && Compare(dst1, dst3, 0, true, 64, 255, "v1");
+        }
+
+        return result;
+    }
+
+    bool Nv12ToAnyV2AutoTest(const FuncNv12V2 & f1, const FuncNv12V2 & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvTrect871 && result; ++type)
+        {
+            result = result && Nv12ToAnyV2AutoTest(W, H, (SimdYuvType)type, f1, f2);
+            result = result && Nv12ToAnyV2AutoTest(W + O * 2, H - O * 2, (SimdYuvType)type, f1, f2);
+            result = result && Nv12ToAnyV2AutoTest(W - O * 2, H + O * 2, (SimdYuvType)type, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool Nv12ToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyV2AutoTest(FUNC_NV12_V2(Simd::Base::Nv12ToBgrV2, Simd::Base::Nv12ToBgr), FUNC_NV12_V2(SimdNv12ToBgrV2, SimdNv12ToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && Nv12ToAnyV2AutoTest(FUNC_NV12_V2(Simd::Ssse3::Nv12ToBgrV2, Simd::Ssse3::Nv12ToBgr), FUNC_NV12_V2(SimdNv12ToBgrV2, SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Nv12ToAnyV2AutoTest(FUNC_NV12_V2(Simd::Avx2::Nv12ToBgrV2, Simd::Avx2::Nv12ToBgr), FUNC_NV12_V2(SimdNv12ToBgrV2, SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToAnyV2AutoTest(FUNC_NV12_V2(Simd::Avx512bw::Nv12ToBgrV2, Simd::Avx512bw::Nv12ToBgr), FUNC_NV12_V2(SimdNv12ToBgrV2, SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Nv12ToAnyV2AutoTest(FUNC_NV12_V2(Simd::Neon::Nv12ToBgrV2, Simd::Neon::Nv12ToBgr), FUNC_NV12_V2(SimdNv12ToBgrV2, SimdNv12ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyV2AutoTest(FUNC_NV12_V2(Simd::Base::Nv12ToBgraV2, Simd::Base::Nv12ToBgra), FUNC_NV12_V2(SimdNv12ToBgraV2, SimdNv12ToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && Nv12ToAnyV2AutoTest(FUNC_NV12_V2(Simd::Sse2::Nv12ToBgraV2, Simd::Sse2::Nv12ToBgra), FUNC_NV12_V2(SimdNv12ToBgraV2, SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Nv12ToAnyV2AutoTest(FUNC_NV12_V2(Simd::Avx2::Nv12ToBgraV2, Simd::Avx2::Nv12ToBgra), FUNC_NV12_V2(SimdNv12ToBgraV2, SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToAnyV2AutoTest(FUNC_NV12_V2(Simd::Avx512bw::Nv12ToBgraV2, Simd::Avx512bw::Nv12ToBgra), FUNC_NV12_V2(SimdNv12ToBgraV2, SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && Nv12ToAnyV2AutoTest(FUNC_NV12_V2(Simd::Neon::Nv12ToBgraV2, Simd::Neon::Nv12ToBgra), FUNC_NV12_V2(SimdNv12ToBgraV2, SimdNv12ToBgra));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    template<class Func> bool Nv12ToAnyDataTest(bool create, int width, int height, View::Format dstType, const Func & f)
+    {
+        bool result = true;
+
+        Data data(f.description);
+
+        TEST_LOG_SS(Info, (create ? "Create" : "Verify") << " test " << f.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        if (create)
+        {
+            FillRandom(y);
+            FillRandom(uv);
+
+            TEST_SAVE(y);
+            TEST_SAVE(uv);
+
+            f.Call(y, uv, dst1);
+
+            TEST_SAVE(dst1);
+        }
+        else
+        {
+            TEST_LOAD(y);
+            TEST_LOAD(uv);
+
+            TEST_LOAD(dst1);
+
+            f.Call(y, uv, dst2);
+
+            TEST_SAVE(dst2);
+
+            result = result && Compare(dst1, dst2, 0, true, 64, 255);
+        }
+
+        return result;
+    }
+
+    bool Nv12ToBgrDataTest(bool create)
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyDataTest(create, DW, DH, View::Bgr24, FUNC_BGR(SimdNv12ToBgr));
+
+        return result;
+    }
+
+    bool Nv12ToBgraDataTest(bool create)
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyDataTest(create, DW, DH, View::Bgra32, FUNC_BGRA(SimdNv12ToBgra));
+
+        return result;
+    }
+}
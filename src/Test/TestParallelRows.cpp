@@ -0,0 +1,106 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    const size_t PARALLEL_ROWS_BANDS = 4;
+
+    template<class Func> bool ParallelRowsAutoTest(const String & description, const View & src, View::Format dstFormat, Func func)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << description << " in " << PARALLEL_ROWS_BANDS << " bands & in one band [" << src.width << ", " << src.height << "].");
+
+        View dst1(src.width, src.height, dstFormat, NULL, TEST_ALIGN(src.width));
+        View dst2(src.width, src.height, dstFormat, NULL, TEST_ALIGN(src.width));
+        Simd::Fill(dst1, 1);
+        Simd::Fill(dst2, 2);
+
+        size_t threadNumber = ::SimdGetThreadNumber();
+        ::SimdSetThreadNumber(PARALLEL_ROWS_BANDS);
+        {
+            TEST_PERFORMANCE_TEST(description + "<" + ToString(PARALLEL_ROWS_BANDS) + ">");
+            func(src, dst1);
+        }
+        ::SimdSetThreadNumber(1);
+        {
+            TEST_PERFORMANCE_TEST(description + "<1>");
+            func(src, dst2);
+        }
+        ::SimdSetThreadNumber(threadNumber);
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 0, description);
+
+        return result;
+    }
+
+    bool ParallelRowsAutoTest()
+    {
+        bool result = true;
+
+        const size_t width = 1280, height = 720;
+
+        View gray(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(gray);
+        View bgr(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        FillRandom(bgr);
+
+        result = result && ParallelRowsAutoTest("SimdGaussianBlur3x3", bgr, View::Bgr24, [](const View & src, View & dst)
+        {
+            ::SimdGaussianBlur3x3(src.data, src.stride, src.width, src.height, 3, dst.data, dst.stride);
+        });
+
+        result = result && ParallelRowsAutoTest("SimdMedianFilterSquare5x5", gray, View::Gray8, [](const View & src, View & dst)
+        {
+            ::SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, 1, dst.data, dst.stride);
+        });
+
+        result = result && ParallelRowsAutoTest("SimdSobelDx", gray, View::Int16, [](const View & src, View & dst)
+        {
+            ::SimdSobelDx(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+        });
+
+        result = result && ParallelRowsAutoTest("SimdBgrToGray", bgr, View::Gray8, [](const View & src, View & dst)
+        {
+            ::SimdBgrToGray(src.data, src.width, src.height, src.stride, dst.data, dst.stride);
+        });
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(u);
+        View v(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(v);
+
+        result = result && ParallelRowsAutoTest("SimdYuv420pToBgr", y, View::Bgr24, [&u, &v](const View & src, View & dst)
+        {
+            ::SimdYuv420pToBgr(src.data, src.stride, u.data, u.stride, v.data, v.stride, src.width, src.height, dst.data, dst.stride);
+        });
+
+        return result;
+    }
+}
@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdFrame.hpp"
+
 namespace Test
 {
     namespace
@@ -387,6 +389,90 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    typedef Simd::Pyramid<Simd::Allocator> Pyramid;
+    typedef Simd::Frame<Simd::Allocator> Frame;
+
+    String ToString(::SimdReduceType type, bool compensation)
+    {
+        const char * names[] = { "2x2", "3x3", "4x4", "5x5" };
+        return String("[") + names[type] + (compensation ? "-1]" : "-0]");
+    }
+
+    bool BuildPyramidAutoTest(size_t width, size_t height, size_t levels, ::SimdReduceType type, bool compensation)
+    {
+        bool result = true;
+
+        String desc = ToString(type, compensation);
+        TEST_LOG_SS(Info, "Test Simd::Build" << desc << " & Simd::ReduceGray" << desc << " [" << width << ", " << height << ", " << levels << "].");
+
+        Pyramid p1(width, height, levels), p2(width, height, levels);
+        FillRandom(p1[0]);
+        Simd::Copy(p1[0], p2[0]);
+
+        Simd::Build(p1, type, compensation);
+
+        for (size_t level = 1; level < levels; ++level)
+            Simd::ReduceGray(p2[level - 1], p2[level], type, compensation);
+
+        for (size_t level = 1; level < levels && result; ++level)
+            result = result && Compare(p1[level], p2[level], 0, true, 64, 0, String("level ") + ToString(level));
+
+        return result;
+    }
+
+    bool BuildPyramidAutoTest(size_t width, size_t height, Frame::Format format, ::SimdReduceType type)
+    {
+        bool result = true;
+
+        const size_t levels = 4;
+        String desc = ToString(type, true);
+        TEST_LOG_SS(Info, "Test Simd::Build(Frame)" << desc << " & Simd::Convert + Simd::Build" << desc << " [" << width << ", " << height << ", " << levels << "].");
+
+        Frame src(width, height, format);
+        for (size_t i = 0; i < src.PlaneCount(); ++i)
+            FillRandom(src.planes[i]);
+
+        Pyramid p1(width, height, levels), p2(width, height, levels);
+
+        Simd::Build(src, p1, type);
+
+        Simd::Convert(src, Frame(p2[0]).Ref());
+        for (size_t level = 1; level < levels; ++level)
+            Simd::ReduceGray(p2[level - 1], p2[level], type, true);
+
+        for (size_t level = 0; level < levels && result; ++level)
+            result = result && Compare(p1[level], p2[level], 0, true, 64, 0, String("level ") + ToString(level));
+
+        return result;
+    }
+
+    bool BuildPyramidAutoTest()
+    {
+        bool result = true;
+
+        for (int type = ::SimdReduce2x2; type <= ::SimdReduce5x5; ++type)
+        {
+            for (int c = 0; c <= 1; ++c)
+            {
+                result = result && BuildPyramidAutoTest(W, H, 5, (::SimdReduceType)type, c != 0);
+                result = result && BuildPyramidAutoTest(W + O, H - O, 6, (::SimdReduceType)type, c != 0);
+            }
+        }
+
+        result = result && BuildPyramidAutoTest(W, 9, 4, ::SimdReduce5x5, true);
+
+        const Frame::Format formats[] = { Frame::Nv12, Frame::Yuv420p, Frame::Bgra32, Frame::Bgr24, Frame::Gray8 };
+        for (size_t f = 0; f < 5; ++f)
+        {
+            result = result && BuildPyramidAutoTest(W, H, formats[f], ::SimdReduce2x2);
+            result = result && BuildPyramidAutoTest(W, H, formats[f], ::SimdReduce4x4);
+        }
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool ReduceColorDataTest(bool create, int width, int height, View::Format format, FuncRC f)
     {
         bool result = true;
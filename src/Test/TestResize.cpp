@@ -147,6 +147,10 @@ namespace Test
         case SimdResizeMethodBilinear: return "B";
         case SimdResizeMethodCaffeInterp: return "C";
         case SimdResizeMethodArea: return "A";
+        case SimdResizeMethodNearest: return "N";
+        case SimdResizeMethodBicubic: return "Bc";
+        case SimdResizeMethodLanczos3: return "L3";
+        case SimdResizeMethodBilinearAntiAlias: return "Ba";
         default: assert(0); return "";
         }
     }
@@ -157,6 +161,7 @@ namespace Test
         {
         case SimdResizeChannelByte:  return "b";
         case SimdResizeChannelFloat:  return "f";
+        case SimdResizeChannelShort:  return "s";
         default: assert(0); return "";
         }
     }
@@ -183,7 +188,7 @@ namespace Test
             void Call(const View & src, View & dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method) const
             {
                 void * resizer = NULL;
-                if(src.format == View::Float)
+                if(src.format == View::Float || src.format == View::Int16)
                     resizer = func(src.width / channels, src.height, dst.width / channels, dst.height, channels, type, method);
                 else
                     resizer = func(src.width, src.height, dst.width, dst.height, channels, type, method);
@@ -217,6 +222,12 @@ namespace Test
             srcW *= channels;
             dstW *= channels;
         }
+        else if (type == SimdResizeChannelShort)
+        {
+            format = View::Int16;
+            srcW *= channels;
+            dstW *= channels;
+        }
         else if (type == SimdResizeChannelByte)
         {
             switch (channels)
@@ -254,7 +265,7 @@ namespace Test
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, type, method));
 
         if (format == View::Float)
-            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
         else
             result = result && Compare(dst1, dst2, 0, true, 64);
 
@@ -308,6 +319,33 @@ namespace Test
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 2, f1, f2);
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 3, f1, f2);
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 4, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelFloat, 1, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelFloat, 3, f1, f2);
+        for (SimdResizeMethodType method = SimdResizeMethodBilinear; method <= SimdResizeMethodArea; method = SimdResizeMethodType(method + 1))
+        {
+            result = result && ResizerAutoTest(method, SimdResizeChannelShort, 1, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelShort, 2, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelShort, 3, f1, f2);
+        }
+        for (SimdResizeMethodType method = SimdResizeMethodNearest; method <= SimdResizeMethodLanczos3; method = SimdResizeMethodType(method + 1))
+        {
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 1, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 2, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 3, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 4, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelFloat, 1, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelFloat, 3, f1, f2);
+        }
+        for (SimdResizeMethodType method = SimdResizeMethodBicubic; method <= SimdResizeMethodLanczos3; method = SimdResizeMethodType(method + 1))
+        {
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 3, W, H, W / 3, H / 5, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelFloat, 1, W, H, W / 5, H / 3, f1, f2);
+        }
+        result = result && ResizerAutoTest(SimdResizeMethodBilinearAntiAlias, SimdResizeChannelFloat, 1, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodBilinearAntiAlias, SimdResizeChannelFloat, 3, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelFloat, 16, W / 16, H, W / 80, H / 7, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodBilinearAntiAlias, SimdResizeChannelFloat, 1, W, H, W / 5, H / 7, f1, f2);
+        result = result && ResizerAutoTest(SimdResizeMethodBilinearAntiAlias, SimdResizeChannelFloat, 16, W / 16, H, W / 80, H / 7, f1, f2);
 #endif
 
         return result;
@@ -369,6 +407,431 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        double ResizerFilterKernel(SimdResizeMethodType method, double x)
+        {
+            x = ::fabs(x);
+            if (method == SimdResizeMethodBicubic)
+            {
+                const double a = -0.75;
+                if (x < 1.0)
+                    return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+                if (x < 2.0)
+                    return ((a * x - 5.0 * a) * x + 8.0 * a) * x - 4.0 * a;
+                return 0.0;
+            }
+            if (x < 0.000001)
+                return 1.0;
+            if (x >= 3.0)
+                return 0.0;
+            double px = M_PI * x;
+            return 3.0 * ::sin(px) * ::sin(px / 3.0) / (px * px);
+        }
+
+        void ResizerFilterReference(SimdResizeMethodType method, size_t srcSize, size_t dstSize, std::vector<int> & index, std::vector<double> & weight, size_t & size)
+        {
+            double scale = double(srcSize) / dstSize, stretch = std::max(scale, 1.0);
+            double radius = (method == SimdResizeMethodBicubic ? 2.0 : 3.0) * stretch;
+            size = 2 * (size_t)::ceil(radius) + 1;
+            index.assign(dstSize * size, 0);
+            weight.assign(dstSize * size, 0.0);
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                double center = (i + 0.5) * scale - 0.5, sum = 0.0;
+                int beg = (int)::floor(center - radius);
+                for (size_t k = 0; k < size; ++k)
+                {
+                    index[i * size + k] = std::min(std::max(beg + (int)k, 0), (int)srcSize - 1);
+                    weight[i * size + k] = ResizerFilterKernel(method, (center - beg - (double)k) / stretch);
+                    sum += weight[i * size + k];
+                }
+                for (size_t k = 0; k < size; ++k)
+                    weight[i * size + k] /= sum;
+            }
+        }
+
+        void ResizerFilterReference(SimdResizeMethodType method, const View & src, View & dst)
+        {
+            size_t channels = src.format == View::Float ? 1 : src.ChannelCount();
+            size_t sizeX, sizeY;
+            std::vector<int> ix, iy;
+            std::vector<double> ax, ay;
+            ResizerFilterReference(method, src.width, dst.width, ix, ax, sizeX);
+            ResizerFilterReference(method, src.height, dst.height, iy, ay, sizeY);
+            std::vector<double> buf(src.height * dst.width * channels);
+            for (size_t y = 0; y < src.height; ++y)
+            {
+                for (size_t x = 0; x < dst.width; ++x)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        double sum = 0;
+                        for (size_t k = 0; k < sizeX; ++k)
+                        {
+                            size_t sx = ix[x * sizeX + k];
+                            sum += ax[x * sizeX + k] * (src.format == View::Float ? src.At<float>(sx, y) : src.data[y * src.stride + sx * channels + c]);
+                        }
+                        buf[(y * dst.width + x) * channels + c] = sum;
+                    }
+                }
+            }
+            for (size_t y = 0; y < dst.height; ++y)
+            {
+                for (size_t x = 0; x < dst.width; ++x)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        double sum = 0;
+                        for (size_t k = 0; k < sizeY; ++k)
+                            sum += ay[y * sizeY + k] * buf[(iy[y * sizeY + k] * dst.width + x) * channels + c];
+                        if (dst.format == View::Float)
+                            dst.At<float>(x, y) = float(sum);
+                        else
+                            dst.data[y * dst.stride + x * channels + c] = (uint8_t)std::min(std::max(::floor(sum + 0.5), 0.0), 255.0);
+                    }
+                }
+            }
+        }
+    }
+
+    bool ResizerFilterAutoTest(SimdResizeMethodType method, View::Format format, size_t srcW, size_t srcH, size_t dstW, size_t dstH, const FuncRS & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << "[" << ToString(method) << "] " << ColorDescription(format) 
+            << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "] with reference.");
+
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        size_t channels = format == View::Float ? 1 : src.ChannelCount();
+        for (size_t y = 0; y < srcH; ++y)
+        {
+            for (size_t x = 0; x < srcW; ++x)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    int value = ((x + y) & 1) ? 255 : 0;
+                    if (c == 1)
+                        value = int(x * 255 / (srcW - 1));
+                    if (c == 2)
+                        value = int((x / 3 + y / 5) % 2) * 200 + 20;
+                    if (format == View::Float)
+                        src.At<float>(x, y) = float(value);
+                    else
+                        src.data[y * src.stride + x * channels + c] = (uint8_t)value;
+                }
+            }
+        }
+
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+
+        ResizerFilterReference(method, src, dst1);
+        SimdResizeChannelType type = format == View::Float ? SimdResizeChannelFloat : SimdResizeChannelByte;
+        void * resizer = f.func(srcW, srcH, dstW, dstH, channels, type, method);
+        SimdResizerRun(resizer, src.data, src.stride, dst2.data, dst2.stride);
+        SimdRelease(resizer);
+
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool ResizerFilterAutoTest(const FuncRS & f)
+    {
+        bool result = true;
+
+        for (SimdResizeMethodType method = SimdResizeMethodBicubic; method <= SimdResizeMethodLanczos3; method = SimdResizeMethodType(method + 1))
+        {
+            result = result && ResizerFilterAutoTest(method, View::Bgr24, 300, 200, 100, 40, f);
+            result = result && ResizerFilterAutoTest(method, View::Bgr24, 60, 40, 150, 90, f);
+            result = result && ResizerFilterAutoTest(method, View::Gray8, 256, 256, 37, 71, f);
+            result = result && ResizerFilterAutoTest(method, View::Float, 300, 200, 70, 50, f);
+            result = result && ResizerFilterAutoTest(method, View::Float, 60, 40, 150, 90, f);
+        }
+
+        return result;
+    }
+
+    bool ResizerFilterAutoTest()
+    {
+        bool result = true;
+
+        result = result && ResizerFilterAutoTest(FUNC_RS(Simd::Base::ResizerInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && ResizerFilterAutoTest(FUNC_RS(Simd::Sse2::ResizerInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ResizerFilterAutoTest(FUNC_RS(Simd::Avx2::ResizerInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && ResizerFilterAutoTest(FUNC_RS(Simd::Avx512bw::ResizerInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && ResizerFilterAutoTest(FUNC_RS(Simd::Neon::ResizerInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool ResizerCacheAutoTest(View::Format format, SimdResizeMethodType method, Simd::ResizerCache & cache)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::ResizerCache" << ColorDescription(format) << "[" << ToString(method) << "].");
+
+        const int sizes[][4] = { { W, H, W / 3, H / 3 }, { W / 3, H / 3, W, H }, { W + O, H - O, W - O, H + O }, { W, H, W / 3, H / 3 }, { W / 3, H / 3, W, H } };
+        SimdResizeChannelType type = format == View::Float ? SimdResizeChannelFloat : (format == View::Int16 ? SimdResizeChannelShort : SimdResizeChannelByte);
+        size_t channels = View::ChannelCount(format);
+        for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]) && result; ++i)
+        {
+            View src(sizes[i][0], sizes[i][1], format, NULL, TEST_ALIGN(sizes[i][0]));
+            if (format == View::Float)
+                FillRandom32f(src);
+            else
+                FillRandom(src);
+            View dst1(sizes[i][2], sizes[i][3], format, NULL, TEST_ALIGN(sizes[i][2]));
+            View dst2(sizes[i][2], sizes[i][3], format, NULL, TEST_ALIGN(sizes[i][2]));
+
+            void * resizer = SimdResizerInit(src.width, src.height, dst1.width, dst1.height, channels, type, method);
+            SimdResizerRun(resizer, src.data, src.stride, dst1.data, dst1.stride);
+            SimdRelease(resizer);
+
+            void * cached = cache.Get(src.width, src.height, dst2.width, dst2.height, channels, type, method);
+            result = result && cached == cache.Get(src.width, src.height, dst2.width, dst2.height, channels, type, method);
+            SimdResizerRun(cached, src.data, src.stride, dst2.data, dst2.stride);
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+            Simd::Fill(dst2, 0);
+            Simd::Resize(src, dst2, method);
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+            if (method == SimdResizeMethodBilinear && type == SimdResizeChannelByte)
+            {
+                SimdResizeBilinear(src.data, src.width, src.height, src.stride, dst1.data, dst1.width, dst1.height, dst1.stride, channels);
+                Simd::Fill(dst2, 0);
+                Simd::ResizeBilinear(src, dst2);
+                result = result && Compare(dst1, dst2, 0, true, 64);
+            }
+        }
+
+        return result;
+    }
+
+    bool ResizerCacheAutoTest()
+    {
+        bool result = true;
+
+        Simd::ResizerCache cache(2);
+
+        result = result && ResizerCacheAutoTest(View::Gray8, SimdResizeMethodBilinear, cache);
+        result = result && ResizerCacheAutoTest(View::Bgr24, SimdResizeMethodBilinear, cache);
+        result = result && ResizerCacheAutoTest(View::Bgra32, SimdResizeMethodArea, cache);
+        result = result && ResizerCacheAutoTest(View::Float, SimdResizeMethodBilinear, cache);
+        result = result && ResizerCacheAutoTest(View::Float, SimdResizeMethodArea, cache);
+        result = result && ResizerCacheAutoTest(View::Int16, SimdResizeMethodArea, cache);
+        result = result && ResizerCacheAutoTest(View::Bgr24, SimdResizeMethodBicubic, cache);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRSS
+        {
+            typedef void*(*FuncPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+            FuncPtr func;
+            String description;
+
+            FuncRSS(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdResizeMethodType m, SimdResizeChannelType t, size_t c, size_t s)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << ToString(m) << "-" << ToString(t) << "-" << c << "-" << s << "]";
+                description = ss.str();
+            }
+
+            size_t Call(const View & src, View & dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, size_t stripe) const
+            {
+                size_t done = 0;
+                void * resizer = NULL;
+                if (src.format == View::Float)
+                    resizer = func(src.width / channels, src.height, dst.width / channels, dst.height, channels, type, method);
+                else
+                    resizer = func(src.width, src.height, dst.width, dst.height, channels, type, method);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    for (size_t row = 0; row < src.height; row += stripe)
+                    {
+                        size_t rows = Simd::Min(stripe, src.height - row);
+                        done += SimdResizerStreamRun(resizer, src.data + row * src.stride, src.stride, rows, dst.data + done * dst.stride, dst.stride);
+                    }
+                }
+                SimdRelease(resizer);
+                return done;
+            }
+        };
+    }
+
+#define FUNC_RSS(function) \
+    FuncRSS(function, std::string(#function))
+
+    bool ResizerStreamAutoTest(SimdResizeMethodType method, SimdResizeChannelType type, size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t stripe, FuncRSS f1, FuncRSS f2)
+    {
+        bool result = true;
+
+        f1.Update(method, type, channels, stripe);
+        f2.Update(method, type, channels, srcH);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        View::Format format = View::Float;
+        if (type == SimdResizeChannelFloat)
+        {
+            srcW *= channels;
+            dstW *= channels;
+        }
+        else
+        {
+            switch (channels)
+            {
+            case 1: format = View::Gray8; break;
+            case 2: format = View::Uv16; break;
+            case 3: format = View::Bgr24; break;
+            case 4: format = View::Bgra32; break;
+            default:
+                assert(0);
+            }
+        }
+
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        if (format == View::Float)
+            FillRandom32f(src);
+        else
+            FillRandom(src);
+
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst3(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+
+        size_t done1 = 0, done2 = 0;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(done1 = f1.Call(src, dst1, channels, type, method, stripe));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(done2 = f2.Call(src, dst2, channels, type, method, srcH));
+
+        if (done1 != dstH || done2 != dstH)
+        {
+            TEST_LOG_SS(Error, "Wrong number of output rows: " << done1 << " and " << done2 << " instead of " << dstH << " !");
+            return false;
+        }
+
+        size_t divider = format == View::Float ? channels : 1;
+        void * resizer = SimdResizerInit(srcW / divider, srcH, dstW / divider, dstH, channels, type, method);
+        SimdResizerRun(resizer, src.data, src.stride, dst3.data, dst3.stride);
+        SimdRelease(resizer);
+
+        if (format == View::Float)
+        {
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+            result = result && Compare(dst1, dst3, EPS, true, 64, DifferenceBoth, "whole");
+        }
+        else
+        {
+            result = result && Compare(dst1, dst2, 0, true, 64);
+            // ResizerByteBilinear rounds weights to 1/16: up to 255/32 per axis plus final rounding.
+            int differenceMax = method == SimdResizeMethodBilinear ? 17 : 0;
+            result = result && Compare(dst1, dst3, differenceMax, true, 64, 0, "whole");
+        }
+
+        return result;
+    }
+
+    bool ResizerStreamAutoTest(const FuncRSS & f1, const FuncRSS & f2)
+    {
+        bool result = true;
+
+        const SimdResizeMethodType methods[] = { SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodLanczos3 };
+        for (size_t m = 0; m < 3; ++m)
+        {
+            for (size_t c = 1; c <= 4; c++)
+            {
+                result = result && ResizerStreamAutoTest(methods[m], SimdResizeChannelByte, c, W, H, W / 3, H / 3, 16, f1, f2);
+                result = result && ResizerStreamAutoTest(methods[m], SimdResizeChannelByte, c, W / 3, H / 3, W - O, H + O, 7, f1, f2);
+            }
+            result = result && ResizerStreamAutoTest(methods[m], SimdResizeChannelFloat, 1, W, H, W / 3, H / 3, 64, f1, f2);
+            result = result && ResizerStreamAutoTest(methods[m], SimdResizeChannelFloat, 3, W / 3, H / 3, W - O, H + O, 5, f1, f2);
+        }
+        result = result && ResizerStreamAutoTest(SimdResizeMethodBilinearAntiAlias, SimdResizeChannelFloat, 1, W, H, W / 5, H / 7, 32, f1, f2);
+        result = result && ResizerStreamAutoTest(SimdResizeMethodBilinearAntiAlias, SimdResizeChannelFloat, 3, W / 3, H / 3, W - O, H + O, 5, f1, f2);
+
+        return result;
+    }
+
+    bool ResizerStreamAutoTest()
+    {
+        bool result = true;
+
+        result = result && ResizerStreamAutoTest(FUNC_RSS(Simd::Base::ResizerStreamInit), FUNC_RSS(SimdResizerStreamInit));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && ResizerStreamAutoTest(FUNC_RSS(Simd::Sse::ResizerStreamInit), FUNC_RSS(SimdResizerStreamInit));
+#endif 
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && ResizerStreamAutoTest(FUNC_RSS(Simd::Sse2::ResizerStreamInit), FUNC_RSS(SimdResizerStreamInit));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && ResizerStreamAutoTest(FUNC_RSS(Simd::Avx::ResizerStreamInit), FUNC_RSS(SimdResizerStreamInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ResizerStreamAutoTest(FUNC_RSS(Simd::Avx2::ResizerStreamInit), FUNC_RSS(SimdResizerStreamInit));
+#endif 
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && ResizerStreamAutoTest(FUNC_RSS(Simd::Avx512f::ResizerStreamInit), FUNC_RSS(SimdResizerStreamInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && ResizerStreamAutoTest(FUNC_RSS(Simd::Avx512bw::ResizerStreamInit), FUNC_RSS(SimdResizerStreamInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && ResizerStreamAutoTest(FUNC_RSS(Simd::Neon::ResizerStreamInit), FUNC_RSS(SimdResizerStreamInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool ResizeDataTest(bool create, int width, int height, View::Format format, const FuncRB & f)
     {
         bool result = true;
@@ -0,0 +1,164 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestSynetConvolutionParam.h"
+
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdRuntime.h"
+
+#include <fstream>
+
+namespace Test
+{
+    namespace
+    {
+        typedef Test::SynetConvolutionParam<false> Param;
+
+        struct FuncC
+        {
+            typedef void*(*FuncPtr)(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
+
+            FuncPtr func;
+            String description;
+
+            FuncC(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(const Param & p)
+            {
+                description = description + p.Decription();
+            }
+
+            void Call(const Param & p, const Tensor32f & weight, const Tensor32f & bias, const Tensor32f & src, Tensor32f & buf, Tensor32f & dst) const
+            {
+                void * context = func(p.batch, &p.conv, NULL);
+                buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context) });
+                ::SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), NULL);
+                for (size_t i = 0; i < 16; ++i)
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    ::SimdSynetConvolution32fForward(context, src.Data(), buf.Data(), dst.Data());
+                }
+                ::SimdRelease(context);
+            }
+        };
+
+        String ReadFile(const String & path)
+        {
+            std::ifstream ifs(path.c_str());
+            std::stringstream ss;
+            ss << ifs.rdbuf();
+            return ss.str();
+        }
+    }
+
+#define FUNC_C(function) \
+    FuncC(function, std::string(#function))
+
+    bool RuntimeCacheAutoTest(const Param & p, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test SimdRuntimeCache [" << f1.description << " & " << f2.description << "].");
+
+        const String path = TemporaryPath("SimdRuntimeCache.txt");
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src({ p.batch, c.srcH, c.srcW, c.srcC }), buf;
+        Tensor32f weight({ c.kernelY, c.kernelX, c.srcC, c.dstC }), bias({ c.dstC });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        Tensor32f dst1({ p.batch, c.dstH, c.dstW, c.dstC }), dst2({ p.batch, c.dstH, c.dstW, c.dstC });
+
+        f1.Call(p, weight, bias, src, buf, dst1);
+        f2.Call(p, weight, bias, src, buf, dst2);
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        if (::SimdRuntimeCacheSave(path.c_str()) != SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't save runtime cache to '" << path << "'!");
+            return false;
+        }
+        String saved = ReadFile(path);
+        if (saved.find('\t') == String::npos)
+        {
+            TEST_LOG_SS(Error, "Runtime cache is empty after measurement!");
+            result = false;
+        }
+
+        ::SimdRuntimeCacheClear();
+        result = result && ::SimdRuntimeCacheSave(path.c_str()) == SimdTrue;
+        String cleared = ReadFile(path);
+        if (cleared.empty() || cleared.find('\t') != String::npos)
+        {
+            TEST_LOG_SS(Error, "Runtime cache is not cleared!");
+            result = false;
+        }
+
+        std::ofstream(path.c_str()) << saved;
+        result = result && ::SimdRuntimeCacheLoad(path.c_str()) == SimdTrue;
+        result = result && ::SimdRuntimeCacheSave(path.c_str()) == SimdTrue;
+        if (ReadFile(path) != saved)
+        {
+            TEST_LOG_SS(Error, "Loaded runtime cache is not equal to saved one!");
+            result = false;
+        }
+
+        size_t updates = Simd::RuntimeCache::Global().Updates();
+        f2.Call(p, weight, bias, src, buf, dst2);
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        if (Simd::RuntimeCache::Global().Updates() != updates)
+        {
+            TEST_LOG_SS(Error, "Choices of loaded runtime cache are measured again!");
+            result = false;
+        }
+
+        std::ofstream(path.c_str()) << "Wrong file format" << std::endl;
+        if (::SimdRuntimeCacheLoad(path.c_str()) != SimdFalse)
+        {
+            TEST_LOG_SS(Error, "Runtime cache loads file with wrong format!");
+            result = false;
+        }
+
+        ::remove(path.c_str());
+
+        return result;
+    }
+
+    bool RuntimeCacheAutoTest()
+    {
+        bool result = true;
+
+        Size _1(1, 1), _3(3, 3);
+
+        result = result && RuntimeCacheAutoTest(Param(1, 64, 16, 16, 64, _3, _1, _1, _1, _1, 1, ::SimdConvolutionActivationRelu, ::SimdTrue),
+            FUNC_C(Simd::Base::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
+
+        return result;
+    }
+}
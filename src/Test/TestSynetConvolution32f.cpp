@@ -28,6 +28,7 @@
 #include "Test/TestSynetConvolutionParam.h"
 
 #include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdBase.h"
 
 namespace Test
 {
@@ -60,12 +61,36 @@ namespace Test
                 }
                 ::SimdRelease(context);
             }
+
+            void CallEpilogue(const Param & p, const Tensor32f & weight, const Tensor32f & bias, const Tensor32f & params, const Tensor32f & scale, const Tensor32f & shift,
+                SimdBool pool, SimdBool add, const Tensor32f & src, Tensor32f & buf, const Tensor32f & init, Tensor32f & dst) const
+            {
+                void * context = func(p.batch, &p.conv, NULL);
+                ::SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), params.Data());
+                ::SimdSynetConvolution32fSetEpilogue(context, scale.Data(), shift.Data(), pool, add);
+                buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context) });
+                memcpy(dst.Data(), init.Data(), init.Size() * sizeof(float));
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    ::SimdSynetConvolution32fForward(context, src.Data(), buf.Data(), dst.Data());
+                }
+                ::SimdRelease(context);
+            }
         };
     }
 
 #define FUNC_C(function) \
     FuncC(function, std::string(#function))
 
+    void * SynetConvolution32fInitTuned(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+    {
+        SimdBool tuning = ::SimdGetTuningMode();
+        ::SimdSetTuningMode(SimdTrue);
+        void * context = ::SimdSynetConvolution32fInit(batch, conv, gemm);
+        ::SimdSetTuningMode(tuning);
+        return context;
+    }
+
     bool SynetConvolution32fForwardAutoTest(float eps, const Param & p, FuncC f1, FuncC f2)
     {
         bool result = true;
@@ -418,6 +443,8 @@ namespace Test
         //result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 120, 12, 12, 120, _3, _1, _1, _1, _1, 1, a, t), f1, f2);
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 768, 10, 4, 128, _1, _1, _1, _0, _0, 1, a, t), f1, f2);
         result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 3, 240, 135, 27, _3, _1, _1, _0, _0, 1, a, t), f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(4, 32, 28, 28, 32, _3, _1, _1, _1, _1, 1, a, t), f1, f2);
+        result = result && SynetConvolution32fForwardAutoTest(eps, Param(4, 64, 28, 28, 64, _3, _1, _2, _1, _1, 64, a, t), f1, f2);
 #endif
 #else
         //result = result && SynetConvolution32fForwardAutoTest(eps, Param(1, 120, 12, 12, 120, _3, _1, _1, _1, _1, 1, a, t), f1, f2);
@@ -426,6 +453,83 @@ namespace Test
         return result;
     }
 
+    bool SynetConvolution32fEpilogueAutoTest(float eps, const Param & p, SimdBool pool, SimdBool add, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+        f2.description = f2.description + "[" + (pool ? "p" : "") + (add ? "a" : "") + "]";
+
+        TEST_LOG_SS(Info, "Test epilogue " << f1.description << " & " << f2.description << "].");
+
+        const SimdConvolutionParameters & c = p.conv;
+        size_t poolH = pool ? (c.dstH + 1) / 2 : c.dstH, poolW = pool ? (c.dstW + 1) / 2 : c.dstW;
+        SimdTensorFormatType format = p.trans ? SimdTensorFormatNhwc : SimdTensorFormatNchw;
+
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC }), params({ c.dstC }), scale({ c.dstC }), shift({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        FillRandom(scale.Data(), scale.Size(), -2.0, 2.0f);
+        FillRandom(shift.Data(), shift.Size(), -1.0, 1.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f buf;
+        Tensor32f conv({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f init({ p.batch, p.trans ? poolH : c.dstC, p.trans ? poolW : poolH, p.trans ? c.dstC : poolW });
+        Tensor32f dst1(init.Shape()), dst2(init.Shape());
+        FillRandom(init.Data(), init.Size(), -1.0, 1.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, weight, bias, params, src, buf, conv));
+
+        size_t sizeC = c.dstC * c.dstH * c.dstW, sizeE = c.dstC * poolH * poolW;
+        for (size_t b = 0; b < p.batch; ++b)
+        {
+            float * pc = conv.Data() + b * sizeC, * pd = dst1.Data() + b * sizeE;
+            ::SimdSynetScaleLayerForward(pc, scale.Data(), shift.Data(), c.dstC, c.dstH * c.dstW, pc, format);
+            if (pool)
+                Simd::Base::SynetPoolingForwardMax(pc, c.dstC, c.dstH, c.dstW, 2, 2, 2, 2, 0, 0, pd, poolH, poolW, p.trans);
+            else
+                memcpy(pd, pc, sizeC * sizeof(float));
+            for (size_t i = 0; i < sizeE && add; ++i)
+                pd[i] += init.Data()[b * sizeE + i];
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.CallEpilogue(p, weight, bias, params, scale, shift, pool, add, src, buf, init, dst2));
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution32fEpilogueAutoTest(float eps, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        ::SimdConvolutionActivationType a = ::SimdConvolutionActivationRelu;
+
+        result = result && SynetConvolution32fEpilogueAutoTest(eps, Param(1, 32, 38, 37, 32, _3, _1, _1, _1, _1, 1, a, SimdTrue), SimdFalse, SimdFalse, f1, f2);
+        result = result && SynetConvolution32fEpilogueAutoTest(eps, Param(1, 32, 38, 37, 32, _3, _1, _1, _1, _1, 1, a, SimdTrue), SimdTrue, SimdFalse, f1, f2);
+        result = result && SynetConvolution32fEpilogueAutoTest(eps, Param(2, 64, 19, 16, 48, _1, _1, _1, _0, _0, 1, a, SimdTrue), SimdFalse, SimdTrue, f1, f2);
+        result = result && SynetConvolution32fEpilogueAutoTest(eps, Param(2, 16, 75, 75, 24, _3, _1, _1, _1, _1, 1, a, SimdTrue), SimdTrue, SimdTrue, f1, f2);
+        result = result && SynetConvolution32fEpilogueAutoTest(eps, Param(1, 64, 19, 19, 64, _3, _1, _2, _1, _1, 64, a, SimdTrue), SimdTrue, SimdTrue, f1, f2);
+        result = result && SynetConvolution32fEpilogueAutoTest(eps, Param(1, 32, 38, 37, 32, _3, _1, _1, _1, _1, 1, a, SimdFalse), SimdFalse, SimdFalse, f1, f2);
+        result = result && SynetConvolution32fEpilogueAutoTest(eps, Param(2, 16, 29, 31, 24, _3, _1, _1, _1, _1, 1, a, SimdFalse), SimdTrue, SimdTrue, f1, f2);
+
+        return result;
+    }
+
     bool SynetConvolution32fForwardAutoTest(float eps, const FuncC & f1, const FuncC & f2)
     {
         bool result = true;
@@ -473,6 +577,14 @@ namespace Test
             result = result && SynetConvolution32fForwardAutoTest(2 * EPS, FUNC_C(Simd::Neon::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
 #endif
 
+        result = result && SynetConvolution32fEpilogueAutoTest(2 * EPS, FUNC_C(Simd::Base::SynetConvolution32fInit), FUNC_C(Simd::Base::SynetConvolution32fInit));
+        result = result && SynetConvolution32fEpilogueAutoTest(2 * EPS, FUNC_C(Simd::Base::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
+
+        ::SimdRuntimeCacheClear();
+        result = result && SynetConvolution32fForwardAutoTest(2 * EPS, FUNC_C(SimdSynetConvolution32fInit), FuncC(SynetConvolution32fInitTuned, "SimdSynetConvolution32fInit-tuned"));
+        result = result && SynetConvolution32fEpilogueAutoTest(2 * EPS, FUNC_C(SimdSynetConvolution32fInit), FuncC(SynetConvolution32fInitTuned, "SimdSynetConvolution32fInit-tuned"));
+        ::SimdRuntimeCacheClear();
+
         return result;
     }
 }
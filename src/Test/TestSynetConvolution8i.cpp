@@ -0,0 +1,277 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+#include "Test/TestTensor.h"
+#include "Test/TestSynetConvolutionParam.h"
+
+#include "Simd/SimdSynetConvolution8i.h"
+
+namespace Test
+{
+    namespace
+    {
+        typedef Test::SynetConvolutionParam<false> Param;
+
+        struct FuncC
+        {
+            typedef void*(*FuncPtr)(size_t batch, const SimdConvolutionParameters * conv);
+
+            FuncPtr func;
+            String description;
+
+            FuncC(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(const Param & p)
+            {
+                const SimdConvolutionParameters & c = p.conv;
+                description = description + p.Decription() + "[" + (c.srcT == SimdTensorData8u ? "u8" : "f32") + "-" + (c.dstT == SimdTensorData8u ? "u8" : "f32") + "]";
+            }
+
+            void Call(const Param & p, const Tensor32f & weight, const Tensor32f & bias, const Tensor32f & params, const float * const * stats, const uint8_t * src, Tensor8u & buf, uint8_t * dst) const
+            {
+                void * context = func(p.batch, &p.conv);
+                buf.Extend({ ::SimdSynetConvolution8iExternalBufferSize(context) });
+                ::SimdSynetConvolution8iSetParams(context, weight.Data(), bias.Data(), params.Data(), stats);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    ::SimdSynetConvolution8iForward(context, src, buf.Data(), dst);
+                }
+                ::SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_C(function) \
+    FuncC(function, std::string(#function))
+
+    bool SynetConvolution8iForwardAutoTest(float eps, const Param & p, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << "].");
+
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src32f, dst32f1, dst32f2;
+        Tensor8u src8u, dst8u1, dst8u2;
+        if (c.srcT == SimdTensorData32f)
+        {
+            src32f.Reshape({ p.batch, c.srcH, c.srcW, c.srcC });
+            FillRandom(src32f.Data(), src32f.Size(), -1.0, 1.0f);
+        }
+        else
+        {
+            src8u.Reshape({ p.batch, c.srcH, c.srcW, c.srcC });
+            View view(src8u.Size(), 1, src8u.Size(), View::Gray8, src8u.Data());
+            FillRandom(view);
+        }
+
+        Tensor32f weight({ c.kernelY, c.kernelX, c.srcC / c.group, c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
+        FillRandom(srcMin.Data(), srcMin.Size(), -1.0f, -0.5f);
+        FillRandom(srcMax.Data(), srcMax.Size(), 0.5f, 1.0f);
+        FillRandom(dstMin.Data(), dstMin.Size(), -4.0f, -1.0f);
+        FillRandom(dstMax.Data(), dstMax.Size(), 1.0f, 4.0f);
+        const float * stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+
+        Tensor8u buf;
+
+        if (c.dstT == SimdTensorData32f)
+        {
+            dst32f1.Reshape({ p.batch, c.dstH, c.dstW, c.dstC }, SimdTensorFormatNhwc, 1.0f);
+            dst32f2.Reshape({ p.batch, c.dstH, c.dstW, c.dstC }, SimdTensorFormatNhwc, 2.0f);
+        }
+        else
+        {
+            dst8u1.Reshape({ p.batch, c.dstH, c.dstW, c.dstC }, SimdTensorFormatNhwc, 1);
+            dst8u2.Reshape({ p.batch, c.dstH, c.dstW, c.dstC }, SimdTensorFormatNhwc, 2);
+        }
+
+        const uint8_t * src = c.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : src8u.Data();
+        uint8_t * dst1 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : dst8u1.Data();
+        uint8_t * dst2 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : dst8u2.Data();
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, weight, bias, params, stats, src, buf, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, weight, bias, params, stats, src, buf, dst2));
+
+        if (c.dstT == SimdTensorData32f)
+            result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+        else
+        {
+            View view1(dst8u1.Size(), 1, dst8u1.Size(), View::Gray8, dst8u1.Data());
+            View view2(dst8u2.Size(), 1, dst8u2.Size(), View::Gray8, dst8u2.Data());
+            result = result && Compare(view1, view2, 1, true, 64);
+        }
+
+        return result;
+    }
+
+    bool SynetConvolution8iForwardAutoTest(float eps, ::SimdConvolutionActivationType a, SimdTensorDataType s, SimdTensorDataType d, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        ::SimdBool t = ::SimdTrue;
+
+        std::vector<Param> params;
+#ifdef NDEBUG
+        params.push_back(Param(1, 32, 40, 32, 64, _3, _1, _1, _1, _1, 1, a, t));
+        params.push_back(Param(1, 64, 20, 16, 128, _1, _1, _1, _0, _0, 1, a, t));
+        params.push_back(Param(1, 3, 64, 48, 16, _3, _1, _2, _1, _1, 1, a, t));
+        params.push_back(Param(2, 24, 12, 10, 20, _3, _1, _1, _1, _1, 2, a, t));
+        params.push_back(Param(1, 32, 19, 16, 32, _3, _1, _1, _1, _1, 32, a, t));
+#else
+        params.push_back(Param(1, 32, 10, 8, 24, _3, _1, _1, _1, _1, 1, a, t));
+        params.push_back(Param(1, 3, 9, 7, 5, _3, _1, _2, _0, _1, 1, a, t));
+        params.push_back(Param(1, 16, 9, 7, 16, _3, _1, _1, _1, _1, 16, a, t));
+#endif
+        for (size_t i = 0; i < params.size(); ++i)
+        {
+            params[i].conv.srcT = s;
+            params[i].conv.dstT = d;
+            result = result && SynetConvolution8iForwardAutoTest(eps, params[i], f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SynetConvolution8iForwardAutoTest(float eps, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        result = result && SynetConvolution8iForwardAutoTest(eps, ::SimdConvolutionActivationRelu, SimdTensorData8u, SimdTensorData8u, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(eps, ::SimdConvolutionActivationPrelu, SimdTensorData32f, SimdTensorData32f, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(eps, ::SimdConvolutionActivationRestrictRange, SimdTensorData8u, SimdTensorData32f, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(eps, ::SimdConvolutionActivationElu, SimdTensorData32f, SimdTensorData8u, f1, f2);
+
+        return result;
+    }
+
+    bool SynetConvolution8iReferenceAutoTest(float eps, const Param & p, FuncC f)
+    {
+        bool result = true;
+
+        f.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " & FP32 reference].");
+
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src({ p.batch, c.srcH, c.srcW, c.srcC });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ c.kernelY, c.kernelX, c.srcC / c.group, c.dstC });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+
+        Tensor32f srcMin({ c.srcC }, SimdTensorFormatUnknown, -1.0f), srcMax({ c.srcC }, SimdTensorFormatUnknown, 1.0f);
+        const float * stats[4] = { srcMin.Data(), srcMax.Data(), NULL, NULL };
+
+        Tensor32f dst1({ p.batch, c.dstH, c.dstW, c.dstC }, SimdTensorFormatNhwc, 1.0f);
+        Tensor32f dst2({ p.batch, c.dstH, c.dstW, c.dstC }, SimdTensorFormatNhwc, 2.0f);
+        Tensor8u buf;
+
+        f.Call(p, weight, bias, params, stats, (uint8_t*)src.Data(), buf, (uint8_t*)dst1.Data());
+
+        void * context = ::SimdSynetConvolution32fInit(p.batch, &c, NULL);
+        Tensor32f buf32f({ ::SimdSynetConvolution32fExternalBufferSize(context) });
+        ::SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fForward(context, src.Data(), buf32f.Data(), dst2.Data());
+        ::SimdRelease(context);
+
+        float tolerance = eps * ::sqrt(float(c.kernelY * c.kernelX * c.srcC / c.group));
+        result = result && Compare(dst1, dst2, tolerance, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetConvolution8iReferenceAutoTest(float eps, const FuncC & f)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        ::SimdBool t = ::SimdTrue;
+        ::SimdConvolutionActivationType a = ::SimdConvolutionActivationIdentity;
+
+        std::vector<Param> params;
+        params.push_back(Param(1, 32, 10, 8, 24, _3, _1, _1, _1, _1, 1, a, t));
+        params.push_back(Param(1, 64, 8, 8, 32, _1, _1, _1, _0, _0, 1, a, t));
+        params.push_back(Param(1, 3, 9, 7, 5, _3, _1, _2, _0, _1, 1, a, t));
+        params.push_back(Param(2, 24, 12, 10, 20, _3, _1, _1, _1, _1, 2, a, t));
+        params.push_back(Param(1, 16, 9, 7, 16, _3, _1, _1, _1, _1, 16, a, t));
+        for (size_t i = 0; i < params.size(); ++i)
+            result = result && SynetConvolution8iReferenceAutoTest(eps, params[i], f);
+
+        return result;
+    }
+
+    bool SynetConvolution8iForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution8iReferenceAutoTest(0.015f, FUNC_C(Simd::Base::SynetConvolution8iInit));
+        result = result && SynetConvolution8iReferenceAutoTest(0.015f, FUNC_C(SimdSynetConvolution8iInit));
+
+        result = result && SynetConvolution8iForwardAutoTest(EPS, FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(SimdSynetConvolution8iInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution8iForwardAutoTest(EPS, FUNC_C(Simd::Avx2::SynetConvolution8iInit), FUNC_C(SimdSynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetConvolution8iForwardAutoTest(EPS, FUNC_C(Simd::Avx512bw::SynetConvolution8iInit), FUNC_C(SimdSynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution8iForwardAutoTest(EPS, FUNC_C(Simd::Neon::SynetConvolution8iInit), FUNC_C(SimdSynetConvolution8iInit));
+#endif
+
+        return result;
+    }
+}
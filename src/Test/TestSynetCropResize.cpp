@@ -0,0 +1,215 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdSynetImageToTensor.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncCR
+        {
+            typedef void*(*FuncPtr)(size_t channels, size_t dstWidth, size_t dstHeight, SimdTensorFormatType dstFormat, SimdTensorDataType dstType, SimdBool keepAspect, const float * mean, const float * scale);
+
+            FuncPtr func;
+            String description;
+
+            FuncCR(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t channels, SimdTensorFormatType format, SimdTensorDataType type, SimdBool keepAspect)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels << "-" << (format == SimdTensorFormatNchw ? "nchw" : "nhwc") << "-";
+                ss << (type == SimdTensorData32f ? "32f" : "8u") << (keepAspect ? "-ka" : "") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, const std::vector<ptrdiff_t> & rois, size_t channels, size_t width, size_t height, 
+                SimdTensorFormatType format, SimdBool keepAspect, const float * mean, const float * scale, View & dst) const
+            {
+                SimdTensorDataType type = dst.format == View::Float ? SimdTensorData32f : SimdTensorData8u;
+                void * context = func(channels, width, height, format, type, keepAspect, mean, scale);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    ::SimdSynetCropResizeRun(context, src.data, src.stride, src.width, src.height, rois.data(), rois.size() / 4, dst.data);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_CR(function) \
+    FuncCR(function, std::string(#function))
+
+    static void SynetCropResizeReference(const View & src, const std::vector<ptrdiff_t> & rois, size_t channels, size_t width, size_t height,
+        SimdTensorFormatType format, SimdBool keepAspect, const float * mean, const float * scale, View & dst)
+    {
+        bool nhwc = format == SimdTensorFormatNhwc, float32 = dst.format == View::Float;
+        Simd::Fill(dst, 0);
+        for (size_t i = 0; i < rois.size() / 4; ++i)
+        {
+            ptrdiff_t left = Simd::RestrictRange<ptrdiff_t>(rois[i * 4 + 0], 0, src.width);
+            ptrdiff_t top = Simd::RestrictRange<ptrdiff_t>(rois[i * 4 + 1], 0, src.height);
+            ptrdiff_t right = Simd::RestrictRange<ptrdiff_t>(rois[i * 4 + 2], left, src.width);
+            ptrdiff_t bottom = Simd::RestrictRange<ptrdiff_t>(rois[i * 4 + 3], top, src.height);
+            size_t roiW = right - left, roiH = bottom - top, dstW = width, dstH = height;
+            if (roiW == 0 || roiH == 0)
+                continue;
+            if (keepAspect)
+            {
+                float k = Simd::Min(float(width) / roiW, float(height) / roiH);
+                dstW = Simd::RestrictRange<size_t>(Simd::Round(roiW * k), 1, width);
+                dstH = Simd::RestrictRange<size_t>(Simd::Round(roiH * k), 1, height);
+            }
+            size_t dstX = (width - dstW) / 2, dstY = (height - dstH) / 2;
+            // the resizer can't handle images with width or height equal to 1, so the edge pixel is replicated.
+            size_t origW = Simd::Max<size_t>(roiW, 2), origH = Simd::Max<size_t>(roiH, 2);
+            View original(origW * channels, origH, View::Float), resized(dstW * channels, dstH, View::Float);
+            for (size_t y = 0; y < origH; ++y)
+                for (size_t x = 0; x < origW; ++x)
+                    for (size_t c = 0; c < channels; ++c)
+                        original.At<float>(x * channels + c, y) = src.At<uint8_t>((left + Simd::Min(x, roiW - 1)) * channels + c, top + Simd::Min(y, roiH - 1));
+            void * resizer = SimdResizerInit(origW, origH, dstW, dstH, channels, SimdResizeChannelFloat, SimdResizeMethodBilinear);
+            SimdResizerRun(resizer, original.data, original.stride, resized.data, resized.stride);
+            SimdRelease(resizer);
+            for (size_t y = 0; y < dstH; ++y)
+            {
+                for (size_t x = 0; x < dstW; ++x)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        size_t offset = nhwc ? ((dstY + y) * width + dstX + x) * channels + c : (c * height + dstY + y) * width + dstX + x;
+                        float value = resized.At<float>(x * channels + c, y);
+                        if (float32)
+                            dst.At<float>(offset, i) = (value - mean[c]) * scale[c];
+                        else
+                            dst.At<uint8_t>(offset, i) = (uint8_t)Simd::RestrictRange(Simd::Round(value), 0, 255);
+                    }
+                }
+            }
+        }
+    }
+
+    bool SynetCropResizeAutoTest(size_t channels, size_t width, size_t height, SimdTensorFormatType format, SimdTensorDataType type, SimdBool keepAspect, FuncCR f1, FuncCR f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, format, type, keepAspect);
+        f2.Update(channels, format, type, keepAspect);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << W << ", " << H << "] -> [" << width << ", " << height << "].");
+
+        View src(W, H, View::Format(View::Gray8 + channels - 1), NULL, TEST_ALIGN(W));
+        FillRandom(src);
+
+        std::vector<ptrdiff_t> rois;
+        for (size_t i = 0; i < 32; ++i)
+        {
+            ptrdiff_t left = Random(W) - W / 8, top = Random(H) - H / 8;
+            rois.push_back(left);
+            rois.push_back(top);
+            rois.push_back(left + 1 + Random(W / 2));
+            rois.push_back(top + 1 + Random(H / 2));
+        }
+        rois.push_back(1), rois.push_back(1), rois.push_back(2), rois.push_back(2);
+        rois.push_back(3), rois.push_back(3), rois.push_back(4), rois.push_back(H / 4);
+        rois.push_back(5), rois.push_back(5), rois.push_back(W / 4), rois.push_back(6);
+        rois.push_back(W / 2), rois.push_back(H / 2), rois.push_back(W / 2), rois.push_back(H);
+
+        const float mean[4] = { 104.0f, 117.0f, 123.0f, 128.0f }, scale[4] = { 0.017f, 0.018f, 0.019f, 0.020f };
+
+        View::Format dstFormat = type == SimdTensorData32f ? View::Float : View::Gray8;
+        View dst1(width * height * channels, rois.size() / 4, dstFormat, NULL, 1);
+        View dst2(width * height * channels, rois.size() / 4, dstFormat, NULL, 1);
+        View dst3(width * height * channels, rois.size() / 4, dstFormat, NULL, 1);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, rois, channels, width, height, format, keepAspect, mean, scale, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, rois, channels, width, height, format, keepAspect, mean, scale, dst2));
+
+        SynetCropResizeReference(src, rois, channels, width, height, format, keepAspect, mean, scale, dst3);
+
+        if (type == SimdTensorData32f)
+        {
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute, "dst1 & dst2");
+            result = result && Compare(dst1, dst3, EPS, true, 64, DifferenceAbsolute, "dst1 & reference");
+        }
+        else
+        {
+            result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+            result = result && Compare(dst1, dst3, 1, true, 64, 0, "dst1 & reference");
+        }
+
+        return result;
+    }
+
+    bool SynetCropResizeAutoTest(const FuncCR & f1, const FuncCR & f2)
+    {
+        bool result = true;
+
+        for (size_t c = 1; c <= 4; ++c)
+        {
+            result = result && SynetCropResizeAutoTest(c, 64, 64, SimdTensorFormatNchw, SimdTensorData32f, SimdFalse, f1, f2);
+            result = result && SynetCropResizeAutoTest(c, 57, 33, SimdTensorFormatNhwc, SimdTensorData32f, SimdTrue, f1, f2);
+        }
+        result = result && SynetCropResizeAutoTest(3, 37, 61, SimdTensorFormatNchw, SimdTensorData32f, SimdTrue, f1, f2);
+        result = result && SynetCropResizeAutoTest(3, 48, 32, SimdTensorFormatNhwc, SimdTensorData32f, SimdFalse, f1, f2);
+        result = result && SynetCropResizeAutoTest(3, 40, 40, SimdTensorFormatNchw, SimdTensorData8u, SimdFalse, f1, f2);
+        result = result && SynetCropResizeAutoTest(4, 31, 45, SimdTensorFormatNhwc, SimdTensorData8u, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool SynetCropResizeAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetCropResizeAutoTest(FUNC_CR(Simd::Base::SynetCropResizeInit), FUNC_CR(SimdSynetCropResizeInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetCropResizeAutoTest(FUNC_CR(Simd::Sse2::SynetCropResizeInit), FUNC_CR(SimdSynetCropResizeInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetCropResizeAutoTest(FUNC_CR(Simd::Avx2::SynetCropResizeInit), FUNC_CR(SimdSynetCropResizeInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetCropResizeAutoTest(FUNC_CR(Simd::Avx512bw::SynetCropResizeInit), FUNC_CR(SimdSynetCropResizeInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetCropResizeAutoTest(FUNC_CR(Simd::Neon::SynetCropResizeInit), FUNC_CR(SimdSynetCropResizeInit));
+#endif
+
+        return result;
+    }
+}
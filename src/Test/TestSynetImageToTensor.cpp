@@ -0,0 +1,186 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2019 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+#include "Test/TestTensor.h"
+
+#include "Simd/SimdSynetImageToTensor.h"
+#include "Simd/SimdFrame.hpp"
+
+namespace Test
+{
+    typedef Simd::Frame<Simd::Allocator> Frame;
+
+    namespace
+    {
+        struct FuncIT
+        {
+            typedef void*(*FuncPtr)(size_t srcWidth, size_t srcHeight, SimdFrameFormatType srcFormat, size_t dstWidth, size_t dstHeight, size_t dstChannels, const float * mean, const float * scale, SimdTensorFormatType dstFormat);
+
+            FuncPtr func;
+            String description;
+
+            FuncIT(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(Frame::Format srcFormat, size_t channels, SimdTensorFormatType dstFormat)
+            {
+                static const char * names[] = { "", "Nv12", "Yuv420p", "Bgra32", "Bgr24", "Gray8" };
+                std::stringstream ss;
+                ss << description << "[" << names[srcFormat] << "-" << channels << "-" << (dstFormat == SimdTensorFormatNchw ? "nchw" : "nhwc") << "]";
+                description = ss.str();
+            }
+
+            void Call(const Frame & src, const float * mean, const float * scale, Tensor32f & dst) const
+            {
+                const uint8_t * planes[Frame::PLANE_COUNT_MAX];
+                size_t strides[Frame::PLANE_COUNT_MAX];
+                for (size_t i = 0; i < Frame::PLANE_COUNT_MAX; ++i)
+                {
+                    planes[i] = src.planes[i].data;
+                    strides[i] = src.planes[i].stride;
+                }
+                size_t channels = dst.Axis(dst.Format() == SimdTensorFormatNhwc ? 3 : 1);
+                void * context = func(src.width, src.height, (SimdFrameFormatType)src.format, dst.Axis(dst.Format() == SimdTensorFormatNhwc ? 2 : 3), 
+                    dst.Axis(dst.Format() == SimdTensorFormatNhwc ? 1 : 2), channels, mean, scale, dst.Format());
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    ::SimdSynetImageToTensorRun(context, planes, strides, dst.Data());
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_IT(function) \
+    FuncIT(function, std::string(#function))
+
+    static void SynetImageToTensorReference(const Frame & src, const float * mean, const float * scale, Tensor32f & dst)
+    {
+        bool nhwc = dst.Format() == SimdTensorFormatNhwc;
+        size_t channels = dst.Axis(nhwc ? 3 : 1), height = dst.Axis(nhwc ? 1 : 2), width = dst.Axis(nhwc ? 2 : 3);
+        Frame converted(src.width, src.height, channels == 3 ? Frame::Bgr24 : Frame::Gray8);
+        Simd::Convert(src, converted);
+        const View & bgr = converted.planes[0];
+        View original(src.width*channels, src.height, View::Float), resized(width*channels, height, View::Float);
+        for (size_t y = 0; y < bgr.height; ++y)
+            for (size_t x = 0; x < original.width; ++x)
+                original.At<float>(x, y) = bgr.At<uint8_t>(x, y);
+        void * resizer = SimdResizerInit(src.width, src.height, width, height, channels, SimdResizeChannelFloat, SimdResizeMethodBilinear);
+        SimdResizerRun(resizer, original.data, original.stride, resized.data, resized.stride);
+        SimdRelease(resizer);
+        for (size_t y = 0; y < height; ++y)
+            for (size_t x = 0; x < width; ++x)
+                for (size_t c = 0; c < channels; ++c)
+                    (nhwc ? dst.Data({ 0, y, x, c }) : dst.Data({ 0, c, y, x }))[0] = (resized.At<float>(x*channels + c, y) - mean[c])*scale[c];
+    }
+
+    bool SynetImageToTensorAutoTest(size_t srcW, size_t srcH, Frame::Format srcF, size_t dstW, size_t dstH, size_t channels, SimdTensorFormatType dstF, FuncIT f1, FuncIT f2)
+    {
+        bool result = true;
+
+        f1.Update(srcF, channels, dstF);
+        f2.Update(srcF, channels, dstF);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        Frame src(srcW, srcH, srcF);
+        for (size_t i = 0; i < src.PlaneCount(); ++i)
+            FillRandom(src.planes[i]);
+
+        const float mean[3] = { 104.0f, 117.0f, 123.0f }, scale[3] = { 0.017f, 0.018f, 0.019f };
+
+        Tensor32f dst1(ToShape(1, channels, dstH, dstW, dstF), dstF);
+        Tensor32f dst2(ToShape(1, channels, dstH, dstW, dstF), dstF);
+        Tensor32f dst3(ToShape(1, channels, dstH, dstW, dstF), dstF);
+        Tensor32f dst4(ToShape(1, channels, dstH, dstW, dstF), dstF);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, mean, scale, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, mean, scale, dst2));
+
+        SynetImageToTensorReference(src, mean, scale, dst3);
+
+        for (size_t i = 0; i < 2; ++i)
+            Simd::SynetImageToTensor(src, dstW, dstH, channels, mean, scale, dst4.Data(), dstF);
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute, "dst1 & dst2");
+        result = result && Compare(dst1, dst3, EPS, true, 64, DifferenceAbsolute, "dst1 & reference");
+        result = result && Compare(dst2, dst4, 0.0f, true, 64, DifferenceAbsolute, "dst2 & wrapper");
+
+        return result;
+    }
+
+    bool SynetImageToTensorAutoTest(const FuncIT & f1, const FuncIT & f2)
+    {
+        bool result = true;
+
+        const Frame::Format formats[] = { Frame::Nv12, Frame::Yuv420p, Frame::Bgra32, Frame::Bgr24, Frame::Gray8 };
+        for (size_t f = 0; f < 5; ++f)
+        {
+            for (size_t c = 1; c <= 3; c += 2)
+            {
+                result = result && SynetImageToTensorAutoTest(W, H, formats[f], W / 3 + 1, H / 3 - 1, c, SimdTensorFormatNchw, f1, f2);
+                result = result && SynetImageToTensorAutoTest(W - 2 * O, H + 2 * O, formats[f], W * 3 / 2 - 1, H / 2 + 1, c, SimdTensorFormatNhwc, f1, f2);
+            }
+        }
+        result = result && SynetImageToTensorAutoTest(W, H, Frame::Nv12, 224, 224, 3, SimdTensorFormatNchw, f1, f2);
+
+        return result;
+    }
+
+    bool SynetImageToTensorAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetImageToTensorAutoTest(FUNC_IT(Simd::Base::SynetImageToTensorInit), FUNC_IT(SimdSynetImageToTensorInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetImageToTensorAutoTest(FUNC_IT(Simd::Sse2::SynetImageToTensorInit), FUNC_IT(SimdSynetImageToTensorInit));
+#endif 
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && SynetImageToTensorAutoTest(FUNC_IT(Simd::Ssse3::SynetImageToTensorInit), FUNC_IT(SimdSynetImageToTensorInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetImageToTensorAutoTest(FUNC_IT(Simd::Avx2::SynetImageToTensorInit), FUNC_IT(SimdSynetImageToTensorInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetImageToTensorAutoTest(FUNC_IT(Simd::Avx512bw::SynetImageToTensorInit), FUNC_IT(SimdSynetImageToTensorInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetImageToTensorAutoTest(FUNC_IT(Simd::Neon::SynetImageToTensorInit), FUNC_IT(SimdSynetImageToTensorInit));
+#endif
+
+        return result;
+    }
+}
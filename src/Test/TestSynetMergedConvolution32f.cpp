@@ -35,81 +35,64 @@ namespace Test
         struct Param
         {
             SimdBool trans, add;
-            size_t batch;
+            size_t batch, count;
             SimdConvolutionParameters conv[3];
             mutable float *weight[3], *bias[3], *params[3];
 
             Param(size_t n, size_t c0, size_t h0, size_t w0, size_t k0, size_t s0, ::SimdConvolutionActivationType a0, 
-                size_t c1, size_t k1, size_t s1, ::SimdConvolutionActivationType a1, size_t c2, ::SimdConvolutionActivationType a2, SimdBool a) 
+                size_t c1, size_t k1, size_t s1, ::SimdConvolutionActivationType a1, size_t c2, ::SimdConvolutionActivationType a2, SimdBool a, size_t d1 = 1) 
             {
                 trans = ::SimdTrue;
                 batch = n;
+                count = 3;
                 this->add = a;
+                SetConv(conv[0], c0, h0, w0, c1, k0, s0, 1, 1, a0);
+                SetConv(conv[1], c1, conv[0].dstH, conv[0].dstW, c1, k1, s1, d1, c1, a1);
+                SetConv(conv[2], c1, conv[1].dstH, conv[1].dstW, c2, 1, 1, 1, 1, a2);
+            }
 
-                conv[0].srcC = c0;
-                conv[0].srcH = h0;
-                conv[0].srcW = w0;
-                conv[0].dstC = c1;
-                conv[0].kernelY = k0;
-                conv[0].kernelX = k0;
-                conv[0].dilationY = 1;
-                conv[0].dilationX = 1;
-                conv[0].strideY = s0;
-                conv[0].strideX = s0;
-                conv[0].padY = s0 == 1 || (conv[0].srcH & 1) ? (k0 - 1) / 2 : 0;
-                conv[0].padX = s0 == 1 || (conv[0].srcW & 1) ? (k0 - 1) / 2 : 0;
-                conv[0].padH = (k0 - 1) / 2;
-                conv[0].padW = (k0 - 1) / 2;
-                conv[0].group = 1;
-                conv[0].activation = a0;
-                conv[0].dstH = (conv[0].srcH + conv[0].padY + conv[0].padH - conv[0].kernelY) / conv[0].strideY + 1;
-                conv[0].dstW = (conv[0].srcW + conv[0].padX + conv[0].padW - conv[0].kernelX) / conv[0].strideX + 1;
-
-                conv[1].srcC = c1;
-                conv[1].srcH = conv[0].dstH;
-                conv[1].srcW = conv[0].dstW;
-                conv[1].dstC = c1;
-                conv[1].kernelY = k1;
-                conv[1].kernelX = k1;
-                conv[1].dilationY = 1;
-                conv[1].dilationX = 1;
-                conv[1].strideY = s1;
-                conv[1].strideX = s1;
-                conv[1].padY = s1 == 1 || (conv[1].srcH & 1) ? (k1 - 1) / 2 : 0;
-                conv[1].padX = s1 == 1 || (conv[1].srcW & 1) ? (k1 - 1) / 2 : 0;
-                conv[1].padH = (k1 - 1) / 2;
-                conv[1].padW = (k1 - 1) / 2;
-                conv[1].group = c1;
-                conv[1].activation = a1;
-                conv[1].dstH = (conv[1].srcH + conv[1].padY + conv[1].padH - conv[1].kernelY) / conv[1].strideY + 1;
-                conv[1].dstW = (conv[1].srcW + conv[1].padX + conv[1].padW - conv[1].kernelX) / conv[1].strideX + 1;
-
-                conv[2].srcC = c1;
-                conv[2].srcH = conv[1].dstH;
-                conv[2].srcW = conv[1].dstW;
-                conv[2].dstC = c2;
-                conv[2].kernelY = 1;
-                conv[2].kernelX = 1;
-                conv[2].dilationY = 1;
-                conv[2].dilationX = 1;
-                conv[2].strideY = 1;
-                conv[2].strideX = 1;
-                conv[2].padY = 0;
-                conv[2].padX = 0;
-                conv[2].padH = 0;
-                conv[2].padW = 0;
-                conv[2].group = 1;
-                conv[2].activation = a2;
-                conv[2].dstH = (conv[2].srcH + conv[2].padY + conv[2].padH - conv[2].kernelY) / conv[2].strideY + 1;
-                conv[2].dstW = (conv[2].srcW + conv[2].padX + conv[2].padW - conv[2].kernelX) / conv[2].strideX + 1;
-
-                for (size_t i = 0; i < 3; ++i)
-                {
-                    conv[i].srcT = SimdTensorData32f;
-                    conv[i].srcF = SimdTensorFormatNhwc;
-                    conv[i].dstT = SimdTensorData32f;
-                    conv[i].dstF = SimdTensorFormatNhwc;
-                }
+            Param(size_t n, size_t c0, size_t h0, size_t w0, size_t k0, size_t s0, size_t d0, ::SimdConvolutionActivationType a0,
+                size_t c1, ::SimdConvolutionActivationType a1, SimdBool a)
+            {
+                trans = ::SimdTrue;
+                batch = n;
+                count = 2;
+                this->add = a;
+                SetConv(conv[0], c0, h0, w0, c0, k0, s0, d0, c0, a0);
+                SetConv(conv[1], c0, conv[0].dstH, conv[0].dstW, c1, 1, 1, 1, 1, a1);
+            }
+
+            static void SetConv(SimdConvolutionParameters & c, size_t srcC, size_t srcH, size_t srcW, size_t dstC,
+                size_t k, size_t s, size_t d, size_t g, ::SimdConvolutionActivationType a)
+            {
+                size_t e = d * (k - 1) + 1;
+                c.srcC = srcC;
+                c.srcH = srcH;
+                c.srcW = srcW;
+                c.dstC = dstC;
+                c.kernelY = k;
+                c.kernelX = k;
+                c.dilationY = d;
+                c.dilationX = d;
+                c.strideY = s;
+                c.strideX = s;
+                c.padY = s == 1 || (srcH & 1) ? (e - 1) / 2 : 0;
+                c.padX = s == 1 || (srcW & 1) ? (e - 1) / 2 : 0;
+                c.padH = (e - 1) / 2;
+                c.padW = (e - 1) / 2;
+                c.group = g;
+                c.activation = a;
+                c.dstH = (c.srcH + c.padY + c.padH - e) / c.strideY + 1;
+                c.dstW = (c.srcW + c.padX + c.padW - e) / c.strideX + 1;
+                c.srcT = SimdTensorData32f;
+                c.srcF = SimdTensorFormatNhwc;
+                c.dstT = SimdTensorData32f;
+                c.dstF = SimdTensorFormatNhwc;
+            }
+
+            const SimdConvolutionParameters & Back() const
+            {
+                return conv[count - 1];
             }
         };
 
@@ -127,15 +110,20 @@ namespace Test
                 std::stringstream ss;
                 ss << description;
                 ss << "[" << p.batch << "x" << p.conv[0].srcC << "x" << p.conv[0].srcH << "x" << p.conv[0].srcW;
-                ss << "-" << p.conv[0].dstC << "x" << p.conv[0].kernelY << "x" << p.conv[0].strideY;
-                ss << "-" << p.conv[1].kernelY << "x" << p.conv[1].strideY << "-" << p.conv[2].dstC;
+                if (p.count == 3)
+                    ss << "-" << p.conv[0].dstC << "x" << p.conv[0].kernelY << "x" << p.conv[0].strideY;
+                const SimdConvolutionParameters & d = p.conv[p.count - 2];
+                ss << "-" << d.kernelY << "x" << d.strideY;
+                if (d.dilationY > 1)
+                    ss << "x" << d.dilationY;
+                ss << "-" << p.Back().dstC;
                 ss << "]";
                 description = ss.str();
             }
 
             void Call(const Param & p, const Tensor32f & src, Tensor32f & buf, Tensor32f & dst) const
             {
-                void * context = func(p.batch, p.conv, 3, p.add);
+                void * context = func(p.batch, p.conv, p.count, p.add);
                 buf.Extend({ ::SimdSynetMergedConvolution32fExternalBufferSize(context) });
                 ::SimdSynetMergedConvolution32fSetParams(context, p.weight, NULL, p.bias, p.params);
                 if (p.add)
@@ -168,7 +156,7 @@ namespace Test
         FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
 
         Tensor32f weight[3], bias[3], params[3];
-        for (size_t i = 0; i < 3; ++i)
+        for (size_t i = 0; i < p.count; ++i)
         {
             weight[i].Reshape({ p.conv[i].kernelY, p.conv[i].kernelX, p.conv[i].srcC / p.conv[i].group, p.conv[i].dstC });
             FillRandom(weight[i].Data(), weight[i].Size(), -1.0, 1.0f);
@@ -187,8 +175,8 @@ namespace Test
 
         Tensor32f buf;
 
-        Tensor32f dst1({ p.batch, p.conv[2].dstH, p.conv[2].dstW, p.conv[2].dstC}, SimdTensorFormatNhwc, 0.01f);
-        Tensor32f dst2({ p.batch, p.conv[2].dstH, p.conv[2].dstW, p.conv[2].dstC}, SimdTensorFormatNhwc, 0.02f);
+        Tensor32f dst1({ p.batch, p.Back().dstH, p.Back().dstW, p.Back().dstC}, SimdTensorFormatNhwc, 0.01f);
+        Tensor32f dst2({ p.batch, p.Back().dstH, p.Back().dstW, p.Back().dstC}, SimdTensorFormatNhwc, 0.02f);
 
         TEST_ALIGN(SIMD_ALIGN);
 
@@ -228,6 +216,14 @@ namespace Test
 #endif
 #if 1
         result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(1, 160, 10, 10, 1, 1, a0, 960, 3, 1, a1, 160, a2, f), f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(2, 24, 56, 56, 1, 1, a0, 144, 3, 1, a1, 24, a2, f), f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(1, 32, 57, 57, 1, 1, a0, 192, 3, 2, a1, 64, a2, f), f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(1, 40, 28, 28, 1, 1, a0, 240, 5, 1, a1, 40, a2, f), f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(1, 80, 29, 29, 1, 1, a0, 480, 5, 2, a1, 112, a2, f), f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(1, 64, 24, 24, 1, 1, a0, 384, 3, 1, a1, 64, a2, f, 2), f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(1, 64, 56, 56, 3, 1, 1, a1, 128, a2, f), f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(1, 128, 28, 28, 3, 2, 1, a1, 256, a2, f), f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(1, 96, 20, 20, 5, 1, 2, a1, 48, a2, f), f1, f2);
 #endif
 #else
         //result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(1, 160, 10, 10, 1, 1, a0, 960, 3, 1, a1, 160, a2, f), f1, f2);
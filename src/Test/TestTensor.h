@@ -301,6 +301,7 @@ namespace Test
     };
 
     typedef Tensor<float> Tensor32f;
+    typedef Tensor<uint8_t> Tensor8u;
 
     //-------------------------------------------------------------------------
 
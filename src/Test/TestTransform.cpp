@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdWarp.h"
+
 namespace Test
 {
     namespace
@@ -130,4 +132,197 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncWarp
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value);
+
+            FuncPtr func;
+            String desc;
+
+            FuncWarp(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(SimdResizeChannelType type, size_t channels, SimdWarpBorderType border)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << (type == SimdResizeChannelFloat ? "f" : "b") << "-" << channels << "-";
+                switch (border)
+                {
+                case SimdWarpBorderConstant:    ss << "C"; break;
+                case SimdWarpBorderTransparent: ss << "T"; break;
+                case SimdWarpBorderReplicate:   ss << "R"; break;
+                default:
+                    assert(0);
+                }
+                ss << "]";
+                desc = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpBorderType border, const uint8_t * value) const
+            {
+                size_t srcW = src.width, dstW = dst.width;
+                if (type == SimdResizeChannelFloat)
+                    srcW /= channels, dstW /= channels;
+                void * context = func(srcW, src.height, dstW, dst.height, channels, type, mat, border, value);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    SimdWarpRun(context, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_WARP(function) \
+    FuncWarp(function, std::string(#function))
+
+    bool WarpAutoTest(SimdResizeChannelType type, size_t channels, SimdWarpBorderType border, int width, int height, const float * mat, FuncWarp f1, FuncWarp f2)
+    {
+        bool result = true;
+
+        f1.Update(type, channels, border);
+        f2.Update(type, channels, border);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        View::Format format = View::Float;
+        if (type == SimdResizeChannelByte)
+        {
+            switch (channels)
+            {
+            case 1: format = View::Gray8; break;
+            case 2: format = View::Uv16; break;
+            case 3: format = View::Bgr24; break;
+            case 4: format = View::Bgra32; break;
+            default:
+                assert(0);
+            }
+        }
+        size_t w = type == SimdResizeChannelFloat ? width * channels : width;
+
+        View s(w, height, format, NULL, TEST_ALIGN(w));
+        if (format == View::Float)
+            FillRandom32f(s);
+        else
+            FillRandom(s);
+
+        View d1(w, height, format, NULL, TEST_ALIGN(w));
+        View d2(w, height, format, NULL, TEST_ALIGN(w));
+        if (format == View::Float)
+            FillRandom32f(d1);
+        else
+            FillRandom(d1);
+        Simd::Copy(d1, d2);
+
+        float value[4] = { 0.1f, 0.3f, 0.5f, 0.7f };
+        if (type == SimdResizeChannelByte)
+        {
+            for (size_t i = 0; i < sizeof(value); ++i)
+                ((uint8_t*)value)[i] = Random(256);
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d1, channels, type, mat, border, (uint8_t*)value));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d2, channels, type, mat, border, (uint8_t*)value));
+
+        if (format == View::Float)
+            result = result && Compare(d1, d2, EPS, true, 32, DifferenceAbsolute);
+        else
+            result = result && Compare(d1, d2, 0, true, 32);
+
+        return result;
+    }
+
+    bool WarpAutoTest(const float * mat, const FuncWarp & f1, const FuncWarp & f2)
+    {
+        bool result = true;
+
+        for (SimdWarpBorderType border = SimdWarpBorderConstant; border <= SimdWarpBorderReplicate; border = SimdWarpBorderType(border + 1))
+        {
+            for (size_t channels = 1; channels <= 4; ++channels)
+            {
+                result = result && WarpAutoTest(SimdResizeChannelByte, channels, border, W, H, mat, f1, f2);
+                result = result && WarpAutoTest(SimdResizeChannelByte, channels, border, W + O, H - O, mat, f1, f2);
+            }
+            result = result && WarpAutoTest(SimdResizeChannelFloat, 1, border, W, H, mat, f1, f2);
+            result = result && WarpAutoTest(SimdResizeChannelFloat, 3, border, W + O, H - O, mat, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool WarpAffineAutoTest(const FuncWarp & f1, const FuncWarp & f2)
+    {
+        const float a = 0.3f, k = 1.1f;
+        const float mat[6] = { k * ::cos(a), -k * ::sin(a), 0.1f * W, k * ::sin(a), k * ::cos(a), -0.2f * H };
+        return WarpAutoTest(mat, f1, f2);
+    }
+
+    bool WarpAffineAutoTest()
+    {
+        bool result = true;
+
+        result = result && WarpAffineAutoTest(FUNC_WARP(Simd::Base::WarpAffineInit), FUNC_WARP(SimdWarpAffineInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WARP(Simd::Sse41::WarpAffineInit), FUNC_WARP(SimdWarpAffineInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WARP(Simd::Avx2::WarpAffineInit), FUNC_WARP(SimdWarpAffineInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WARP(Simd::Avx512bw::WarpAffineInit), FUNC_WARP(SimdWarpAffineInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && WarpAffineAutoTest(FUNC_WARP(Simd::Neon::WarpAffineInit), FUNC_WARP(SimdWarpAffineInit));
+#endif 
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest(const FuncWarp & f1, const FuncWarp & f2)
+    {
+        const float mat[9] = { 0.9f, 0.1f, 0.05f * W, -0.1f, 1.0f, 0.1f * H, 0.0005f, -0.0003f, 1.0f };
+        return WarpAutoTest(mat, f1, f2);
+    }
+
+    bool WarpPerspectiveAutoTest()
+    {
+        bool result = true;
+
+        result = result && WarpPerspectiveAutoTest(FUNC_WARP(Simd::Base::WarpPerspectiveInit), FUNC_WARP(SimdWarpPerspectiveInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && WarpPerspectiveAutoTest(FUNC_WARP(Simd::Sse41::WarpPerspectiveInit), FUNC_WARP(SimdWarpPerspectiveInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpPerspectiveAutoTest(FUNC_WARP(Simd::Avx2::WarpPerspectiveInit), FUNC_WARP(SimdWarpPerspectiveInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && WarpPerspectiveAutoTest(FUNC_WARP(Simd::Avx512bw::WarpPerspectiveInit), FUNC_WARP(SimdWarpPerspectiveInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && WarpPerspectiveAutoTest(FUNC_WARP(Simd::Neon::WarpPerspectiveInit), FUNC_WARP(SimdWarpPerspectiveInit));
+#endif 
+
+        return result;
+    }
 }
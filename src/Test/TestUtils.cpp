@@ -547,6 +547,83 @@ namespace Test
         return Compare(&a, 0, &b, 0, 1, 1, differenceMax, printError, 0, differenceType, description);
     }
 
+    namespace
+    {
+        struct YuvCoefficients
+        {
+            double kr, kb, kg, yLo, yScale, uvScale;
+
+            YuvCoefficients(SimdYuvType yuvType)
+            {
+                switch (yuvType)
+                {
+                case SimdYuvBt601: kr = 0.299; kb = 0.114; break;
+                case SimdYuvBt709: kr = 0.2126; kb = 0.0722; break;
+                case SimdYuvBt2020: kr = 0.2627; kb = 0.0593; break;
+                case SimdYuvTrect871: kr = 0.299; kb = 0.114; break;
+                default:
+                    assert(0);
+                }
+                kg = 1.0 - kr - kb;
+                bool full = yuvType == SimdYuvTrect871;
+                yLo = full ? 0.0 : 16.0;
+                yScale = full ? 1.0 : 219.0 / 255.0;
+                uvScale = full ? 1.0 : 224.0 / 255.0;
+            }
+        };
+
+        SIMD_INLINE uint8_t RoundToU8(double value)
+        {
+            return (uint8_t)std::min(std::max(::floor(value + 0.5), 0.0), 255.0);
+        }
+    }
+
+    void Yuv444pToBgrReference(const View & y, const View & u, const View & v, View & bgr, SimdYuvType yuvType)
+    {
+        assert(EqualSize(y, u) && EqualSize(y, v) && EqualSize(y, bgr) && (bgr.format == View::Bgr24 || bgr.format == View::Bgra32));
+
+        const YuvCoefficients c(yuvType);
+        const size_t channels = bgr.PixelSize();
+        for (size_t row = 0; row < y.height; ++row)
+        {
+            for (size_t col = 0; col < y.width; ++col)
+            {
+                double luma = (y.At<uint8_t>(col, row) - c.yLo) / c.yScale;
+                double cb = (u.At<uint8_t>(col, row) - 128.0) / c.uvScale;
+                double cr = (v.At<uint8_t>(col, row) - 128.0) / c.uvScale;
+                double blue = luma + 2.0 * (1.0 - c.kb) * cb;
+                double red = luma + 2.0 * (1.0 - c.kr) * cr;
+                double green = (luma - c.kr * red - c.kb * blue) / c.kg;
+                uint8_t * dst = bgr.Row<uint8_t>(row) + col * channels;
+                dst[0] = RoundToU8(blue);
+                dst[1] = RoundToU8(green);
+                dst[2] = RoundToU8(red);
+                if (channels == 4)
+                    dst[3] = 0xFF;
+            }
+        }
+    }
+
+    void BgrToYuv444pReference(const View & bgr, View & y, View & u, View & v, SimdYuvType yuvType)
+    {
+        assert(EqualSize(y, u) && EqualSize(y, v) && EqualSize(y, bgr) && (bgr.format == View::Bgr24 || bgr.format == View::Bgra32));
+
+        const YuvCoefficients c(yuvType);
+        const size_t channels = bgr.PixelSize();
+        for (size_t row = 0; row < bgr.height; ++row)
+        {
+            for (size_t col = 0; col < bgr.width; ++col)
+            {
+                const uint8_t * src = bgr.Row<uint8_t>(row) + col * channels;
+                double blue = src[0], green = src[1], red = src[2];
+                double luma = c.kr * red + c.kg * green + c.kb * blue;
+                y.At<uint8_t>(col, row) = RoundToU8(c.yLo + luma * c.yScale);
+                u.At<uint8_t>(col, row) = RoundToU8(128.0 + (blue - luma) / (2.0 * (1.0 - c.kb)) * c.uvScale);
+                v.At<uint8_t>(col, row) = RoundToU8(128.0 + (red - luma) / (2.0 * (1.0 - c.kr)) * c.uvScale);
+            }
+        }
+    }
+
     String ColorDescription(View::Format format)
     {
         std::stringstream ss;
@@ -638,4 +715,16 @@ namespace Test
             return ExpandToLeft("", iCount + fCount + 1);
         }
     }
+
+    String TemporaryPath(const String & name)
+    {
+#ifdef _WIN32
+        const char * dir = ::getenv("TEMP");
+#else
+        const char * dir = ::getenv("TMPDIR");
+        if (dir == NULL)
+            dir = "/tmp";
+#endif
+        return String(dir ? dir : ".") + "/" + name;
+    }
 }
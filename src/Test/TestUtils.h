@@ -90,6 +90,10 @@ namespace Test
     bool Compare(const float & a, const float & b, float differenceMax = EPS, bool printError = false, 
         DifferenceType differenceType = DifferenceRelative, const String & description = "");
 
+    void Yuv444pToBgrReference(const View & y, const View & u, const View & v, View & bgr, SimdYuvType yuvType);
+
+    void BgrToYuv444pReference(const View & bgr, View & y, View & u, View & v, SimdYuvType yuvType);
+
     String ColorDescription(View::Format format);
 
     String FormatDescription(View::Format format);
@@ -140,6 +144,8 @@ namespace Test
 
     String ToString(double value, size_t iCount, size_t fCount);
 
+    String TemporaryPath(const String & name);
+
     SIMD_INLINE String GetCurrentDateTimeString()
     {
         std::time_t t;
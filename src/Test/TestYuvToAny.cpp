@@ -190,6 +190,293 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncYuvV2
+        {
+            typedef void(*FuncBgrPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+            typedef void(*FuncBgrV2Ptr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+            typedef void(*FuncBgraPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+            typedef void(*FuncBgraV2Ptr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncBgrV2Ptr bgr;
+            FuncBgrPtr bgrV1;
+            FuncBgraV2Ptr bgra;
+            FuncBgraPtr bgraV1;
+            String description;
+            SimdYuvType yuvType;
+
+            FuncYuvV2(const FuncBgrV2Ptr & f, const FuncBgrPtr & v1, const String & d) : bgr(f), bgrV1(v1), bgra(NULL), bgraV1(NULL), description(d), yuvType(SimdYuvBt601) {}
+            FuncYuvV2(const FuncBgraV2Ptr & f, const FuncBgraPtr & v1, const String & d) : bgr(NULL), bgrV1(NULL), bgra(f), bgraV1(v1), description(d), yuvType(SimdYuvBt601) {}
+
+            View::Format Format() const
+            {
+                return bgr ? View::Bgr24 : View::Bgra32;
+            }
+
+            void Update(SimdYuvType type)
+            {
+                yuvType = type;
+                description = description + "[" + ToString(int(type)) + "]";
+            }
+
+            void Call(const View & y, const View & u, const View & v, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (bgr)
+                    bgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+                else
+                    bgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, 0xFF, yuvType);
+            }
+
+            void CallV1(const View & y, const View & u, const View & v, View & dst) const
+            {
+                if (bgrV1)
+                    bgrV1(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride);
+                else
+                    bgraV1(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, 0xFF);
+            }
+        };
+    }
+
+#define FUNC_YUV_V2(function, v1) FuncYuvV2(function, v1, #function)
+
+    bool YuvToAnyV2AutoTest(int width, int height, int dx, int dy, SimdYuvType yuvType, FuncYuvV2 f1, FuncYuvV2 f2)
+    {
+        bool result = true;
+
+        f1.Update(yuvType);
+        f2.Update(yuvType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / dx;
+        const int uvHeight = height / dy;
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(u);
+        View v(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(v);
+
+        View dst1(width, height, f1.Format(), NULL, TEST_ALIGN(width));
+        View dst2(width, height, f1.Format(), NULL, TEST_ALIGN(width));
+        View dst3(width, height, f1.Format(), NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 255);
+
+        if (yuvType == SimdYuvBt601)
+        {
+            f1.CallV1(y, u, v, dst3);
+            result = result && Compare(dst1, dst3, 0, true, 64, 255, "v1");
+        }
+
+        if (dx == 1 && dy == 1)
+        {
+            Yuv444pToBgrReference(y, u, v, dst3, yuvType);
+            result = result && Compare(dst1, dst3, 2, true, 64, 255, "reference");
+        }
+
+        return result;
+    }
+
+    bool YuvToAnyV2AutoTest(int dx, int dy, const FuncYuvV2 & f1, const FuncYuvV2 & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdYuvBt601; type <= SimdYuvTrect871 && result; ++type)
+        {
+            result = result && YuvToAnyV2AutoTest(W, H, dx, dy, (SimdYuvType)type, f1, f2);
+            result = result && YuvToAnyV2AutoTest(W + O*dx, H - O*dy, dx, dy, (SimdYuvType)type, f1, f2);
+            result = result && YuvToAnyV2AutoTest(W - O*dx, H + O*dy, dx, dy, (SimdYuvType)type, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool Yuv444pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(1, 1, FUNC_YUV_V2(Simd::Base::Yuv444pToBgrV2, Simd::Base::Yuv444pToBgr), FUNC_YUV_V2(SimdYuv444pToBgrV2, SimdYuv444pToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, FUNC_YUV_V2(Simd::Ssse3::Yuv444pToBgrV2, Simd::Ssse3::Yuv444pToBgr), FUNC_YUV_V2(SimdYuv444pToBgrV2, SimdYuv444pToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, FUNC_YUV_V2(Simd::Avx2::Yuv444pToBgrV2, Simd::Avx2::Yuv444pToBgr), FUNC_YUV_V2(SimdYuv444pToBgrV2, SimdYuv444pToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, FUNC_YUV_V2(Simd::Avx512bw::Yuv444pToBgrV2, Simd::Avx512bw::Yuv444pToBgr), FUNC_YUV_V2(SimdYuv444pToBgrV2, SimdYuv444pToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, FUNC_YUV_V2(Simd::Neon::Yuv444pToBgrV2, Simd::Neon::Yuv444pToBgr), FUNC_YUV_V2(SimdYuv444pToBgrV2, SimdYuv444pToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv422pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 1, FUNC_YUV_V2(Simd::Base::Yuv422pToBgrV2, Simd::Base::Yuv422pToBgr), FUNC_YUV_V2(SimdYuv422pToBgrV2, SimdYuv422pToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, FUNC_YUV_V2(Simd::Ssse3::Yuv422pToBgrV2, Simd::Ssse3::Yuv422pToBgr), FUNC_YUV_V2(SimdYuv422pToBgrV2, SimdYuv422pToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, FUNC_YUV_V2(Simd::Avx2::Yuv422pToBgrV2, Simd::Avx2::Yuv422pToBgr), FUNC_YUV_V2(SimdYuv422pToBgrV2, SimdYuv422pToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, FUNC_YUV_V2(Simd::Avx512bw::Yuv422pToBgrV2, Simd::Avx512bw::Yuv422pToBgr), FUNC_YUV_V2(SimdYuv422pToBgrV2, SimdYuv422pToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, FUNC_YUV_V2(Simd::Neon::Yuv422pToBgrV2, Simd::Neon::Yuv422pToBgr), FUNC_YUV_V2(SimdYuv422pToBgrV2, SimdYuv422pToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 2, FUNC_YUV_V2(Simd::Base::Yuv420pToBgrV2, Simd::Base::Yuv420pToBgr), FUNC_YUV_V2(SimdYuv420pToBgrV2, SimdYuv420pToBgr));
+
+#ifdef SIMD_SSSE3_ENABLE
+        if (Simd::Ssse3::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, FUNC_YUV_V2(Simd::Ssse3::Yuv420pToBgrV2, Simd::Ssse3::Yuv420pToBgr), FUNC_YUV_V2(SimdYuv420pToBgrV2, SimdYuv420pToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, FUNC_YUV_V2(Simd::Avx2::Yuv420pToBgrV2, Simd::Avx2::Yuv420pToBgr), FUNC_YUV_V2(SimdYuv420pToBgrV2, SimdYuv420pToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, FUNC_YUV_V2(Simd::Avx512bw::Yuv420pToBgrV2, Simd::Avx512bw::Yuv420pToBgr), FUNC_YUV_V2(SimdYuv420pToBgrV2, SimdYuv420pToBgr));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, FUNC_YUV_V2(Simd::Neon::Yuv420pToBgrV2, Simd::Neon::Yuv420pToBgr), FUNC_YUV_V2(SimdYuv420pToBgrV2, SimdYuv420pToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv444pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(1, 1, FUNC_YUV_V2(Simd::Base::Yuv444pToBgraV2, Simd::Base::Yuv444pToBgra), FUNC_YUV_V2(SimdYuv444pToBgraV2, SimdYuv444pToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, FUNC_YUV_V2(Simd::Sse2::Yuv444pToBgraV2, Simd::Sse2::Yuv444pToBgra), FUNC_YUV_V2(SimdYuv444pToBgraV2, SimdYuv444pToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, FUNC_YUV_V2(Simd::Avx2::Yuv444pToBgraV2, Simd::Avx2::Yuv444pToBgra), FUNC_YUV_V2(SimdYuv444pToBgraV2, SimdYuv444pToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, FUNC_YUV_V2(Simd::Avx512bw::Yuv444pToBgraV2, Simd::Avx512bw::Yuv444pToBgra), FUNC_YUV_V2(SimdYuv444pToBgraV2, SimdYuv444pToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(1, 1, FUNC_YUV_V2(Simd::Neon::Yuv444pToBgraV2, Simd::Neon::Yuv444pToBgra), FUNC_YUV_V2(SimdYuv444pToBgraV2, SimdYuv444pToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv422pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 1, FUNC_YUV_V2(Simd::Base::Yuv422pToBgraV2, Simd::Base::Yuv422pToBgra), FUNC_YUV_V2(SimdYuv422pToBgraV2, SimdYuv422pToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, FUNC_YUV_V2(Simd::Sse2::Yuv422pToBgraV2, Simd::Sse2::Yuv422pToBgra), FUNC_YUV_V2(SimdYuv422pToBgraV2, SimdYuv422pToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, FUNC_YUV_V2(Simd::Avx2::Yuv422pToBgraV2, Simd::Avx2::Yuv422pToBgra), FUNC_YUV_V2(SimdYuv422pToBgraV2, SimdYuv422pToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, FUNC_YUV_V2(Simd::Avx512bw::Yuv422pToBgraV2, Simd::Avx512bw::Yuv422pToBgra), FUNC_YUV_V2(SimdYuv422pToBgraV2, SimdYuv422pToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 1, FUNC_YUV_V2(Simd::Neon::Yuv422pToBgraV2, Simd::Neon::Yuv422pToBgra), FUNC_YUV_V2(SimdYuv422pToBgraV2, SimdYuv422pToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(2, 2, FUNC_YUV_V2(Simd::Base::Yuv420pToBgraV2, Simd::Base::Yuv420pToBgra), FUNC_YUV_V2(SimdYuv420pToBgraV2, SimdYuv420pToBgra));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, FUNC_YUV_V2(Simd::Sse2::Yuv420pToBgraV2, Simd::Sse2::Yuv420pToBgra), FUNC_YUV_V2(SimdYuv420pToBgraV2, SimdYuv420pToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, FUNC_YUV_V2(Simd::Avx2::Yuv420pToBgraV2, Simd::Avx2::Yuv420pToBgra), FUNC_YUV_V2(SimdYuv420pToBgraV2, SimdYuv420pToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, FUNC_YUV_V2(Simd::Avx512bw::Yuv420pToBgraV2, Simd::Avx512bw::Yuv420pToBgra), FUNC_YUV_V2(SimdYuv420pToBgraV2, SimdYuv420pToBgra));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && YuvToAnyV2AutoTest(2, 2, FUNC_YUV_V2(Simd::Neon::Yuv420pToBgraV2, Simd::Neon::Yuv420pToBgra), FUNC_YUV_V2(SimdYuv420pToBgraV2, SimdYuv420pToBgra));
+#endif 
+
+        return result;
+    }
+
     bool Yuv444pToHslAutoTest()
     {
         bool result = true;